@@ -19,6 +19,7 @@
  */
 
 #include <bringonline-daemon/task/PollTask.h>
+#include <bringonline-daemon/task/PollScheduler.h>
 #include <bringonline-daemon/task/WaitingRoom.h>
 #include "BringOnlineServer.h"
 
@@ -118,6 +119,7 @@ void BringOnlineServer::start(void)
     systemThreads.create_thread(boost::bind(&FetchDeletion::fetch, fd));
     systemThreads.create_thread(boost::bind(&DeletionStateUpdater::run, &deletionStateUpdater));
     systemThreads.create_thread(boost::bind(&StagingStateUpdater::run, &stagingStateUpdater));
+    systemThreads.create_thread(boost::bind(&PollScheduler::run, &PollScheduler::instance()));
     systemThreads.create_thread(heartBeat);
 }
 
@@ -22,8 +22,11 @@
 
 #include <sstream>
 #include <unordered_set>
+#include "common/Uri.h"
 #include "cred/CredUtility.h"
 
+using fts3::common::Uri;
+
 
 void StagingContext::add(const StagingOperation &stagingOp)
 {
@@ -35,6 +38,14 @@ void StagingContext::add(const StagingOperation &stagingOp)
         bringonlineTimeout = stagingOp.timeout;
     }
 
+    if ((stagingOp.startTime > 0) && (stagingOp.startTime < minStagingStartTime)) {
+        minStagingStartTime = stagingOp.startTime;
+    }
+
+    if (storageEndpoint.empty()) {
+        storageEndpoint = Uri::parse(stagingOp.surl).getSeName();
+    }
+
     add(stagingOp.surl, stagingOp.jobId, stagingOp.fileId);
 }
 
@@ -45,7 +45,7 @@ public:
     StagingContext(BringOnlineServer &bringOnlineServer, const StagingOperation &stagingOp):
         JobContext(stagingOp.userDn, stagingOp.voName, stagingOp.credId, stagingOp.spaceToken),
         stateUpdater(bringOnlineServer.getStagingStateUpdater()), waitingRoom(bringOnlineServer.getWaitingRoom()),
-        pinLifetime(stagingOp.pinLifetime), bringonlineTimeout(stagingOp.timeout)
+        pinLifetime(stagingOp.pinLifetime), bringonlineTimeout(stagingOp.timeout), minStagingStartTime(time(0))
     {
         add(stagingOp);
         startTime = time(0);
@@ -53,12 +53,14 @@ public:
 
     StagingContext(const StagingContext &copy) :
         JobContext(copy), stateUpdater(copy.stateUpdater), waitingRoom(copy.waitingRoom), errorCount(copy.errorCount),
-        pinLifetime(copy.pinLifetime), bringonlineTimeout(copy.bringonlineTimeout), startTime(copy.startTime)
+        pinLifetime(copy.pinLifetime), bringonlineTimeout(copy.bringonlineTimeout), startTime(copy.startTime),
+        minStagingStartTime(copy.minStagingStartTime), storageEndpoint(copy.storageEndpoint)
     {}
 
     StagingContext(StagingContext && copy) :
         JobContext(std::move(copy)), stateUpdater(copy.stateUpdater), waitingRoom(copy.waitingRoom), errorCount(std::move(copy.errorCount)),
-        pinLifetime(copy.pinLifetime), bringonlineTimeout(copy.bringonlineTimeout), startTime(copy.startTime)
+        pinLifetime(copy.pinLifetime), bringonlineTimeout(copy.bringonlineTimeout), startTime(copy.startTime),
+        minStagingStartTime(copy.minStagingStartTime), storageEndpoint(std::move(copy.storageEndpoint))
     {}
 
     virtual ~StagingContext() {}
@@ -93,6 +95,17 @@ public:
         return pinLifetime;
     }
 
+    std::string getStorageEndpoint() const
+    {
+        return storageEndpoint;
+    }
+
+    /// When the oldest request of the batch was started
+    time_t getStartTime() const
+    {
+        return minStagingStartTime;
+    }
+
     bool hasTimeoutExpired();
 
     std::set<std::string> getSurlsToAbort(const std::set<std::pair<std::string, std::string>>&);
@@ -112,6 +125,8 @@ private:
     int pinLifetime;
     int bringonlineTimeout;
     time_t startTime;
+    time_t minStagingStartTime; ///< first staging start timestamp of the batch
+    std::string storageEndpoint;
 };
 
 #endif // STAGINGCONTEXT_H_
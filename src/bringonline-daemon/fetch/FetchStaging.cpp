@@ -67,7 +67,7 @@ void FetchStaging::fetch()
 
             for (auto it_f = files.begin(); it_f != files.end(); ++it_f)
             {
-                std::string storage = Uri::parse(it_f->surl).host;
+                std::string storage(UriView::parse(it_f->surl).host);
                 GroupByType key(it_f->credId, storage, it_f->spaceToken);
                 auto it_t = tasks.find(key);
                 if (it_t == tasks.end()) {
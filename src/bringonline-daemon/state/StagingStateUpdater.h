@@ -73,6 +73,7 @@ public:
         // lock the vector
         boost::mutex::scoped_lock lock(m);
         updates.emplace_back(jobId, fileId, state, error.String(), error.IsRecoverable());
+        notifyIfFull();
         FTS3_COMMON_LOGGER_NEWLOG(INFO) << "STAGING Update : "
                 << fileId << "  " << state << "  " << error.String() << " " << jobId << " " << error.IsRecoverable() << commit;
     }
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "Gfal2ContextPool.h"
+
+#include <sstream>
+
+#include "common/Exceptions.h"
+#include "common/Logger.h"
+
+using namespace fts3::common;
+
+
+/// Options set by a task for its own use, that must not leak to the next one
+static const char *TASK_OPTIONS[][2] = {
+    {"SRM PLUGIN", "SPACETOKENDESC"}
+};
+
+
+Gfal2ContextPool& Gfal2ContextPool::instance()
+{
+    // Never destroyed, since tasks may still give their context back while the process exits
+    static Gfal2ContextPool *pool = new Gfal2ContextPool;
+    return *pool;
+}
+
+
+Gfal2ContextPool::Gfal2ContextPool(): idle(MAX_IDLE, &Gfal2ContextPool::reset, &gfal2_context_free)
+{
+}
+
+
+void Gfal2ContextPool::setInfosys(const std::string &infosys)
+{
+    boost::mutex::scoped_lock lock(mutex);
+    this->infosys = infosys;
+}
+
+
+gfal2_context_t Gfal2ContextPool::acquire(const std::string &operation, const std::string &credential)
+{
+    gfal2_context_t context = tryAcquire(credential);
+    if (!context) {
+        context = create(operation);
+    }
+    return context;
+}
+
+
+gfal2_context_t Gfal2ContextPool::tryAcquire(const std::string &credential)
+{
+    gfal2_context_t context = NULL;
+    idle.tryAcquire(credential, context);
+    return context;
+}
+
+
+void Gfal2ContextPool::release(gfal2_context_t context, const std::string &credential)
+{
+    idle.release(context, credential);
+}
+
+
+gfal2_context_t Gfal2ContextPool::create(const std::string &operation)
+{
+    std::string infosys;
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        infosys = this->infosys;
+    }
+
+    // Set up handle
+    GError *error = NULL;
+    gfal2_context_t gfal2_ctx = gfal2_context_new(&error);
+    if (!gfal2_ctx) {
+        std::stringstream ss;
+        ss << operation << " bad initialisation " << error->code << " " << error->message;
+        g_clear_error(&error);
+        // the memory was not allocated so it is safe to throw
+        throw UserError(ss.str());
+    }
+
+    try {
+        if (infosys == "false") {
+            gfal2_set_opt_boolean(gfal2_ctx, "BDII", "ENABLED", false, NULL);
+        }
+        else {
+            gfal2_set_opt_string(gfal2_ctx, "BDII", "LCG_GFAL_INFOSYS",
+                (char *) infosys.c_str(), NULL);
+        }
+
+        const char *protocols[] = {"rfio", "gsidcap", "dcap", "gsiftp"};
+
+        gfal2_set_opt_string_list(gfal2_ctx, "SRM PLUGIN", "TURL_PROTOCOLS", protocols, 4, &error);
+        if (error) {
+            std::stringstream ss;
+            ss << operation << " could not set the protocol list " << error->code << " "
+                << error->message;
+            g_clear_error(&error);
+            throw UserError(ss.str());
+        }
+
+        gfal2_set_opt_boolean(gfal2_ctx, "GRIDFTP PLUGIN", "SESSION_REUSE", true, &error);
+        if (error) {
+            std::stringstream ss;
+            ss << operation << " could not set the session reuse " << error->code << " "
+                << error->message;
+            g_clear_error(&error);
+            throw UserError(ss.str());
+        }
+    }
+    catch (...) {
+        gfal2_context_free(gfal2_ctx);
+        throw;
+    }
+
+    return gfal2_ctx;
+}
+
+
+bool Gfal2ContextPool::reset(gfal2_context_t context)
+{
+    for (size_t i = 0; i < sizeof(TASK_OPTIONS) / sizeof(TASK_OPTIONS[0]); ++i) {
+        GError *error = NULL;
+        gfal2_remove_opt(context, TASK_OPTIONS[i][0], TASK_OPTIONS[i][1], &error);
+        g_clear_error(&error);
+
+        // Removing an option that was never set fails too, so check what is left instead
+        gchar *value = gfal2_get_opt_string(context, TASK_OPTIONS[i][0], TASK_OPTIONS[i][1], &error);
+        g_clear_error(&error);
+        if (value) {
+            FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Could not clear " << TASK_OPTIONS[i][0] << ":" << TASK_OPTIONS[i][1]
+                << " from a gfal2 context, freeing it" << commit;
+            g_free(value);
+            return false;
+        }
+    }
+    return true;
+}
@@ -28,6 +28,8 @@
 
 #include "common/Exceptions.h"
 
+#include "Gfal2ContextPool.h"
+
 // forward declaration
 class JobContext;
 
@@ -59,11 +61,13 @@ public:
      */
     static void createPrototype(std::string const & infosys)
     {
-        Gfal2Task::infosys = infosys;
+        Gfal2ContextPool::instance().setInfosys(infosys);
     }
 
     /**
      * Sets the proxy-certificate for the given gfal2 task
+     * If the pool has a context already configured for it, this task switches to that one,
+     * so this must be called before any other setter
      *
      * @param ctx : job context containing proxy-certificate information
      */
@@ -82,51 +86,15 @@ protected:
      */
     struct Gfal2CtxWrapper
     {
-        /// Constructor
-        Gfal2CtxWrapper(std::string const & operation) : gfal2_ctx(0), operation(operation)
+        /// Constructor, borrows a context from the pool
+        Gfal2CtxWrapper(std::string const & operation) :
+            gfal2_ctx(Gfal2ContextPool::instance().acquire(operation, "")), operation(operation)
         {
-            // Set up handle
-            GError *error = NULL;
-            gfal2_ctx = gfal2_context_new(&error);
-            if (!gfal2_ctx) {
-                std::stringstream ss;
-                ss << operation << " bad initialisation " << error->code << " " << error->message;
-                g_clear_error(&error);
-                // the memory was not allocated so it is safe to throw
-                throw fts3::common::UserError(ss.str());
-            }
-
-            if (infosys == "false") {
-                gfal2_set_opt_boolean(gfal2_ctx, "BDII", "ENABLED", false, NULL);
-            }
-            else {
-                gfal2_set_opt_string(gfal2_ctx, "BDII", "LCG_GFAL_INFOSYS",
-                    (char *) infosys.c_str(), NULL);
-            }
-
-            const char *protocols[] = {"rfio", "gsidcap", "dcap", "gsiftp"};
-
-            gfal2_set_opt_string_list(gfal2_ctx, "SRM PLUGIN", "TURL_PROTOCOLS", protocols, 4, &error);
-            if (error) {
-                std::stringstream ss;
-                ss << operation << " could not set the protocol list " << error->code << " "
-                    << error->message;
-                g_clear_error(&error);
-                throw fts3::common::UserError(ss.str());
-            }
-
-            gfal2_set_opt_boolean(gfal2_ctx, "GRIDFTP PLUGIN", "SESSION_REUSE", true, &error);
-            if (error) {
-                std::stringstream ss;
-                ss << operation << " could not set the session reuse " << error->code << " "
-                    << error->message;
-                g_clear_error(&error);
-                throw fts3::common::UserError(ss.str());
-            }
         }
 
         /// Copy constructor, steals the pointer from the parameter!
-        Gfal2CtxWrapper(Gfal2CtxWrapper && copy) : gfal2_ctx(copy.gfal2_ctx), operation(copy.operation)
+        Gfal2CtxWrapper(Gfal2CtxWrapper && copy) : gfal2_ctx(copy.gfal2_ctx), operation(copy.operation),
+            credential(std::move(copy.credential))
         {
             copy.gfal2_ctx = 0;
         }
@@ -137,21 +105,28 @@ protected:
             return gfal2_ctx;
         }
 
-        /// Destructor
+        /// Gives the current context back to the pool, and takes over another one
+        void replace(gfal2_context_t other, std::string const & otherCredential)
+        {
+            if (gfal2_ctx) Gfal2ContextPool::instance().release(gfal2_ctx, credential);
+            gfal2_ctx = other;
+            credential = otherCredential;
+        }
+
+        /// Destructor, gives the context back to the pool
         ~Gfal2CtxWrapper()
         {
-            if(gfal2_ctx) gfal2_context_free(gfal2_ctx);
+            if(gfal2_ctx) Gfal2ContextPool::instance().release(gfal2_ctx, credential);
         }
 
         /// the gfal2 context itself
         gfal2_context_t gfal2_ctx;
         ///
         std::string const operation;
+        /// the proxy certificate the context is configured with
+        std::string credential;
     };
 
-    /// the infosys used to create all gfal2 contexts
-    static std::string infosys;
-
     /// the operation, e.g. 'DELETION', 'BRINGONLINE', etc.
     Gfal2CtxWrapper gfal2_ctx;
 };
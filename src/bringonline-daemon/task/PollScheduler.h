@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef POLLSCHEDULER_H_
+#define POLLSCHEDULER_H_
+
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/thread/mutex.hpp>
+
+#include "common/PollPlanner.h"
+
+/**
+ * Decides when the next poll of a staging request should happen.
+ *
+ * It keeps, for each storage endpoint, how long the requests that succeeded recently took,
+ * and lets fts3::common::PollPlanner space the polls from those.
+ * Endpoints without enough history use the interval given by the caller.
+ */
+class PollScheduler
+{
+public:
+
+    enum Operation {
+        STAGING = 0
+    };
+
+    /// Only the completions of the last day are taken into account
+    static constexpr time_t HISTORY_WINDOW = 86400;
+    /// How often to reload the completions from the database, in seconds
+    static constexpr time_t REFRESH_INTERVAL = 600;
+
+    /// Get the scheduler
+    static PollScheduler& instance();
+
+    /// Reload the durations from the database every REFRESH_INTERVAL
+    /// This is a thread! The workers never wait for the database
+    void run();
+
+    /**
+     * Decide when to poll next
+     *
+     * @param operation : only staging
+     * @param endpoint  : storage endpoint that will be polled
+     * @param started   : when the request was started
+     * @param fallback  : interval, in seconds, to use when there is no history for the endpoint
+     * @return          : the time of the next poll
+     */
+    time_t nextPoll(Operation operation, const std::string &endpoint, time_t started, time_t fallback);
+
+    /**
+     * Replace the durations of past requests
+     *
+     * @param operation : only staging
+     * @param durations : durations, in seconds, by storage endpoint
+     */
+    void setDurations(Operation operation, std::map<std::string, std::vector<time_t>> &&durations);
+
+private:
+    PollScheduler() {}
+
+    /// Reload the durations from the database
+    void refresh();
+
+    boost::mutex mutex;
+    /// sorted durations, by operation and endpoint
+    std::map<std::string, std::vector<time_t>> durations[1];
+    /// polls booked, by endpoint and second
+    fts3::common::PollPlanner planner;
+};
+
+#endif // POLLSCHEDULER_H_
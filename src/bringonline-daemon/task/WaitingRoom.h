@@ -22,9 +22,12 @@
 #ifndef WAITINGROOM_H_
 #define WAITINGROOM_H_
 
-#include <boost/ptr_container/ptr_list.hpp> // think about using a lockfree queue
+#include <memory>
+#include <vector>
+
 #include <boost/thread.hpp>
 
+#include "common/DeadlineQueue.h"
 #include "common/ThreadPool.h"
 
 #include "../task/Gfal2Task.h"
@@ -32,6 +35,9 @@
 
 /**
  * A waiting room for task that will be executed in a while
+ *
+ * Tasks are kept ordered by the time they are due (TASK::getWaitUntil),
+ * so the thread only wakes up when there is something to start
  */
 template<typename TASK, typename BASE = Gfal2Task>
 class WaitingRoom
@@ -51,8 +57,7 @@ public:
      */
     void add(TASK* task)
     {
-        boost::mutex::scoped_lock lock(m);
-        tasks.push_back(task);
+        tasks.push(task->getWaitUntil(), std::unique_ptr<TASK>(task));
     }
 
     /**
@@ -87,10 +92,11 @@ private:
      */
     WaitingRoom& operator=(WaitingRoom const &) = delete;
 
-    /// the queue with tasks that are waiting
-    boost::ptr_list<TASK> tasks;
-    /// the mutex preventing concurrent access
-    boost::mutex m;
+    /// Wake up at least this often, in seconds, even if nothing is due
+    static const time_t MAX_WAIT = 60;
+
+    /// the tasks that are waiting, ordered by due time
+    fts3::common::DeadlineQueue< std::unique_ptr<TASK> > tasks;
     /// the threadpool items are waiting for
     ThreadPool<BASE> * pool;
 };
@@ -102,24 +108,12 @@ void WaitingRoom<TASK, BASE>::run()
 
     while (!boost::this_thread::interruption_requested()) {
         try {
-            boost::this_thread::sleep(boost::posix_time::seconds(1));
-
-            // lock the mutex
-            boost::mutex::scoped_lock lock(this->m);
-            // get current time
-            time_t now = time(NULL);
-            // iterate over all all tasks
-            typename boost::ptr_list<TASK>::iterator it, next = this->tasks.begin();
-            while ((it = next) != this->tasks.end()) {
-                if (boost::this_thread::interruption_requested())
-                    return;
-                // next item to check
-                ++next;
-                // if the time has not yet come for the task simply continue
-                if (it->waiting(now))
-                    continue;
-                // otherwise start the task
-                this->pool->start(this->tasks.release(it).release());
+            // sleep until the earliest task is due
+            std::vector< std::unique_ptr<TASK> > due;
+            this->tasks.popExpired(due, MAX_WAIT);
+            // and start those that are
+            for (auto it = due.begin(); it != due.end(); ++it) {
+                this->pool->start(it->release());
             }
         }
         catch (const boost::thread_interrupted&) {
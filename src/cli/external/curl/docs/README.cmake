@@ -0,0 +1,16 @@
+                                  _   _ ____  _
+                              ___| | | |  _ \| |
+                             / __| | | | |_) | |
+                            | (__| |_| |  _ <| |___
+                             \___|\___/|_| \_\_____|
+
+README.cmake
+  Read the README file first.
+
+  Curl contains CMake build files that provide a way to build Curl with the
+  CMake build tool (www.cmake.org). CMake is a cross platform meta build tool
+  that generates native makefiles and IDE project files. The CMake build
+  system can be used to build Curl on any of its supported platforms.
+
+  Read the INSTALL.cmake file for instructions on how to compile curl with
+  CMake.
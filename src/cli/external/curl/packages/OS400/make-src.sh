@@ -0,0 +1,4 @@
+#!/bin/sh
+#
+#
+#       Not implemented yet on OS/400.
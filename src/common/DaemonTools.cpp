@@ -76,7 +76,18 @@ uid_t getGroupGid(const std::string& name)
 
 int countProcessesWithName(const std::string& name)
 {
-    int count = 0;
+    try {
+        return findProcessesWithName(name).size();
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+
+std::set<pid_t> findProcessesWithName(const std::string& name)
+{
+    std::set<pid_t> pids;
 
     try {
         fs::directory_iterator end_itr;
@@ -97,7 +108,7 @@ int countProcessesWithName(const std::string& name)
                 cmdlineStream.getline(cmdName, sizeof(cmdName), '\0');
 
                 if (boost::ends_with(cmdName, name)) {
-                    ++count;
+                    pids.insert(pid);
                 }
             }
             catch (...) {
@@ -105,11 +116,11 @@ int countProcessesWithName(const std::string& name)
             }
         }
     }
-    catch (...) {
-        return -1;
+    catch (const std::exception& e) {
+        throw SystemError(std::string("Could not list the running processes: ") + e.what());
     }
 
-    return count;
+    return pids;
 }
 
 
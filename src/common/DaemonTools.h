@@ -23,6 +23,7 @@
 #define DAEMONTOOLS_H_
 
 #include <sys/types.h>
+#include <set>
 #include <string>
 
 namespace fts3 {
@@ -40,6 +41,10 @@ gid_t getGroupGid(const std::string& name);
 /// @return < 0 on error, number of processes with the given name otherwise
 int countProcessesWithName(const std::string& name);
 
+/// Returns the pids of the processes with the given name
+/// Throws SystemError if /proc can not be read
+std::set<pid_t> findProcessesWithName(const std::string& name);
+
 /// Checks if there is a binary 'name' in the PATH, and it is executable
 /// @param fullPath Stores here the full path, if found.
 bool binaryExists(const std::string& name, std::string* fullPath);
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef DEADLINEQUEUE_H_
+#define DEADLINEQUEUE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <limits>
+#include <vector>
+
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/date_time/posix_time/conversion.hpp>
+
+namespace fts3
+{
+namespace common
+{
+
+/**
+ * Holds items until their deadline, and hands them out in deadline order.
+ *
+ * Any thread can push without locking: items go into a lock-free stack.
+ * A single consumer moves them into a min-heap keyed by deadline, and sleeps
+ * until the earliest deadline. A push only takes the lock, to wake the consumer up,
+ * when its deadline is earlier than the one the consumer is sleeping on.
+ */
+template <typename T>
+class DeadlineQueue
+{
+public:
+
+    DeadlineQueue(): incoming(NULL), sleepingUntil(NOT_SLEEPING), pending(0), sequence(0) {}
+
+    ~DeadlineQueue()
+    {
+        Node *node = incoming.exchange(NULL);
+        while (node) {
+            Node *next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    DeadlineQueue(const DeadlineQueue&) = delete;
+    DeadlineQueue& operator = (const DeadlineQueue&) = delete;
+
+    /**
+     * Queue an item. Can be called from any thread.
+     *
+     * @param deadline : the item is due at this time
+     * @param item     : the item
+     */
+    void push(time_t deadline, T item)
+    {
+        ++pending;
+
+        Node *node = new Node(deadline, std::move(item));
+        node->next = incoming.load(std::memory_order_relaxed);
+        while (!incoming.compare_exchange_weak(node->next, node)) {
+        }
+
+        // The consumer publishes its deadline before checking incoming (under the mutex),
+        // so either it sees this node, or this sees its deadline
+        if (deadline < sleepingUntil.load()) {
+            boost::mutex::scoped_lock lock(mutex);
+            wakeUp.notify_one();
+        }
+    }
+
+    /**
+     * Wait until some items are due, or for maxWait seconds, and move the due items into out.
+     * Only one thread can call this method. This is an interruption point.
+     *
+     * @param out     : the due items are appended, ordered by deadline
+     * @param maxWait : maximum time to sleep, in seconds
+     */
+    void popExpired(std::vector<T> &out, time_t maxWait)
+    {
+        collect();
+
+        time_t now = time(NULL);
+        if (heap.empty() || heap.front().deadline > now) {
+            time_t until = now + maxWait;
+            if (!heap.empty()) {
+                until = std::min(until, heap.front().deadline);
+            }
+
+            bool timedOut = false;
+            sleepingUntil.store(until);
+            try {
+                boost::mutex::scoped_lock lock(mutex);
+                if (!incoming.load()) {
+                    timedOut = !wakeUp.timed_wait(lock, boost::posix_time::from_time_t(until));
+                }
+            }
+            catch (...) {
+                sleepingUntil.store(NOT_SLEEPING);
+                throw;
+            }
+            sleepingUntil.store(NOT_SLEEPING);
+
+            collect();
+            now = time(NULL);
+            // time() may lag the clock used by the wait by a few milliseconds,
+            // which would make the caller spin until it catches up
+            if (timedOut) {
+                now = std::max(now, until);
+            }
+        }
+
+        while (!heap.empty() && heap.front().deadline <= now) {
+            std::pop_heap(heap.begin(), heap.end(), Later());
+            out.push_back(std::move(heap.back().item));
+            heap.pop_back();
+            --pending;
+        }
+    }
+
+    /// Number of items waiting
+    size_t size() const
+    {
+        return pending.load(std::memory_order_relaxed);
+    }
+
+    /// Remove all the items
+    /// Only the consumer thread can call this method
+    void clear()
+    {
+        collect();
+        pending -= heap.size();
+        heap.clear();
+    }
+
+private:
+
+    /// No wake up is needed while the consumer is not sleeping
+    static const time_t NOT_SLEEPING = std::numeric_limits<time_t>::min();
+
+    struct Node
+    {
+        Node(time_t deadline, T &&item): deadline(deadline), item(std::move(item)), next(NULL) {}
+
+        time_t deadline;
+        T item;
+        Node *next;
+    };
+
+    struct Entry
+    {
+        time_t deadline;
+        uint64_t sequence;
+        T item;
+    };
+
+    /// Heap order: earliest deadline first, and first pushed first among equal deadlines
+    struct Later
+    {
+        bool operator () (const Entry &a, const Entry &b) const
+        {
+            if (a.deadline != b.deadline)
+                return a.deadline > b.deadline;
+            return a.sequence > b.sequence;
+        }
+    };
+
+    /// Move the pushed items into the heap
+    void collect()
+    {
+        Node *node = incoming.exchange(NULL);
+
+        // The stack is in reverse order of push
+        Node *reversed = NULL;
+        while (node) {
+            Node *next = node->next;
+            node->next = reversed;
+            reversed = node;
+            node = next;
+        }
+
+        while (reversed) {
+            Node *next = reversed->next;
+            heap.push_back(Entry{reversed->deadline, sequence++, std::move(reversed->item)});
+            std::push_heap(heap.begin(), heap.end(), Later());
+            delete reversed;
+            reversed = next;
+        }
+    }
+
+    /// items pushed, but not yet in the heap
+    std::atomic<Node*> incoming;
+    /// deadline the consumer is sleeping on
+    std::atomic<time_t> sleepingUntil;
+    /// total number of items
+    std::atomic<size_t> pending;
+
+    /// owned by the consumer
+    std::vector<Entry> heap;
+    uint64_t sequence;
+
+    boost::mutex mutex;
+    boost::condition_variable wakeUp;
+};
+
+} // namespace common
+} // namespace fts3
+
+#endif // DEADLINEQUEUE_H_
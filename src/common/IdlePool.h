@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef IDLEPOOL_H_
+#define IDLEPOOL_H_
+
+#include <functional>
+#include <list>
+#include <string>
+
+#include <boost/thread/mutex.hpp>
+
+namespace fts3
+{
+namespace common
+{
+
+/**
+ * Keeps idle resources that are expensive to create, labelled by a key
+ * (i.e. the credential they were configured with), so they can be handed out again.
+ *
+ * A resource is reset when it is given back. If that fails, it is destroyed instead.
+ * Beyond maxIdle, the least recently released resource is destroyed.
+ */
+template <typename T>
+class IdlePool
+{
+public:
+
+    /**
+     * @param maxIdle : maximum number of idle resources kept
+     * @param reset   : clears what the previous user left on the resource. Returns false if it could not.
+     * @param destroy : frees a resource
+     */
+    IdlePool(size_t maxIdle, std::function<bool(T)> reset, std::function<void(T)> destroy):
+        maxIdle(maxIdle), reset(reset), destroy(destroy)
+    {
+    }
+
+    ~IdlePool()
+    {
+        for (auto i = idle.begin(); i != idle.end(); ++i) {
+            destroy(i->second);
+        }
+    }
+
+    IdlePool(const IdlePool&) = delete;
+    IdlePool& operator = (const IdlePool&) = delete;
+
+    /**
+     * Take the most recently released idle resource with the given key
+     *
+     * @return false if there is none
+     */
+    bool tryAcquire(const std::string &key, T &item)
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        for (auto i = idle.begin(); i != idle.end(); ++i) {
+            if (i->first == key) {
+                item = i->second;
+                idle.erase(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Give a resource back
+     *
+     * @param item : the resource
+     * @param key  : what the resource is configured for
+     */
+    void release(T item, const std::string &key)
+    {
+        if (!reset(item)) {
+            destroy(item);
+            return;
+        }
+
+        bool evicted = false;
+        T oldest;
+        {
+            boost::mutex::scoped_lock lock(mutex);
+            idle.emplace_front(key, item);
+            if (idle.size() > maxIdle) {
+                oldest = idle.back().second;
+                idle.pop_back();
+                evicted = true;
+            }
+        }
+
+        if (evicted) {
+            destroy(oldest);
+        }
+    }
+
+    /// Number of idle resources
+    size_t size()
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        return idle.size();
+    }
+
+private:
+    const size_t maxIdle;
+    std::function<bool(T)> reset;
+    std::function<void(T)> destroy;
+
+    boost::mutex mutex;
+    /// idle resources and their key, most recently released first
+    std::list<std::pair<std::string, T>> idle;
+};
+
+} // namespace common
+} // namespace fts3
+
+#endif // IDLEPOOL_H_
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <sstream>
+
+
+namespace fts3 {
+namespace common {
+
+
+LatencyHistogram::LatencyHistogram(): buckets(N_BUCKETS, 0), count(0), max(0)
+{
+}
+
+
+void LatencyHistogram::record(int64_t milliseconds)
+{
+    if (milliseconds < 0) {
+        milliseconds = 0;
+    }
+
+    // Bucket i holds (2^(i-1), 2^i]
+    unsigned bucket = 0;
+    while (bucket < N_BUCKETS - 1 && milliseconds > (int64_t(1) << bucket)) {
+        ++bucket;
+    }
+
+    ++buckets[bucket];
+    ++count;
+    if (milliseconds > max) {
+        max = milliseconds;
+    }
+}
+
+
+uint64_t LatencyHistogram::getCount() const
+{
+    return count;
+}
+
+
+int64_t LatencyHistogram::getMax() const
+{
+    return max;
+}
+
+
+int64_t LatencyHistogram::getPercentile(double percentile) const
+{
+    if (count == 0) {
+        return 0;
+    }
+
+    uint64_t threshold = static_cast<uint64_t>(count * percentile / 100.0);
+    if (threshold == 0) {
+        threshold = 1;
+    }
+
+    uint64_t accumulated = 0;
+    for (unsigned bucket = 0; bucket < N_BUCKETS - 1; ++bucket) {
+        accumulated += buckets[bucket];
+        if (accumulated >= threshold) {
+            return std::min(int64_t(1) << bucket, max);
+        }
+    }
+    return max;
+}
+
+
+std::string LatencyHistogram::summary() const
+{
+    std::ostringstream out;
+    out << "count=" << count
+        << " p50=" << getPercentile(50) << "ms"
+        << " p90=" << getPercentile(90) << "ms"
+        << " p99=" << getPercentile(99) << "ms"
+        << " max=" << max << "ms";
+    return out.str();
+}
+
+
+void LatencyHistogram::reset()
+{
+    std::fill(buckets.begin(), buckets.end(), 0);
+    count = 0;
+    max = 0;
+}
+
+} // end namespace common
+} // end namespace fts3
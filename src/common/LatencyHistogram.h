@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace fts3 {
+namespace common {
+
+/// Histogram of latencies, in milliseconds, with power of two buckets
+/// It is cheap enough to be fed on every message. It is not thread safe.
+class LatencyHistogram {
+public:
+    /// Number of buckets. The last one holds everything above 2^(N_BUCKETS - 2) ms
+    static const unsigned N_BUCKETS = 22;
+
+    LatencyHistogram();
+
+    /// Record one sample. Negative values (i.e. clock skew) are counted as 0.
+    void record(int64_t milliseconds);
+
+    /// Number of samples recorded
+    uint64_t getCount() const;
+
+    /// Highest sample recorded
+    int64_t getMax() const;
+
+    /// Upper bound, in milliseconds, of the bucket where the given percentile falls
+    /// @param percentile   Between 0 and 100
+    int64_t getPercentile(double percentile) const;
+
+    /// Human readable summary, suitable for the log
+    std::string summary() const;
+
+    /// Forget all the samples
+    void reset();
+
+private:
+    std::vector<uint64_t> buckets;
+    uint64_t count;
+    int64_t max;
+};
+
+} // end namespace common
+} // end namespace fts3
+
+#endif // LATENCYHISTOGRAM_H
@@ -23,27 +23,354 @@
 #include "Logger.h"
 #include "Exceptions.h"
 
+#include <atomic>
+#include <climits>
+#include <cstdlib>
 #include <fcntl.h>
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <sys/uio.h>
+#include <unistd.h>
 #include <boost/algorithm/string.hpp>
+#include <boost/thread.hpp>
 
 
 namespace fts3 {
 namespace common {
 
 
+/// Lines queued by a single thread.
+/// Only the owning thread pushes, and only the writer pops, so head and tail
+/// are enough to synchronize them.
+class LogBuffer {
+public:
+    LogBuffer(const AsyncLogWriter *owner, size_t capacity):
+        owner(owner), slots(capacity), head(0), tail(0)
+    {
+    }
+
+    /// Called by the owning thread
+    /// @return The number of lines queued after this one, or 0 if it is full
+    size_t push(std::string &line)
+    {
+        uint64_t h = head.load(std::memory_order_relaxed);
+        uint64_t t = tail.load(std::memory_order_acquire);
+        if (h - t >= slots.size()) {
+            return 0;
+        }
+        slots[h % slots.size()].swap(line);
+        head.store(h + 1, std::memory_order_release);
+        return h + 1 - t;
+    }
+
+    /// Called by the writer
+    /// Move up to max lines into out
+    size_t pop(std::vector<std::string> &out, size_t max)
+    {
+        uint64_t t = tail.load(std::memory_order_relaxed);
+        uint64_t h = head.load(std::memory_order_acquire);
+        size_t count = 0;
+        while (t != h && count < max) {
+            out.emplace_back();
+            out.back().swap(slots[t % slots.size()]);
+            ++t;
+            ++count;
+        }
+        tail.store(t, std::memory_order_release);
+        return count;
+    }
+
+    size_t capacity() const
+    {
+        return slots.size();
+    }
+
+    bool empty() const
+    {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    const AsyncLogWriter * const owner;
+
+private:
+    std::vector<std::string> slots;
+    alignas(64) std::atomic<uint64_t> head;
+    alignas(64) std::atomic<uint64_t> tail;
+};
+
+
+/// Background thread that writes the lines queued by the logging threads
+class AsyncLogWriter {
+public:
+    /// Maximum time a line can stay queued when the writer is idle
+    static const long WAKE_UP_INTERVAL_MS = 20;
+
+    AsyncLogWriter(): enabled(false), pushing(0), capacity(Logger::DEFAULT_ASYNC_CAPACITY),
+        fd(STDOUT_FILENO), fdOpen(false), dropped(0), droppedReported(0), running(false)
+    {
+    }
+
+    ~AsyncLogWriter()
+    {
+        stop();
+    }
+
+    void start(size_t newCapacity)
+    {
+        boost::mutex::scoped_lock lock(controlMutex);
+        capacity.store(std::max<size_t>(newCapacity, 1));
+        {
+            boost::mutex::scoped_lock writeLock(writeMutex);
+            if (!fdOpen) {
+                openLocked();
+            }
+        }
+        if (!writer.joinable()) {
+            running = true;
+            writer = boost::thread(&AsyncLogWriter::run, this);
+        }
+        enabled.store(true);
+    }
+
+    /// Once it returns, every line has been written, and new ones are refused
+    void stop()
+    {
+        boost::mutex::scoped_lock lock(controlMutex);
+        enabled.store(false);
+        // A push that saw the asynchronous mode enabled is queueing its line
+        while (pushing.load() > 0) {
+            boost::this_thread::yield();
+        }
+        if (writer.joinable()) {
+            {
+                boost::mutex::scoped_lock wakeUpLock(wakeUpMutex);
+                running = false;
+            }
+            wakeUp.notify_one();
+            writer.join();
+        }
+
+        boost::mutex::scoped_lock writeLock(writeMutex);
+        drainLocked();
+        closeLocked();
+    }
+
+    bool isEnabled() const
+    {
+        return enabled.load(std::memory_order_acquire);
+    }
+
+    /// Queue the line into the buffer of the calling thread
+    /// @return false if the asynchronous mode is disabled, and the caller must write the line
+    bool push(std::string &line)
+    {
+        // Either stop sees this push in progress and waits for it, or this sees the mode disabled
+        pushing.fetch_add(1);
+        if (!enabled.load()) {
+            pushing.fetch_sub(1);
+            return false;
+        }
+
+        static thread_local std::shared_ptr<LogBuffer> threadBuffer;
+        if (!threadBuffer || threadBuffer->owner != this || threadBuffer->capacity() != capacity.load()) {
+            threadBuffer = std::make_shared<LogBuffer>(this, capacity.load());
+            boost::mutex::scoped_lock lock(buffersMutex);
+            buffers.push_back(threadBuffer);
+        }
+
+        line += '\n';
+        size_t queued = threadBuffer->push(line);
+        if (queued == 0) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        // Do not wait for the timeout when the buffer is filling up
+        else if (queued == capacity.load(std::memory_order_relaxed) / 2) {
+            wakeUp.notify_one();
+        }
+        pushing.fetch_sub(1);
+        return true;
+    }
+
+    /// Write everything queued so far
+    void drain()
+    {
+        boost::mutex::scoped_lock lock(writeMutex);
+        drainLocked();
+    }
+
+    /// Replace the output. The previous one is closed once the lines queued
+    /// so far have been written into it. The file is only opened while the asynchronous mode is on.
+    void setPath(const std::string &newPath)
+    {
+        boost::mutex::scoped_lock lock(writeMutex);
+        drainLocked();
+        closeLocked();
+        path = newPath;
+        if (isEnabled()) {
+            openLocked();
+        }
+    }
+
+    uint64_t getDroppedCount() const
+    {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<bool> enabled;
+    std::atomic<int> pushing;
+    std::atomic<size_t> capacity;
+
+    boost::mutex buffersMutex;
+    std::vector<std::shared_ptr<LogBuffer>> buffers;
+
+    // Held while writing, so the output is not replaced in the middle
+    boost::mutex writeMutex;
+    std::string path;
+    int fd;
+    bool fdOpen;
+    std::vector<std::string> batch;
+    std::vector<struct iovec> iov;
+
+    std::atomic<uint64_t> dropped;
+    uint64_t droppedReported;
+
+    boost::mutex controlMutex;
+    boost::mutex wakeUpMutex;
+    boost::condition_variable wakeUp;
+    boost::thread writer;
+    bool running; // Protected by wakeUpMutex
+
+    void run()
+    {
+        while (isRunning()) {
+            drain();
+            reportDropped();
+
+            boost::mutex::scoped_lock lock(wakeUpMutex);
+            wakeUp.timed_wait(lock, boost::posix_time::milliseconds(WAKE_UP_INTERVAL_MS));
+        }
+    }
+
+    bool isRunning()
+    {
+        boost::mutex::scoped_lock lock(wakeUpMutex);
+        return running;
+    }
+
+    void reportDropped()
+    {
+        uint64_t total = dropped.load(std::memory_order_relaxed);
+        if (total != droppedReported) {
+            FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Dropped " << (total - droppedReported)
+                << " log lines because the logging threads were faster than the writer"
+                << commit;
+            droppedReported = total;
+        }
+    }
+
+    /// Open the output. Standard output if no file has been set.
+    /// As with the stream, if the file can not be opened, the lines are lost.
+    void openLocked()
+    {
+        if (path.empty()) {
+            fd = STDOUT_FILENO;
+        }
+        else {
+            fd = ::open(path.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+        }
+        fdOpen = true;
+    }
+
+    void closeLocked()
+    {
+        if (fd > STDOUT_FILENO) {
+            close(fd);
+        }
+        fd = STDOUT_FILENO;
+        fdOpen = false;
+    }
+
+    void drainLocked()
+    {
+        std::vector<std::shared_ptr<LogBuffer>> current;
+        {
+            boost::mutex::scoped_lock lock(buffersMutex);
+            // Forget the buffers of the threads that are gone, once they have been written
+            for (auto i = buffers.begin(); i != buffers.end();) {
+                if (i->use_count() == 1 && (*i)->empty()) {
+                    i = buffers.erase(i);
+                }
+                else {
+                    ++i;
+                }
+            }
+            current = buffers;
+        }
+
+        for (auto i = current.begin(); i != current.end(); ++i) {
+            while ((*i)->pop(batch, IOV_MAX - batch.size()) > 0) {
+                if (batch.size() >= IOV_MAX) {
+                    writeBatch();
+                }
+            }
+        }
+        writeBatch();
+    }
+
+    void writeBatch()
+    {
+        iov.resize(batch.size());
+        for (size_t i = 0; i < batch.size(); ++i) {
+            iov[i].iov_base = &batch[i][0];
+            iov[i].iov_len = batch[i].size();
+        }
+
+        size_t first = fd < 0 ? iov.size() : 0;
+        while (first < iov.size()) {
+            ssize_t written = writev(fd, &iov[first], iov.size() - first);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                // i.e. disk full. Same as the synchronous mode, these lines are lost.
+                break;
+            }
+            while (written > 0) {
+                if (size_t(written) >= iov[first].iov_len) {
+                    written -= iov[first].iov_len;
+                    ++first;
+                }
+                else {
+                    iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + written;
+                    iov[first].iov_len -= written;
+                    written = 0;
+                }
+            }
+        }
+
+        batch.clear();
+    }
+};
+
+const long AsyncLogWriter::WAKE_UP_INTERVAL_MS;
+
+
 Logger& theLogger()
 {
     static Logger *logger = new Logger();
     return *logger;
 }
 
-LoggerEntry::LoggerEntry(bool writeable): writeable(writeable)
+LoggerEntry::LoggerEntry(bool writeable, bool critical): writeable(writeable), critical(critical)
 {
 }
 
 
-LoggerEntry::LoggerEntry(const LoggerEntry& le): stream(le.stream.str()), writeable(le.writeable)
+LoggerEntry::LoggerEntry(const LoggerEntry& le): stream(le.stream.str()), writeable(le.writeable),
+    critical(le.critical)
 {
 }
 
@@ -87,7 +414,8 @@ Logger::LogLevel Logger::getLogLevel(const std::string& repr)
 }
 
 
-Logger::Logger(): _logLevel(DEBUG), _profiling(false), _separator("; "), _nCommits(0)
+Logger::Logger(): _logLevel(DEBUG), _profiling(false), _separator("; "), _nCommits(0),
+    asyncWriter(new AsyncLogWriter)
 {
     ostream = &std::cout;
     newLog(TRACE, __FILE__, __FUNCTION__, __LINE__) << "Logger created" << commit;
@@ -97,6 +425,7 @@ Logger::Logger(): _logLevel(DEBUG), _profiling(false), _separator("; "), _nCommi
 Logger::~Logger ()
 {
     newLog(TRACE, __FILE__, __FUNCTION__, __LINE__) << "Logger about to be destroyed" << commit;
+    delete asyncWriter;
 }
 
 
@@ -119,8 +448,52 @@ Logger & Logger::setProfiling(bool value)
 }
 
 
-void Logger::flush(const std::string &line)
+/// theLogger is never destroyed, so write what is left on the queues when the process exits
+static void stopAsyncAtExit()
+{
+    theLogger().setAsync(false);
+}
+
+
+Logger & Logger::setAsync(bool enabled, size_t capacity)
+{
+    if (enabled) {
+        static std::once_flag registerAtExit;
+        std::call_once(registerAtExit, []() { atexit(stopAsyncAtExit); });
+        asyncWriter->start(capacity);
+    }
+    else {
+        asyncWriter->stop();
+    }
+    newLog(INFO, __FILE__, __FUNCTION__, __LINE__)
+        << "Setting asynchronous logging to " << enabled
+        << commit;
+    return *this;
+}
+
+
+void Logger::drain(void)
 {
+    asyncWriter->drain();
+}
+
+
+uint64_t Logger::getDroppedCount(void) const
+{
+    return asyncWriter->getDroppedCount();
+}
+
+
+void Logger::flush(std::string line, bool critical)
+{
+    if (critical) {
+        // Keep the order, and do not risk losing it if the process is about to die
+        asyncWriter->drain();
+    }
+    else if (asyncWriter->push(line)) {
+        return;
+    }
+
     boost::mutex::scoped_lock lock(outMutex);
     _nCommits++;
     if (_nCommits >= NB_COMMITS_BEFORE_CHECK) {
@@ -135,8 +508,7 @@ void Logger::flush(const std::string &line)
 void LoggerEntry::_commit()
 {
     if (writeable) {
-        std::string line = stream.str();
-        theLogger().flush(line);
+        theLogger().flush(stream.str(), critical);
     }
 }
 
@@ -144,13 +516,11 @@ void LoggerEntry::_commit()
 LoggerEntry Logger::newLog(LogLevel level, const char* aFile,
         const char* aFunc, const int aLineNo)
 {
-    bool can_write;
-    if (level == PROF) {
-        can_write = this->_profiling;
-    } else {
-        can_write = (level >= this->_logLevel);
+    bool can_write = isLogOn(level);
+    LoggerEntry entry(can_write, level == CRIT);
+    if (!can_write) {
+        return entry;
     }
-    LoggerEntry entry(can_write);
     entry << logLevelStringRepresentation(level) << timestamp() << _separator;
     if (level >= ERR && this->_logLevel <= DEBUG) {
         entry << aFile << _separator << aFunc << _separator << std::dec << aLineNo << _separator;
@@ -174,10 +544,16 @@ static int createAndReopen(const std::string& path, FILE* stream)
 
 int Logger::redirect(const std::string& outPath, const std::string& errPath) throw()
 {
-    if (ostream != &std::cout) {
-        delete ostream;
+    // The lines queued until now go to the previous file
+    asyncWriter->setPath(outPath);
+
+    {
+        boost::mutex::scoped_lock lock(outMutex);
+        if (ostream != &std::cout) {
+            delete ostream;
+        }
+        ostream = new std::ofstream(outPath, std::ios_base::app);
     }
-    ostream = new std::ofstream(outPath, std::ios_base::app);
 
     if (!errPath.empty()) {
         if (createAndReopen(errPath, stderr) < 0)
@@ -197,14 +573,19 @@ void Logger::checkFd(void)
 
 std::string Logger::timestamp()
 {
-    char timebuf[128] = "";
+    // Most lines share the second with the previous one, so reuse the formatted string
+    static thread_local time_t cached = -1;
+    static thread_local char timebuf[128] = "";
     // Get Current Time
     time_t current;
     time(&current);
-    struct tm local_tm;
-    localtime_r(&current, &local_tm);
-    // asctime format
-    strftime(timebuf, sizeof(timebuf), "%a, %d %b %Y %H:%M:%S %z", &local_tm);
+    if (current != cached) {
+        struct tm local_tm;
+        localtime_r(&current, &local_tm);
+        // asctime format
+        strftime(timebuf, sizeof(timebuf), "%a, %d %b %Y %H:%M:%S %z", &local_tm);
+        cached = current;
+    }
     return timebuf;
 }
 
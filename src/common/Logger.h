@@ -24,6 +24,7 @@
 #ifndef LOGGER_H_
 #define LOGGER_H_
 
+#include <cstdint>
 #include <iostream>
 #include <boost/thread/mutex.hpp>
 
@@ -32,6 +33,7 @@ namespace fts3 {
 namespace common {
 
 class Logger;
+class AsyncLogWriter;
 
 // Logger entry
 class LoggerEntry {
@@ -41,8 +43,9 @@ private:
 
     std::stringstream stream;
     bool writeable;
+    bool critical;
 
-    LoggerEntry(bool writeable);
+    LoggerEntry(bool writeable, bool critical = false);
     LoggerEntry(const LoggerEntry& le);
 
     /// Commits (writes) the actual log line.
@@ -104,6 +107,15 @@ public:
     /// Set Profiling Logs On/Off
     Logger& setProfiling(bool value);
 
+    /// True if messages with the given level are to be written
+    bool isLogOn(LogLevel level) const
+    {
+        if (level == PROF) {
+            return _profiling;
+        }
+        return level >= _logLevel;
+    }
+
     /// Start a new log message. But this is not the recommended way,
     /// use FTS3_COMMON_LOGGER_NEWLOG. It calls this method, but adds
     /// proper debug information. The integer LOGLEVEL template parameter
@@ -117,6 +129,25 @@ public:
     /// Return 0 on success
     int redirect(const std::string& stdout, const std::string& stderr) throw();
 
+    /// Default number of lines each thread can queue in asynchronous mode
+    static const size_t DEFAULT_ASYNC_CAPACITY = 8192;
+
+    /// Write the log lines from a background thread, instead of from the logging one.
+    /// Each thread queues its lines into its own buffer, without locking, and the writer
+    /// drains them in batches with writev. If the buffer of a thread is full, its lines are
+    /// dropped and counted.
+    /// Lines from different threads may be written out of order, but keep their timestamps.
+    /// CRIT lines are still written synchronously, after whatever was queued.
+    /// @param enabled  When false, the queued lines are written, and the writer stops
+    /// @param capacity Lines each thread can queue
+    Logger& setAsync(bool enabled, size_t capacity = DEFAULT_ASYNC_CAPACITY);
+
+    /// Write all the lines queued so far, and wait for them to be written
+    void drain(void);
+
+    /// Number of lines dropped because the buffer of the logging thread was full
+    uint64_t getDroppedCount(void) const;
+
 private:
     friend class LoggerEntry;
 
@@ -137,7 +168,10 @@ private:
     static const unsigned NB_COMMITS_BEFORE_CHECK = 1000;
     unsigned _nCommits;
 
-    void flush(const std::string &line);
+    /// Asynchronous writer. Owns the file descriptor of the output.
+    AsyncLogWriter *asyncWriter;
+
+    void flush(std::string line, bool critical);
 
     /// String representation of the timestamp
     static std::string timestamp();
@@ -156,6 +190,13 @@ private:
 LoggerEntry& commit(LoggerEntry& entry);
 
 
+/// Turns a log statement into a void expression, so it can be the branch of a conditional.
+/// operator & binds looser than operator <<, so the whole statement is on the right.
+struct LoggerVoidify {
+    void operator & (const LoggerEntry&) {}
+};
+
+
 /// Singleton access of logger.
 Logger& theLogger();
 
@@ -170,9 +211,24 @@ Logger& theLogger();
 ///
 /// The log level labels are system specific,
 ///
+/// If the level is disabled, nothing is constructed, and the arguments are not evaluated.
+/// Levels below FTS3_COMMON_LOGGER_MIN_LEVEL are removed at compile time, except PROF.
+///
 #define FTS3_COMMON_LOGGER_NEWLOG(aLevel)   \
+    !FTS3_COMMON_LOGGER_COMPILED_IN(aLevel) || \
+    !fts3::common::theLogger().isLogOn(fts3::common::Logger::aLevel) ? (void)0 : \
+    fts3::common::LoggerVoidify() & \
     fts3::common::theLogger().newLog(fts3::common::Logger::aLevel, __FILE__, __FUNCTION__, __LINE__)
 
+#ifndef FTS3_COMMON_LOGGER_MIN_LEVEL
+#define FTS3_COMMON_LOGGER_MIN_LEVEL TRACE
+#endif
+
+/// Constant expression, so the compiler drops the statement altogether when false
+#define FTS3_COMMON_LOGGER_COMPILED_IN(aLevel) \
+    (fts3::common::Logger::aLevel >= fts3::common::Logger::FTS3_COMMON_LOGGER_MIN_LEVEL || \
+     fts3::common::Logger::aLevel == fts3::common::Logger::PROF)
+
 /// Log a simple string message in one line (with implicit commit). Parameters:
 /// log level label and the message string.
 #define FTS3_COMMON_LOGGER_LOG(level,message) \
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "PollPlanner.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace fts3 {
+namespace common {
+
+
+time_t PollPlanner::getInterval(const std::vector<time_t> &durations, time_t elapsed, time_t fallback)
+{
+    if (durations.size() < MIN_SAMPLES) {
+        return fallback;
+    }
+
+    // Past all the durations seen, there is nothing to learn from
+    auto completed = std::upper_bound(durations.begin(), durations.end(), elapsed);
+    size_t remaining = durations.end() - completed;
+    if (remaining == 0) {
+        return fallback;
+    }
+
+    // Rate at which the requests still running at this age complete,
+    // estimated from how long it took for the next few of them
+    size_t window = std::max<size_t>(durations.size() * HAZARD_WINDOW / 100, 5);
+    window = std::min(window, remaining);
+    double span = double(*(completed + (window - 1)) - elapsed) + 1;
+    double hazard = double(window) / (double(remaining) * span);
+
+    // This spacing minimizes the delay noticing the completion plus the cost of the polls
+    time_t interval = time_t(sqrt(2 * POLL_COST / hazard));
+    if (interval < MIN_INTERVAL) {
+        return MIN_INTERVAL;
+    }
+    if (interval > MAX_INTERVAL) {
+        return MAX_INTERVAL;
+    }
+    return interval;
+}
+
+
+time_t PollPlanner::reserve(const std::string &endpoint, time_t when, time_t now, int rateLimit)
+{
+    std::map<time_t, int> &seconds = booked[endpoint];
+
+    // Forget the polls that already happened
+    seconds.erase(seconds.begin(), seconds.lower_bound(now));
+
+    // Move to the first second that is not full yet
+    if (rateLimit > 0) {
+        for (auto i = seconds.lower_bound(when); i != seconds.end() && i->first == when && i->second >= rateLimit; ++i) {
+            ++when;
+        }
+    }
+
+    ++seconds[when];
+    return when;
+}
+
+} // end namespace common
+} // end namespace fts3
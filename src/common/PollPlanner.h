@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef POLLPLANNER_H
+#define POLLPLANNER_H
+
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace fts3 {
+namespace common {
+
+/// Spacing of the polls of long asynchronous requests, such as staging and archiving.
+///
+/// From how long the past requests of an endpoint took, it estimates how likely a request
+/// of a given age is to complete soon, and spaces the polls accordingly:
+/// sparse while a completion is unlikely, dense around the usual duration.
+/// On top of that, the number of polls booked for the same endpoint and second can be capped.
+/// It is not thread safe.
+class PollPlanner {
+public:
+    /// Endpoints with fewer completions than this use the fallback interval
+    static constexpr size_t MIN_SAMPLES = 20;
+    /// Percentage of the history used to estimate the completion rate at a given age
+    static constexpr size_t HAZARD_WINDOW = 5;
+    /// A poll is worth this many seconds of delay noticing a completion
+    static constexpr int POLL_COST = 15;
+    /// Bounds of the learned interval, in seconds
+    static constexpr time_t MIN_INTERVAL = 5;
+    static constexpr time_t MAX_INTERVAL = 600;
+
+    /**
+     * Interval until the next poll, given the durations of past requests
+     *
+     * @param durations : durations of past requests, sorted
+     * @param elapsed   : age of the request being polled
+     * @param fallback  : returned if there is not enough history to decide
+     */
+    static time_t getInterval(const std::vector<time_t> &durations, time_t elapsed, time_t fallback);
+
+    /**
+     * Find the first second, from when on, with room for a poll to endpoint, and book it
+     *
+     * @param endpoint  : endpoint that will be polled
+     * @param when      : preferred time of the poll
+     * @param now       : bookings before this are forgotten
+     * @param rateLimit : maximum polls per endpoint and second. 0 or less means no limit.
+     * @return          : the time booked
+     */
+    time_t reserve(const std::string &endpoint, time_t when, time_t now, int rateLimit);
+
+private:
+    /// number of polls booked, by endpoint and second
+    std::map<std::string, std::map<time_t, int>> booked;
+};
+
+} // end namespace common
+} // end namespace fts3
+
+#endif // POLLPLANNER_H
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "SymbolTable.h"
+#include "Exceptions.h"
+
+
+namespace fts3 {
+namespace common {
+
+
+SymbolTable::SymbolTable(): count(0)
+{
+    for (size_t i = 0; i < MAX_CHUNKS; ++i) {
+        chunks[i].store(NULL, std::memory_order_relaxed);
+    }
+    intern("");
+}
+
+
+SymbolTable::~SymbolTable()
+{
+    for (size_t i = 0; i < MAX_CHUNKS; ++i) {
+        delete [] chunks[i].load(std::memory_order_relaxed);
+    }
+}
+
+
+Symbol SymbolTable::intern(std::string_view name)
+{
+    {
+        boost::shared_lock<boost::shared_mutex> lock(mutex);
+        auto i = index.find(name);
+        if (i != index.end()) {
+            return i->second;
+        }
+    }
+
+    boost::unique_lock<boost::shared_mutex> lock(mutex);
+    auto i = index.find(name);
+    if (i != index.end()) {
+        return i->second;
+    }
+
+    size_t symbol = count.load(std::memory_order_relaxed);
+    size_t chunk = symbol / CHUNK_SIZE;
+    if (chunk >= MAX_CHUNKS) {
+        throw SystemError("Too many symbols");
+    }
+    std::string *names = chunks[chunk].load(std::memory_order_relaxed);
+    if (!names) {
+        names = new std::string[CHUNK_SIZE];
+        chunks[chunk].store(names, std::memory_order_release);
+    }
+
+    std::string &stored = names[symbol % CHUNK_SIZE];
+    stored.assign(name.data(), name.size());
+    index.emplace(stored, static_cast<Symbol>(symbol));
+    count.store(symbol + 1, std::memory_order_release);
+
+    return static_cast<Symbol>(symbol);
+}
+
+
+bool SymbolTable::find(std::string_view name, Symbol &symbol) const
+{
+    boost::shared_lock<boost::shared_mutex> lock(mutex);
+    auto i = index.find(name);
+    if (i == index.end()) {
+        return false;
+    }
+    symbol = i->second;
+    return true;
+}
+
+
+SymbolTable& SymbolTable::storages()
+{
+    static SymbolTable *table = new SymbolTable();
+    return *table;
+}
+
+
+SymbolTable& SymbolTable::vos()
+{
+    static SymbolTable *table = new SymbolTable();
+    return *table;
+}
+
+} // namespace common
+} // namespace fts3
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef SYMBOLTABLE_H_
+#define SYMBOLTABLE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <boost/thread/shared_mutex.hpp>
+
+
+namespace fts3 {
+namespace common {
+
+/// Dense identifier of an interned string
+typedef uint32_t Symbol;
+
+/// Maps strings (i.e. storage or VO names) to dense integers, so hot paths can compare
+/// and index by integer instead of by string.
+/// Symbols are never released, so the table only fits bounded sets of names.
+/// The empty string is always Symbol 0.
+class SymbolTable
+{
+public:
+    SymbolTable();
+    ~SymbolTable();
+
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator = (const SymbolTable&) = delete;
+
+    /// Return the symbol for name, registering it if it is new
+    Symbol intern(std::string_view name);
+
+    /// Return the symbol for name, without registering it
+    /// @return false if name has not been interned
+    bool find(std::string_view name, Symbol &symbol) const;
+
+    /// Return the name of a symbol returned by intern. Does not lock.
+    const std::string& name(Symbol symbol) const
+    {
+        return chunks[symbol / CHUNK_SIZE].load(std::memory_order_acquire)[symbol % CHUNK_SIZE];
+    }
+
+    /// Number of symbols. All symbols are below this value, so it can be used to size arrays.
+    size_t size() const
+    {
+        return count.load(std::memory_order_acquire);
+    }
+
+    /// Table for storage names
+    static SymbolTable& storages();
+
+    /// Table for VO names
+    static SymbolTable& vos();
+
+private:
+    static const size_t CHUNK_SIZE = 4096;
+    static const size_t MAX_CHUNKS = 1024;
+
+    // Names are stored in chunks that never move, so name() can read them without locking,
+    // and the index can point to them
+    std::atomic<std::string*> chunks[MAX_CHUNKS];
+    std::atomic<size_t> count;
+
+    mutable boost::shared_mutex mutex;
+    std::unordered_map<std::string_view, Symbol> index;
+};
+
+} // namespace common
+} // namespace fts3
+
+#endif // SYMBOLTABLE_H_
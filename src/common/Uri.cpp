@@ -20,60 +20,129 @@
 
 #include "Uri.h"
 
+#include <cctype>
+#include <climits>
 #include <glib.h>
 #include <netdb.h>
 #include <sys/param.h>
 #include <unistd.h>
-#include <boost/regex.hpp>
 
 
 namespace fts3 {
 namespace common {
 
 
-// From http://www.ietf.org/rfc/rfc2396.txt
-// Appendix B
-#define URI_REGEX "^(([^:/?#]+):)?(//([^/?#]*))?([^?#]*)(\\?([^#]*))?(#(.*))?"
+/// Same as atoi, which used to extract the port
+static unsigned parsePort(std::string_view str)
+{
+    size_t i = 0;
+    while (i < str.size() && isspace(static_cast<unsigned char>(str[i]))) {
+        ++i;
+    }
 
-static boost::regex uri_regex(URI_REGEX);
+    bool negative = false;
+    if (i < str.size() && (str[i] == '+' || str[i] == '-')) {
+        negative = (str[i] == '-');
+        ++i;
+    }
 
+    // strtol saturates, and atoi truncates the result into an int
+    const unsigned long limit = negative ? -static_cast<unsigned long>(LONG_MIN) : LONG_MAX;
+    unsigned long value = 0;
+    for (; i < str.size() && str[i] >= '0' && str[i] <= '9'; ++i) {
+        unsigned digit = str[i] - '0';
+        if (value > (limit - digit) / 10) {
+            value = limit;
+        }
+        else {
+            value = value * 10 + digit;
+        }
+    }
 
-static void extractPort(Uri& u0)
+    long result = negative ? static_cast<long>(0 - value) : static_cast<long>(value);
+    return static_cast<unsigned>(static_cast<int>(result));
+}
+
+
+/// The port is part of the host, so split it
+static void extractPort(UriView &u0)
 {
     size_t bracket_close_i = u0.host.rfind(']'); // Account for IPv6 in the host name
     size_t colon_i = u0.host.rfind(':');
 
     // No port
-    if (colon_i == std::string::npos)
+    if (colon_i == std::string_view::npos)
         return;
 
     // IPv6 without port
-    if (bracket_close_i != std::string::npos && bracket_close_i > colon_i)
+    if (bracket_close_i != std::string_view::npos && bracket_close_i > colon_i)
         return;
 
-    std::string port_str = u0.host.substr(colon_i + 1);
+    u0.port = parsePort(u0.host.substr(colon_i + 1));
     u0.host = u0.host.substr(0, colon_i);
-    u0.port = atoi(port_str.c_str());
 }
 
 
-Uri Uri::parse(const std::string &uri)
+// From http://www.ietf.org/rfc/rfc2396.txt
+// Appendix B
+// ^(([^:/?#]+):)?(//([^/?#]*))?([^?#]*)(\?([^#]*))?(#(.*))?
+UriView UriView::parse(std::string_view uri)
 {
-    Uri u0;
-    u0.fullUri = uri;
+    UriView u0;
+    size_t pos = 0;
+
+    // Scheme, only if followed by ':' before any of '/?#'
+    size_t end = uri.find_first_of(":/?#");
+    if (end != std::string_view::npos && end > 0 && uri[end] == ':') {
+        u0.protocol = uri.substr(0, end);
+        pos = end + 1;
+    }
 
-    boost::smatch matches;
-    if (boost::regex_match(uri, matches, uri_regex, boost::match_posix)) {
-        u0.protocol = matches[2];
-        u0.host = matches[4];
-        u0.path = matches[5];
-        u0.queryString = matches[7];
+    // Authority
+    if (uri.compare(pos, 2, "//") == 0) {
+        pos += 2;
+        end = uri.find_first_of("/?#", pos);
+        if (end == std::string_view::npos) {
+            end = uri.size();
+        }
+        u0.host = uri.substr(pos, end - pos);
+        pos = end;
+    }
 
-        // port is put into host, so extract it
-        u0.port = 0;
-        extractPort(u0);
+    // Path
+    end = uri.find_first_of("?#", pos);
+    if (end == std::string_view::npos) {
+        end = uri.size();
+    }
+    u0.path = uri.substr(pos, end - pos);
+    pos = end;
+
+    // Query, the fragment is ignored
+    if (pos < uri.size() && uri[pos] == '?') {
+        ++pos;
+        end = uri.find('#', pos);
+        if (end == std::string_view::npos) {
+            end = uri.size();
+        }
+        u0.queryString = uri.substr(pos, end - pos);
     }
 
+    extractPort(u0);
+    return u0;
+}
+
+
+Uri Uri::parse(const std::string &uri)
+{
+    UriView view = UriView::parse(uri);
+
+    Uri u0;
+    u0.fullUri = uri;
+    u0.protocol = view.protocol;
+    u0.host = view.host;
+    u0.path = view.path;
+    u0.queryString = view.queryString;
+    u0.port = view.port;
     return u0;
 }
 
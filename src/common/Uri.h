@@ -23,10 +23,32 @@
 #define URI_H_
 
 #include <string>
+#include <string_view>
 
 namespace fts3 {
 namespace common {
 
+/// Same split as Uri, but pointing into the parsed string, so nothing is copied
+/// The components are only valid for as long as the parsed string is
+struct UriView
+{
+    std::string_view queryString, path, protocol, host;
+    unsigned port;
+
+    UriView(): port(0) {}
+
+    std::string getSeName(void) const
+    {
+        std::string seName;
+        seName.reserve(protocol.size() + 3 + host.size());
+        seName.append(protocol).append("://").append(host);
+        return seName;
+    }
+
+    /// Single pass split following RFC 3986, Appendix B. Does not allocate.
+    static UriView parse(std::string_view uri);
+};
+
 /// Hold a Uri, splitted in relevant parts
 class Uri
 {
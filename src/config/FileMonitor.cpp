@@ -19,7 +19,15 @@
  */
 
 #include "FileMonitor.h"
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
 #include <sys/stat.h>
+#include <unistd.h>
+#include <boost/filesystem/path.hpp>
+#include "common/Exceptions.h"
 #include "common/Logger.h"
 #include "ServerConfig.h"
 
@@ -27,7 +35,7 @@ using namespace fts3::common;
 using namespace fts3::config;
 
 
-FileMonitor::FileMonitor(ServerConfig* sc) : sc(sc), timestamp(0)
+FileMonitor::FileMonitor(ServerConfig* sc) : sc(sc), timestamp(0), inotifyFd(-1), stopFd(-1)
 {
     FTS3_COMMON_LOGGER_NEWLOG(TRACE) << "FileMonitor created" << commit;
 }
@@ -55,6 +63,25 @@ void FileMonitor::start(std::string path)
     else
         timestamp = time(NULL);
 
+    // Watch the directory, since the file may be replaced instead of written
+    boost::filesystem::path parent = boost::filesystem::path(path).parent_path();
+    if (parent.empty()) {
+        parent = ".";
+    }
+
+    inotifyFd = inotify_init1(IN_CLOEXEC);
+    stopFd = eventfd(0, EFD_CLOEXEC);
+    if (inotifyFd < 0 || stopFd < 0 ||
+        inotify_add_watch(inotifyFd, parent.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_MODIFY) < 0) {
+        FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Could not watch " << parent.string()
+            << " (" << strerror(errno) << "), falling back to polling the configuration file"
+            << commit;
+        if (inotifyFd >= 0) {
+            close(inotifyFd);
+            inotifyFd = -1;
+        }
+    }
+
     // start monitoring thread
     monitor_thread.reset (
         new boost::thread(run, this)
@@ -66,30 +93,40 @@ void FileMonitor::stop()
 {
     if (monitor_thread.get()) {
         monitor_thread->interrupt();
+        if (stopFd >= 0) {
+            uint64_t one = 1;
+            if (write(stopFd, &one, sizeof(one)) < 0) {
+                // The thread will not wake up, but there is nothing else to do
+            }
+        }
         monitor_thread->join();
         monitor_thread.reset(NULL);
     }
+    if (inotifyFd >= 0) {
+        close(inotifyFd);
+        inotifyFd = -1;
+    }
+    if (stopFd >= 0) {
+        close(stopFd);
+        stopFd = -1;
+    }
 }
 
 
-void FileMonitor::run(FileMonitor *const me)
+void FileMonitor::reload()
 {
-    struct stat st;
+    sc->read(0, 0);
+}
 
+
+void FileMonitor::run(FileMonitor *const me)
+{
     try {
-        while (!boost::this_thread::interruption_requested()) {
-            // we will check the timestamp periodically every minute
-            boost::this_thread::sleep(boost::posix_time::seconds(60));
-            // check the timestamp
-            if (stat(me->path.c_str(), &st) == 0) {
-                time_t new_timestamp = st.st_mtime;
-                // compare with the old one
-                if (new_timestamp != me->timestamp) {
-                    // if the file has been changed reload the configuration
-                    me->timestamp = new_timestamp;
-                    me->sc->read(0, 0);
-                }
-            }
+        if (me->inotifyFd >= 0) {
+            me->runInotify();
+        }
+        else {
+            me->runPolling();
         }
     }
     catch (const boost::thread_interrupted&) {
@@ -102,3 +139,86 @@ void FileMonitor::run(FileMonitor *const me)
         FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "FileMonitor thread exited with unknwon error" << commit;
     }
 }
+
+
+void FileMonitor::runInotify()
+{
+    const std::string fileName = boost::filesystem::path(path).filename().string();
+
+    struct pollfd fds[2];
+    fds[0].fd = inotifyFd;
+    fds[0].events = POLLIN;
+    fds[1].fd = stopFd;
+    fds[1].events = POLLIN;
+
+    // Events are aligned to struct inotify_event
+    alignas(struct inotify_event) char buffer[4096];
+    bool pending = false;
+
+    while (true) {
+        int ready = poll(fds, 2, pending ? DEBOUNCE_MS : -1);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw SystemError(std::string("poll failed: ") + strerror(errno));
+        }
+
+        if (fds[1].revents) {
+            return;
+        }
+
+        // Nothing else happened since the last change
+        if (ready == 0) {
+            pending = false;
+            FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Configuration file " << path << " changed, reloading" << commit;
+            try {
+                reload();
+            }
+            catch (const std::exception &e) {
+                FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Could not reload the configuration: " << e.what() << commit;
+            }
+            continue;
+        }
+
+        ssize_t length = read(inotifyFd, buffer, sizeof(buffer));
+        if (length < 0) {
+            if (errno == EINTR || errno == EAGAIN) {
+                continue;
+            }
+            throw SystemError(std::string("read from inotify failed: ") + strerror(errno));
+        }
+
+        for (char *ptr = buffer; ptr < buffer + length;) {
+            const struct inotify_event *event = reinterpret_cast<const struct inotify_event*>(ptr);
+            if (event->mask & IN_Q_OVERFLOW) {
+                pending = true;
+            }
+            else if (event->len > 0 && fileName == event->name) {
+                pending = true;
+            }
+            ptr += sizeof(struct inotify_event) + event->len;
+        }
+    }
+}
+
+
+void FileMonitor::runPolling()
+{
+    struct stat st;
+
+    while (!boost::this_thread::interruption_requested()) {
+        // we will check the timestamp periodically every minute
+        boost::this_thread::sleep(boost::posix_time::seconds(60));
+        // check the timestamp
+        if (stat(path.c_str(), &st) == 0) {
+            time_t new_timestamp = st.st_mtime;
+            // compare with the old one
+            if (new_timestamp != timestamp) {
+                // if the file has been changed reload the configuration
+                timestamp = new_timestamp;
+                reload();
+            }
+        }
+    }
+}
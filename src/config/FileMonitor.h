@@ -32,12 +32,18 @@ class ServerConfig;
 
 /**
  * This class monitors in a background thread if the FTS3 configuration file
- * has been modified. If it has, it triggers a reload of the configuration
+ * has been modified. If it has, it triggers a reload of the configuration.
+ * Changes are notified by inotify, on the directory, so files replaced by a rename are
+ * seen too. If inotify is not available, the file is polled once a minute.
  */
 class FileMonitor
 {
 
 public:
+    /// Wait for this long without changes before reloading, so whoever
+    /// is writing the file has time to finish
+    static const int DEBOUNCE_MS = 500;
+
     FileMonitor(ServerConfig* sc);
     virtual ~FileMonitor();
 
@@ -46,11 +52,21 @@ public:
 
     static void run (FileMonitor* const me);
 
+protected:
+    /// Called from the monitor thread when the file has changed
+    virtual void reload();
+
 private:
     ServerConfig* sc;
     std::string path;
     std::unique_ptr<boost::thread> monitor_thread;
     time_t timestamp;
+
+    int inotifyFd;
+    int stopFd;
+
+    void runInotify();
+    void runPolling();
 };
 
 } // end namespace config
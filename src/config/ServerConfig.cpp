@@ -20,6 +20,9 @@
 
 /** \file serverconfig.cpp Implementation of FTS3 server configuration. */
 
+#include <algorithm>
+#include <boost/algorithm/string/join.hpp>
+#include <boost/lexical_cast/try_lexical_convert.hpp>
 #include <boost/program_options.hpp>
 
 #include "common/Exceptions.h"
@@ -31,8 +34,49 @@ using namespace fts3::config;
 using namespace fts3::common;
 
 
-ServerConfig::ServerConfig() : cfgmonitor (this), reading(0), getting(0),
-    readTime(0)
+/// Source of ServerConfig::version
+static std::atomic<uint64_t> lastVersion(0);
+
+
+ConfigValue::ConfigValue(const std::string& str): str(str), boolean(true),
+    isInt(false), integer(0), isDouble(false), real(0)
+{
+    // if the string is 'false' return false
+    // otherwise return true (it may be 'true' or other string containing respective value)
+    std::string lower = boost::to_lower_copy(str);
+    boolean = !(lower == "false" || lower == "0");
+
+    isInt = boost::conversion::try_lexical_convert(str, integer);
+    isDouble = boost::conversion::try_lexical_convert(str, real);
+
+    boost::char_separator<char> sep(";");
+    boost::tokenizer< boost::char_separator<char> > tokens(str, sep);
+    list.assign(tokens.begin(), tokens.end());
+}
+
+
+ConfigSnapshot::ConfigSnapshot(const std::map<std::string, std::string>& vars, time_t readTime):
+    readTime(readTime)
+{
+    for (auto i = vars.begin(); i != vars.end(); ++i) {
+        values.emplace_hint(values.end(), i->first, ConfigValue(i->second));
+    }
+}
+
+
+const ConfigValue& ConfigSnapshot::getValue(const std::string& aVariable) const
+{
+    Values::const_iterator itr = values.find(aVariable);
+
+    if (itr == values.end()) {
+        throw UserError("Server config variable " + aVariable + " not defined.");
+    }
+
+    return itr->second;
+}
+
+
+ServerConfig::ServerConfig() : cfgmonitor (this), version(++lastVersion), nextSubscriber(0)
 {
     FTS3_COMMON_LOGGER_NEWLOG(TRACE) << "ServerConfig created" << commit;
 }
@@ -44,68 +88,149 @@ ServerConfig::~ServerConfig()
 }
 
 
-const std::string &ServerConfig::_get_str(const std::string &aVariable)
+/// Each thread keeps a reference to the last snapshot it saw, and only
+/// needs to lock when a new version has been published since.
+struct CachedSnapshot {
+    uint64_t version;
+    std::shared_ptr<const ConfigSnapshot> snapshot;
+
+    CachedSnapshot(): version(0) {}
+};
+
+static thread_local CachedSnapshot cachedSnapshot;
+
+
+const ConfigValue& ServerConfig::_get_value(const std::string &aVariable)
 {
-    _t_vars::iterator itr = _vars.find(aVariable);
+    uint64_t current = version.load(std::memory_order_acquire);
+    if (cachedSnapshot.version != current) {
+        boost::mutex::scoped_lock lock(snapshotMutex);
+        cachedSnapshot.snapshot = snapshot;
+        cachedSnapshot.version = version.load(std::memory_order_relaxed);
+    }
 
-    if (itr == _vars.end()) {
+    if (!cachedSnapshot.snapshot) {
         throw UserError("Server config variable " + aVariable + " not defined.");
     }
+    return cachedSnapshot.snapshot->getValue(aVariable);
+}
 
-    // No worry, it will not be 0 pointer due to the exception
-    return itr->second;
+
+std::shared_ptr<const ConfigSnapshot> ServerConfig::getSnapshot()
+{
+    boost::mutex::scoped_lock lock(snapshotMutex);
+    if (!snapshot) {
+        return std::make_shared<ConfigSnapshot>(_t_vars(), 0);
+    }
+    return snapshot;
 }
 
 
-void ServerConfig::read(int argc, char** argv)
+/// Options added, removed, or with a different value
+static std::set<std::string> getChangedKeys(const ConfigSnapshot *before, const ConfigSnapshot &after)
 {
-    _read<ServerConfigReader> (argc, argv);
+    std::set<std::string> changed;
+    const ConfigSnapshot::Values &newValues = after.getValues();
+
+    if (!before) {
+        for (auto i = newValues.begin(); i != newValues.end(); ++i) {
+            changed.insert(i->first);
+        }
+        return changed;
+    }
+
+    const ConfigSnapshot::Values &oldValues = before->getValues();
+    auto o = oldValues.begin();
+    auto n = newValues.begin();
+    while (o != oldValues.end() || n != newValues.end()) {
+        if (n == newValues.end() || (o != oldValues.end() && o->first < n->first)) {
+            changed.insert(o->first);
+            ++o;
+        }
+        else if (o == oldValues.end() || n->first < o->first) {
+            changed.insert(n->first);
+            ++n;
+        }
+        else {
+            if (o->second.str != n->second.str) {
+                changed.insert(n->first);
+            }
+            ++o;
+            ++n;
+        }
+    }
+    return changed;
 }
 
 
-void ServerConfig::startMonitor(void)
+void ServerConfig::publish(const _t_vars& vars)
 {
-    cfgmonitor.start(
-        get<std::string>("configfile")
-    );
+    std::shared_ptr<const ConfigSnapshot> newSnapshot = std::make_shared<ConfigSnapshot>(vars, time(0));
+    std::shared_ptr<const ConfigSnapshot> oldSnapshot;
+    {
+        boost::mutex::scoped_lock lock(snapshotMutex);
+        oldSnapshot = snapshot;
+        snapshot = newSnapshot;
+        version.store(++lastVersion, std::memory_order_release);
+    }
+
+    std::set<std::string> changed = getChangedKeys(oldSnapshot.get(), *newSnapshot);
+    if (changed.empty()) {
+        return;
+    }
+    if (oldSnapshot) {
+        FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Configuration options changed: "
+            << boost::algorithm::join(changed, ", ") << commit;
+    }
+
+    boost::mutex::scoped_lock lock(subscribersMutex);
+    for (auto i = subscribers.begin(); i != subscribers.end(); ++i) {
+        const std::set<std::string> &keys = i->second.keys;
+        if (!keys.empty() && std::none_of(keys.begin(), keys.end(),
+                [&changed](const std::string &key) { return changed.count(key) > 0; })) {
+            continue;
+        }
+        try {
+            i->second.callback();
+        }
+        catch (const std::exception& e) {
+            FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Configuration change callback failed: " << e.what() << commit;
+        }
+    }
 }
 
 
-time_t ServerConfig::getReadTime()
+unsigned ServerConfig::subscribe(const ChangeCallback& callback, const std::set<std::string>& keys)
 {
-    return readTime;
+    boost::mutex::scoped_lock lock(subscribersMutex);
+    unsigned id = nextSubscriber++;
+    subscribers[id] = Subscriber{callback, keys};
+    return id;
 }
 
 
-void ServerConfig::waitIfReading()
+void ServerConfig::unsubscribe(unsigned id)
 {
-    boost::mutex::scoped_lock lock(qm);
-    while (reading) {
-        qv.wait(lock);
-    }
-    getting++;
+    boost::mutex::scoped_lock lock(subscribersMutex);
+    subscribers.erase(id);
 }
 
 
-void ServerConfig::notifyReaders()
+void ServerConfig::read(int argc, char** argv)
 {
-    boost::mutex::scoped_lock lock(qm);
-    getting--;
-    qv.notify_all(); // there is anyway only one thread to be notified
+    _read<ServerConfigReader> (argc, argv);
 }
 
 
-void ServerConfig::waitIfGetting()
+void ServerConfig::startMonitor(void)
 {
-    boost::mutex::scoped_lock lock(qm);
-    while (getting > 0) qv.wait(lock);
-    reading = true;
+    cfgmonitor.start(
+        get<std::string>("configfile")
+    );
 }
 
 
-void ServerConfig::notifyGetters()
+time_t ServerConfig::getReadTime()
 {
-    boost::mutex::scoped_lock lock(qm);
-    reading = false;
-    qv.notify_all();
+    return getSnapshot()->getReadTime();
 }
@@ -26,7 +26,11 @@
 
 #include "FileMonitor.h"
 
+#include <atomic>
+#include <functional>
 #include <map>
+#include <memory>
+#include <set>
 #include <vector>
 #include <boost/lexical_cast.hpp>
 #include <boost/regex.hpp>
@@ -41,11 +45,58 @@
 namespace fts3 {
 namespace config {
 
+/// Value of a configuration option, converted once when the configuration is read
+struct ConfigValue
+{
+    explicit ConfigValue(const std::string& str);
+
+    std::string str;
+    bool boolean;
+    bool isInt;
+    int integer;
+    bool isDouble;
+    double real;
+    std::vector<std::string> list;
+};
+
+
+/// Immutable copy of the configuration, as it was read at a given time.
+/// Can be shared between threads without locking.
+class ConfigSnapshot
+{
+public:
+    typedef std::map<std::string, ConfigValue> Values;
+
+    ConfigSnapshot(const std::map<std::string, std::string>& vars, time_t readTime);
+
+    /// Throws UserError if the option is not found
+    const ConfigValue& getValue(const std::string& aVariable) const;
+
+    const Values& getValues() const
+    {
+        return values;
+    }
+
+    time_t getReadTime() const
+    {
+        return readTime;
+    }
+
+private:
+    Values values;
+    time_t readTime;
+};
+
+
 /** \brief Class representing server configuration. Server configuration read once,
- * when the server starts. It provides read-only singleton access. */
+ * when the server starts. It provides read-only singleton access.
+ * Each reload publishes a new ConfigSnapshot, so getters never wait for a reload,
+ * nor for each other. */
 class ServerConfig: public fts3::common::Singleton<ServerConfig>
 {
 public:
+    typedef std::function<void(void)> ChangeCallback;
+
     /// Constructor
     ServerConfig();
 
@@ -71,23 +122,34 @@ public:
     /// desired type. Throws exception if the option is not found.
     template <typename RET> RET get(const std::string& aVariable);
 
+    /// Return the current configuration. Use it to read several options
+    /// that must be consistent between them.
+    std::shared_ptr<const ConfigSnapshot> getSnapshot();
+
+    /// Call back after a reload changes any of the given options
+    /// The callback runs on the thread that did the reload, and must not subscribe nor unsubscribe
+    /// @param keys If empty, any change triggers the callback
+    /// @return An identifier for unsubscribe
+    unsigned subscribe(const ChangeCallback& callback,
+        const std::set<std::string>& keys = std::set<std::string>());
+
+    /// Remove a callback registered with subscribe
+    void unsubscribe(unsigned id);
+
 protected:
 
     /// Type of the internal store of config variables.
     typedef std::map<std::string, std::string> _t_vars;
 
-    /// Return the variable value as a string.
-    const std::string& _get_str(const std::string& aVariable);
+    /// Return the variable value as read from the configuration
+    const ConfigValue& _get_value(const std::string& aVariable);
 
     /// Read the configurations - using injected reader type.
     template <typename READER_TYPE>
     void _read(int argc, char** argv)
     {
         READER_TYPE reader;
-        waitIfGetting();
-        _vars = reader(argc, argv);
-        readTime = time(0);
-        notifyGetters();
+        publish(reader(argc, argv));
     }
 
     /// Read the configurations from config file only - using injected reader.
@@ -95,85 +157,91 @@ protected:
     void _read(const std::string& aFileName)
     {
         READER_TYPE reader;
-        _vars = reader(aFileName);
+        publish(reader(aFileName));
     }
 
-    /// The internal store of config variables.
-    _t_vars _vars;
+    /// Replace the current configuration, and notify the subscribers
+    void publish(const _t_vars& vars);
 
     /// Configuration file monitor
     FileMonitor cfgmonitor;
 
-    bool reading;
-    int getting;
+private:
+    /// Current configuration. Protected by snapshotMutex, which is only taken
+    /// by publish, and by readers the first time they see a new version.
+    boost::mutex snapshotMutex;
+    std::shared_ptr<const ConfigSnapshot> snapshot;
 
-    boost::mutex qm;
-    boost::condition_variable qv;
+    /// Unique between all instances, so a cached snapshot is never mistaken
+    /// for one of a different instance
+    std::atomic<uint64_t> version;
 
-    time_t readTime;
+    struct Subscriber {
+        ChangeCallback callback;
+        std::set<std::string> keys;
+    };
 
-    void waitIfReading();
-    void notifyReaders();
-    void waitIfGetting();
-    void notifyGetters();
+    boost::mutex subscribersMutex;
+    std::map<unsigned, Subscriber> subscribers;
+    unsigned nextSubscriber;
 };
 
 
 template <typename RET>
 RET ServerConfig::get (const std::string& aVariable /**< A config variable name. */)
 {
+    return boost::lexical_cast<RET>(_get_value(aVariable).str);
+}
 
-    waitIfReading();
-    const std::string& str = _get_str(aVariable);
-    notifyReaders();
 
-    return boost::lexical_cast<RET>(str);
+template <>
+inline std::string ServerConfig::get<std::string> (const std::string& aVariable /**< A config variable name. */)
+{
+    return _get_value(aVariable).str;
 }
 
+
 template <>
 inline bool ServerConfig::get<bool> (const std::string& aVariable /**< A config variable name. */)
 {
+    return _get_value(aVariable).boolean;
+}
+
 
-    waitIfReading();
-    std::string str = _get_str(aVariable);
-    notifyReaders();
+template <>
+inline int ServerConfig::get<int> (const std::string& aVariable /**< A config variable name. */)
+{
+    const ConfigValue& value = _get_value(aVariable);
+    if (value.isInt) {
+        return value.integer;
+    }
+    // Raise the same error as before
+    return boost::lexical_cast<int>(value.str);
+}
 
-    boost::to_lower(str);
 
-    // if the string is 'false' return false
-    if (str == "false" || str == "0") return false;
-    // otherwise return true (it may be 'true' or other string containing respective value)
-    else return true;
+template <>
+inline double ServerConfig::get<double> (const std::string& aVariable /**< A config variable name. */)
+{
+    const ConfigValue& value = _get_value(aVariable);
+    if (value.isDouble) {
+        return value.real;
+    }
+    return boost::lexical_cast<double>(value.str);
 }
 
 
 template <>
 inline boost::posix_time::time_duration ServerConfig::get<boost::posix_time::time_duration> (const std::string& aVariable /**< A config variable name. */)
 {
-    waitIfReading();
-    std::string str = _get_str(aVariable);
-    notifyReaders();
-    return boost::posix_time::seconds(boost::lexical_cast<int>(str));
+    return boost::posix_time::seconds(get<int>(aVariable));
 }
 
 
 template <>
 inline std::vector<std::string> ServerConfig::get< std::vector<std::string> > (const std::string& aVariable /**< A config variable name. */)
 {
-
-    waitIfReading();
-    const std::string& str = _get_str(aVariable);
-    notifyReaders();
-
-    boost::char_separator<char> sep(";");
-    boost::tokenizer< boost::char_separator<char> > tokens(str, sep);
-
-    std::vector<std::string> ret;
-    for (auto it = tokens.begin(); it != tokens.end(); ++it) {
-        ret.push_back(*it);
-    }
-
-    return ret;
+    return _get_value(aVariable).list;
 }
 
 template <>
@@ -183,16 +251,15 @@ inline std::map<std::string, std::string> ServerConfig::get< std::map<std::strin
     std::map<std::string, std::string> ret;
     boost::regex re(aVariable);
 
-    waitIfReading();
+    std::shared_ptr<const ConfigSnapshot> current = getSnapshot();
+    const ConfigSnapshot::Values& values = current->getValues();
 
-    for (auto it = _vars.begin(); it != _vars.end(); ++it) {
+    for (auto it = values.begin(); it != values.end(); ++it) {
         if (boost::regex_match(it->first, re)) {
-            ret[it->first] = it->second;
+            ret[it->first] = it->second.str;
         }
     }
 
-    notifyReaders();
-
     return ret;
 }
 
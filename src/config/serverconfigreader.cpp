@@ -218,6 +218,11 @@ po::options_description ServerConfigReader::_defineConfigOptions()
         po::value<std::string>( &(_vars["MessagingDirectory"]) )->default_value(FTS3_CONFIG_SERVERCONFIG_MESSAGINGDIRECTORY_DEFAULT),
         "Directory where the internal FTS3 messages are written"
     )
+    (
+        "MessagingTransport",
+        po::value<std::string>( &(_vars["MessagingTransport"]) )->default_value("dirq"),
+        "Transport for the internal FTS3 messages: dirq, or shm to use shared memory rings with dirq as fallback"
+    )
     (
         "AuthorizedVO,v",
         po::value<std::string>( &(_vars["AuthorizedVO"]) )->default_value(std::string()),
@@ -298,6 +303,16 @@ po::options_description ServerConfigReader::_defineConfigOptions()
         po::value<std::string>( &(_vars["LogLevel"]) )->default_value("INFO"),
         "Logging level"
     )
+    (
+        "LogAsync",
+        po::value<std::string>( &(_vars["LogAsync"]) )->default_value("false"),
+        "Write the log from a background thread"
+    )
+    (
+        "LogAsyncBufferSize",
+        po::value<std::string>( &(_vars["LogAsyncBufferSize"]) )->default_value("8192"),
+        "Log lines each thread can queue before they are dropped"
+    )
     (
         "WithoutSoap",
         po::value<std::string>( &(_vars["WithoutSoap"]) )->default_value("false"),
@@ -333,6 +348,11 @@ po::options_description ServerConfigReader::_defineConfigOptions()
         po::value<std::string>( &(_vars["StagingPollRetries"]) )->default_value("3"),
         "Retry this number of times if a staging poll fails with ECOMM"
     )
+    (
+        "StagingPollRateLimit",
+        po::value<std::string>( &(_vars["StagingPollRateLimit"]) )->default_value("10"),
+        "Maximum number of staging and archiving polls per second sent to a storage endpoint"
+    )
     (
         "DefaultBringOnlineTimeout",
         po::value<std::string>( &(_vars["DefaultBringOnlineTimeout"]) )->default_value("604800"),
@@ -373,6 +393,11 @@ po::options_description ServerConfigReader::_defineConfigOptions()
         po::value<std::string>( &(_vars["MaxUrlCopyProcesses"]) )->default_value("400"),
         "Maximum number of url copy processes to run"
     )
+    (
+        "UrlCopyWorkers",
+        po::value<std::string>( &(_vars["UrlCopyWorkers"]) )->default_value("0"),
+        "Number of long lived url copy processes that run transfers one after the other. 0 to fork one process per transfer"
+    )
     (
         "PurgeMessagingDirectoryInterval",
         po::value<std::string>( &(_vars["PurgeMessagingDirectoryInterval"]) )->default_value("600"),
@@ -408,6 +433,13 @@ po::options_description ServerConfigReader::_defineConfigOptions()
         po::value<std::string>( &(_vars["SchedulingInterval"]) )->default_value("2"),
         "In seconds, how often to schedule new transfers"
     )
+    (
+        "SchedulingShards",
+        po::value<std::string>( &(_vars["SchedulingShards"]) )->default_value("1"),
+        "Number of threads that fetch and plan the transfer queues in parallel, each one for a subset of the links. "
+        "With more than one, the url copy slots are split between them by number of ready transfers, "
+        "and VOs are served round-robin within each one instead of across all the links"
+    )
     (
         "MessagingConsumeInterval",
         po::value<std::string>( &(_vars["MessagingConsumeInterval"]) )->default_value("1"),
@@ -458,6 +490,16 @@ po::options_description ServerConfigReader::_defineConfigOptions()
         po::value<int>()->default_value(1),
         "Decrease step size when the optimizer considers the performance is bad"
     )
+    (
+        "OptimizerStreamingStatistics",
+        po::value<std::string>( &(_vars["OptimizerStreamingStatistics"]) )->default_value("false"),
+        "Feed the optimizer statistics from the completion messages instead of scanning the database"
+    )
+    (
+        "OptimizerWorkers",
+        po::value<std::string>( &(_vars["OptimizerWorkers"]) )->default_value("1"),
+        "Number of threads evaluating the optimizer pairs concurrently"
+    )
     (
         "SigKillDelay",
         po::value<std::string>( &(_vars["SigKillDelay"]) )->default_value("500"),
@@ -488,6 +530,11 @@ po::options_description ServerConfigReader::_defineConfigOptions()
         po::value<std::string>( &(_vars["UseFixedJobPriority"]) )->default_value("0"),
         "Configure the system to use a fixed Job Priority, by default it queries the system to honour the priorities specified by the users"
     )
+    (
+        "SchedulingSnapshot",
+        po::value<std::string>( &(_vars["SchedulingSnapshot"]) )->default_value("false"),
+        "Load the scheduling state for all the queues in bulk, instead of querying queue by queue"
+    )
     (
         "CancelUnusedMultihopFiles",
         po::value<std::string>( &(_vars["CancelUnusedMultihopFiles"]) )->default_value("false"),
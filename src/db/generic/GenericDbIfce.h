@@ -48,6 +48,7 @@
 #include "ArchivingOperation.h"
 #include "QosTransitionOperation.h"
 #include "TransferFile.h"
+#include "TransferStatusOutcome.h"
 #include "UserCredential.h"
 #include "UserCredentialCache.h"
 
@@ -122,6 +123,14 @@ public:
             const std::string& transferState, const std::string& errorReason,
             int processId, double filesize, double duration, bool retry, std::string fileMetadata = "") = 0;
 
+    /// Update the status of a set of transfers, as reported by fts_url_copy
+    /// Equivalent to calling updateTransferStatus for each message, but the stored
+    /// states are loaded in bulk and the updates grouped in a few transactions
+    /// @param messages         Status messages. UPDATE messages must not be included.
+    /// @return                 One outcome per message, in the same order
+    virtual std::vector<TransferStatusOutcome> updateTransferStatusBulk(
+            const std::vector<fts3::events::Message>& messages) = 0;
+
     /// Update the status of a job
     /// @param jobId            The job ID
     /// @param jobState         The job state
@@ -254,8 +263,9 @@ public:
     /// Update the state of a transfer inside a session reuse job
     virtual unsigned int updateFileStatusReuse(const TransferFile &file, const std::string &status) = 0;
 
-    /// Puts into requestIDs, jobs that have been cancelled, and for which the running fts_url_copy must be killed
-    virtual void getCancelJob(std::vector<int>& requestIDs) = 0;
+    /// Puts into requestIDs the pid and file id of the transfers that have been cancelled,
+    /// and for which the running fts_url_copy must be killed
+    virtual void getCancelJob(std::vector<std::pair<int, uint64_t>>& requestIDs) = 0;
 
     /// Returns list of transfers that need to be force started
     virtual std::list<TransferFile> getForceStartTransfers() = 0;
@@ -358,6 +368,17 @@ public:
     /// @params[out] archivingOps The list of started archiving operations will be put here
     virtual void getAlreadyStartedArchiving(std::vector<ArchivingOperation> &archivingOps) = 0;
 
+    /// Get how long the staging requests that succeeded recently took
+    /// @param[out] durations   Durations in seconds, by storage endpoint
+    /// @param window           Only requests whose file finished in the last window seconds
+    virtual void getStagingDurations(std::map<std::string, std::vector<time_t>> &durations, time_t window) = 0;
+
+    /// Get how long the archiving requests that succeeded recently took
+    /// @param[out] durations   Durations in seconds, by storage endpoint
+    /// @param window           Only requests that finished in the last window seconds,
+    ///                         for files transferred in the last two windows
+    virtual void getArchivingDurations(std::map<std::string, std::vector<time_t>> &durations, time_t window) = 0;
+
     /// Put into files a set of bring online requests that must be cancelled
     /// @param files    Each entry in the set if a pair of surl / token
     virtual void getStagingFilesForCanceling(std::set< std::pair<std::string, std::string> >& files) = 0;
@@ -377,6 +398,10 @@ public:
 
     /// Get the configuration for a given storage
     virtual StorageConfig getStorageConfig(const std::string &storage) = 0;
+
+    /// Returns an opaque version of the link, storage and server configuration
+    /// It changes whenever any of them is modified, so cached values can be invalidated
+    virtual std::string getConfigurationVersion() = 0;
 };
 
 #endif // GENERICDBIFCE_H_
@@ -29,6 +29,7 @@
 #include <boost/logic/tribool.hpp>
 
 #include "Job.h"
+#include "common/SymbolTable.h"
 
 /**
  * Describes the status of one file in a transfer job.
@@ -86,7 +87,8 @@ public:
     TransferFile() :
             fileId(0), fileIndex(0),  numFailures(0),filesize(0.0),
             finishTime(0), jobFinished(0), pinLifetime(0), bringOnline(0),
-            userFilesize(0.0), jobType(Job::kTypeRegular), lastReplica(0), lastHop(0), pid(0)
+            userFilesize(0.0), jobType(Job::kTypeRegular), lastReplica(0), lastHop(0), pid(0),
+            sourceSeId(0), destSeId(0), voId(0)
     {
     }
 
@@ -133,9 +135,28 @@ public:
     int lastHop;
     pid_t pid;
 
+    /// sourceSe, destSe and voName, interned
+    /// Set when read from the database, or by internSymbols
+    fts3::common::Symbol sourceSeId;
+    fts3::common::Symbol destSeId;
+    fts3::common::Symbol voId;
+
     ProtocolParameters getProtocolParameters(void) const {
         return ProtocolParameters(internalFileParams);
     }
+
+    /// Intern the storage and VO names that are not yet
+    void internSymbols(void) {
+        if (sourceSeId == 0 && !sourceSe.empty()) {
+            sourceSeId = fts3::common::SymbolTable::storages().intern(sourceSe);
+        }
+        if (destSeId == 0 && !destSe.empty()) {
+            destSeId = fts3::common::SymbolTable::storages().intern(destSe);
+        }
+        if (voId == 0 && !voName.empty()) {
+            voId = fts3::common::SymbolTable::vos().intern(voName);
+        }
+    }
 };
 
 #endif // TRANSFERFILES_H_
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef TRANSFERSTATUSOUTCOME_H_
+#define TRANSFERSTATUSOUTCOME_H_
+
+#include <string>
+
+
+/// Result of applying a single status message (see GenericDbIfce::updateTransferStatusBulk)
+struct TransferStatusOutcome {
+    TransferStatusOutcome(): updated(false), failed(false)
+    {
+    }
+
+    /// true if the file state was changed
+    bool updated;
+    /// When not updated, the state found in the database
+    std::string storedState;
+    /// true if the message could not be applied because of an error, so it can be retried later
+    bool failed;
+    /// Error message when failed
+    std::string error;
+};
+
+
+#endif // TRANSFERSTATUSOUTCOME_H_
@@ -25,10 +25,46 @@
 
 #include <boost/logic/tribool.hpp>
 #include <boost/regex.hpp>
+#include <sstream>
 
 using namespace fts3::common;
 
 
+std::map<std::string, double> MySqlAPI::parseActivityShareConf(std::string activityShareStr)
+{
+    std::map<std::string, double> ret;
+
+    if (activityShareStr.empty()) return ret;
+
+    // remove the opening '[' and closing ']'
+    activityShareStr = activityShareStr.substr(1, activityShareStr.size() - 2);
+
+    // iterate over activity shares
+    boost::char_separator<char> sep(",");
+    boost::tokenizer< boost::char_separator<char> > tokens(activityShareStr, sep);
+    boost::tokenizer< boost::char_separator<char> >::iterator it;
+
+    static const boost::regex re("^\\s*\\{\\s*\"([ a-zA-Z0-9\\._-]+)\"\\s*:\\s*((0\\.)?\\d+)\\s*\\}\\s*$");
+    static const int ACTIVITY_NAME = 1;
+    static const int ACTIVITY_SHARE = 2;
+
+    for (it = tokens.begin(); it != tokens.end(); it++)
+    {
+        // parse single activity share
+        std::string str = *it;
+
+        boost::smatch what;
+        boost::regex_match(str, what, re, boost::match_extra);
+
+        std::string activity_name(what[ACTIVITY_NAME]);
+        boost::algorithm::to_lower(activity_name);
+        ret[activity_name] = boost::lexical_cast<double>(what[ACTIVITY_SHARE]);
+    }
+
+    return ret;
+}
+
+
 std::map<std::string, double> MySqlAPI::getActivityShareConf(soci::session& sql, std::string vo)
 {
 
@@ -48,32 +84,9 @@ std::map<std::string, double> MySqlAPI::getActivityShareConf(soci::session& sql,
             soci::into(activity_share_str, isNull)
             ;
 
-        if (isNull == soci::i_null || activity_share_str.empty()) return ret;
-
-        // remove the opening '[' and closing ']'
-        activity_share_str = activity_share_str.substr(1, activity_share_str.size() - 2);
-
-        // iterate over activity shares
-        boost::char_separator<char> sep(",");
-        boost::tokenizer< boost::char_separator<char> > tokens(activity_share_str, sep);
-        boost::tokenizer< boost::char_separator<char> >::iterator it;
-
-        static const boost::regex re("^\\s*\\{\\s*\"([ a-zA-Z0-9\\._-]+)\"\\s*:\\s*((0\\.)?\\d+)\\s*\\}\\s*$");
-        static const int ACTIVITY_NAME = 1;
-        static const int ACTIVITY_SHARE = 2;
-
-        for (it = tokens.begin(); it != tokens.end(); it++)
-        {
-            // parse single activity share
-            std::string str = *it;
-
-            boost::smatch what;
-            boost::regex_match(str, what, re, boost::match_extra);
+        if (isNull == soci::i_null) return ret;
 
-            std::string activity_name(what[ACTIVITY_NAME]);
-            boost::algorithm::to_lower(activity_name);
-            ret[activity_name] = boost::lexical_cast<double>(what[ACTIVITY_SHARE]);
-        }
+        ret = parseActivityShareConf(activity_share_str);
     }
     catch (std::exception& e)
     {
@@ -754,3 +767,32 @@ StorageConfig MySqlAPI::getStorageConfig(const std::string &storage)
 
     return seConfig;
 }
+
+
+std::string MySqlAPI::getConfigurationVersion()
+{
+    soci::session sql(*connectionPool);
+    std::ostringstream version;
+
+    try
+    {
+        soci::rowset<soci::row> rs = (sql.prepare << "CHECKSUM TABLE t_link_config, t_se, t_server_config");
+        for (auto i = rs.begin(); i != rs.end(); ++i) {
+            version << i->get<std::string>("Table") << ":";
+            if (i->get_indicator("Checksum") != soci::i_null) {
+                version << i->get<long long>("Checksum");
+            }
+            version << ";";
+        }
+    }
+    catch (std::exception& e)
+    {
+        throw UserError(std::string(__func__) + ": Caught exception " + e.what());
+    }
+    catch (...)
+    {
+        throw UserError(std::string(__func__) + ": Caught exception " );
+    }
+
+    return version.str();
+}
@@ -19,13 +19,18 @@
  */
 
 #include <sys/time.h>
+#include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/range/algorithm/transform.hpp>
 
+#include <algorithm>
 #include <map>
 #include <chrono>
+#include <sstream>
 #include <soci/mysql/soci-mysql.h>
 #include "MySqlAPI.h"
+#include "SchedulingPlan.h"
+#include "StagingPlan.h"
 #include "sociConversions.h"
 #include "db/generic/DbUtils.h"
 #include <random>
@@ -38,6 +43,16 @@ using namespace fts3::common;
 using namespace db;
 
 
+/// How many per-credential staging selects are glued together with UNION ALL into a single statement
+static const size_t STAGING_UNION_BATCH = 50;
+
+/// How many file ids go into the IN list of a single state update
+static const size_t STATE_UPDATE_BATCH = 500;
+
+/// Files updated with the same state and reason
+typedef std::map<std::pair<std::string, std::string>, std::vector<uint64_t> > StateGroups;
+
+
 static int thread_random(void)
 {
     static __thread struct random_data rand_data =
@@ -76,6 +91,27 @@ static unsigned int get_affected_rows(soci::session& sql)
 }
 
 
+std::string sqlQuote(soci::session& sql, const std::string& value)
+{
+    soci::mysql_session_backend* be = static_cast<soci::mysql_session_backend*>(sql.get_backend());
+    std::vector<char> escaped(value.size() * 2 + 1);
+    unsigned long len = mysql_real_escape_string(static_cast<MYSQL*>(be->conn_),
+        escaped.data(), value.c_str(), static_cast<unsigned long>(value.size()));
+    return "'" + std::string(escaped.data(), len) + "'";
+}
+
+
+std::string sqlQuoteList(soci::session& sql, const std::set<std::string>& values)
+{
+    std::vector<std::string> quoted;
+    quoted.reserve(values.size());
+    for (auto i = values.begin(); i != values.end(); ++i) {
+        quoted.push_back(sqlQuote(sql, *i));
+    }
+    return boost::algorithm::join(quoted, ", ");
+}
+
+
 MySqlAPI::MySqlAPI(): poolSize(10), connectionPool(NULL), hostname(getFullHostname())
 {
     // Pass
@@ -310,21 +346,9 @@ std::map<std::string, long long> MySqlAPI::getActivitiesInQueue(soci::session& s
         soci::rowset<soci::row>::const_iterator it;
         for (it = rs.begin(); it != rs.end(); it++)
         {
-            std::string activity_name;
-
-            if (it->get_indicator("activity") == soci::i_null) {
-                activity_name = "default";
-            }
-            else {
-                activity_name = it->get<std::string>("activity");
-                if (activity_name.empty()) {
-                    activity_name = "default";
-                }
-            }
-
-            boost::algorithm::to_lower(activity_name);
-            long long nFiles = it->get<long long>("count");
-            ret[activity_name] = nFiles;
+            // NULL and empty both go to the default share
+            std::string activity_name = normaliseActivityName(it->get<std::string>("activity", ""));
+            ret[activity_name] += it->get<long long>("count");
         }
     }
     catch (std::exception& e)
@@ -340,108 +364,6 @@ std::map<std::string, long long> MySqlAPI::getActivitiesInQueue(soci::session& s
 }
 
 
-//check if called by multiple threads
-
-std::map<std::string, int> MySqlAPI::getFilesNumPerActivity(soci::session& sql,
-        std::string src, std::string dst, std::string vo, int filesNum,
-        std::set<std::string> & defaultActivities)
-{
-    std::map<std::string, int> activityFilesNum;
-
-    try
-    {
-        // get activity shares configuration for given VO
-        std::map<std::string, double> activityShares = getActivityShareConf(sql, vo);
-
-        // if there is no configuration no assigment can be made
-        if (activityShares.empty()) return activityFilesNum;
-
-        // get the activities in the queue
-        std::map<std::string, long long> activitiesInQueue = getActivitiesInQueue(sql, src, dst, vo);
-
-        // sum of all activity shares in the queue (needed for normalization)
-        double sum = 0.0;
-
-        std::map<std::string, long long>::iterator it;
-        for (it = activitiesInQueue.begin(); it != activitiesInQueue.end(); it++)
-        {
-            std::map<std::string, double>::iterator pos = activityShares.find(it->first);
-            if (pos != activityShares.end() && it->first != "default")
-            {
-                sum += pos->second;
-            }
-            else
-            {
-                // if the activity has not been defined it falls to default
-                defaultActivities.insert(it->first);
-            }
-        }
-
-        // if default was used add it as well
-        if (!defaultActivities.empty())
-            sum += activityShares["default"];
-
-        // assign slots to activities
-        for (int i = 0; i < filesNum; i++)
-        {
-            // if sum <= 0 there is nothing to assign
-            if (sum <= 0) break;
-            // a random number from (0, 1)
-            double r = ((double) thread_random() / (double)RAND_MAX);
-
-            FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << __func__ << ": Dice result: " << r << commit;
-
-            // interval corresponding to given activity
-            double interval = 0;
-
-            for (it = activitiesInQueue.begin(); it != activitiesInQueue.end(); it++)
-            {
-                // if there are no more files for this activity continue
-                if (it->second <= 0) continue;
-                // get the activity name (if it was not defined use default)
-                std::string activity_name = defaultActivities.count(it->first) ? "default" : it->first;
-
-                // calculate the interval (normalize)
-                interval += activityShares[activity_name] / sum;
-
-                // if the slot has been assigned to the given activity ...
-
-                if (r < interval)
-                {
-                    ++activityFilesNum[activity_name];
-
-                    --it->second;
-                    // if there are no more files for the given ativity remove it from the sum
-                    if (it->second == 0)
-                    {
-                        sum -= activityShares[activity_name];
-                    }
-                    break;
-
-                }
-            }
-        }
-
-        // Debug output
-        std::map<std::string, int>::const_iterator j;
-        for (j = activityFilesNum.begin(); j != activityFilesNum.end(); ++j)
-        {
-            FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << __func__ << ": " << j->first << " assigned " << j->second << commit;
-        }
-    }
-    catch (std::exception& e)
-    {
-        throw UserError(std::string(__func__) + ": Caught exception " + e.what());
-    }
-    catch (...)
-    {
-        throw UserError(std::string(__func__) + ": Caught exception " );
-    }
-
-    return activityFilesNum;
-}
-
-
 void MySqlAPI::getQueuesWithPending(std::vector<QueueId>& queues)
 {
     soci::session sql(*connectionPool);
@@ -574,62 +496,69 @@ void MySqlAPI::getReadyTransfers(const std::vector<QueueId>& queues,
 
     try
     {
+        if (ServerConfig::instance().get<bool>("SchedulingSnapshot")) {
+            getReadyTransfersSnapshot(sql, queues, files);
+            return;
+        }
+
+        // Same value for all the queues of this run, even if the configuration is reloaded meanwhile
+        const int fixedPriority = ServerConfig::instance().get<int>("UseFixedJobPriority");
+
         // Iterate through queues, getting jobs IF the VO has not run out of credits
         // AND there are pending file transfers within the job
         for (auto it = queues.begin(); it != queues.end(); ++it)
         {
-            int maxActive = 0;
-            soci::indicator maxActiveNull = soci::i_ok;
-            int filesNum = 10;
-
-            int activeCount = getActiveCount(sql, it->sourceSe, it->destSe);
+            QueueState state;
+            state.activeCount = getActiveCount(sql, it->sourceSe, it->destSe);
 
             // How many can we run
+            soci::indicator maxActiveNull = soci::i_ok;
             sql << "SELECT active FROM t_optimizer WHERE source_se = :source_se AND dest_se = :dest_se",
                    soci::use(it->sourceSe),
                    soci::use(it->destSe),
-                   soci::into(maxActive, maxActiveNull);
-
-            // Calculate how many tops we should pick
-            if (maxActiveNull != soci::i_null && maxActive > 0)
-            {
-                filesNum = (maxActive - activeCount);
-                if(filesNum <= 0 ) {
-                    continue;
-                }
+                   soci::into(state.maxActive, maxActiveNull);
+            if (maxActiveNull == soci::i_null) {
+                state.maxActive = 0;
             }
 
-            int fixedPriority =  ServerConfig::instance().get<int> ("UseFixedJobPriority");
-            soci::indicator isMaxPriorityNull = soci::i_ok;
-            int maxPriority = 3;
             if (fixedPriority == 0) {
                 // Get highest priority waiting for this queue
                 // We then filter by this, and order by file_id
                 // Doing this, we avoid a order by priority, which would trigger a filesort, which
                 // can be pretty slow...
+                soci::indicator isMaxPriorityNull = soci::i_ok;
                 sql << "SELECT MAX(priority) "
                    "FROM t_file "
                    "WHERE "
                    "    vo_name=:voName AND source_se=:source AND dest_se=:dest AND "
                    "    file_state = 'SUBMITTED'",
                    soci::use(it->voName), soci::use(it->sourceSe), soci::use(it->destSe),
-                   soci::into(maxPriority, isMaxPriorityNull);
-                if (isMaxPriorityNull == soci::i_null) {
-                   FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "NULL MAX(priority), skip entry" << commit;
-                   continue;
-                }
-            } 
-            else 
+                   soci::into(state.maxPriority, isMaxPriorityNull);
+                state.hasMaxPriority = (isMaxPriorityNull != soci::i_null);
+            }
+            else
             {
                 FTS3_COMMON_LOGGER_NEWLOG(WARNING) << __func__
                 << " Using fixed priority for Jobs."
                 << commit;
+            }
+
+            // Do not load the activities of a queue that is skipped anyway
+            QueuePlan plan;
+            if (!planQueue(state, fixedPriority, plan)) {
+                continue;
+            }
 
-                maxPriority=fixedPriority;
+            // get activity shares configuration for given VO, and the activities in the queue
+            state.activityShares = getActivityShareConf(sql, it->voName);
+            if (!state.activityShares.empty()) {
+                state.activitiesInQueue = getActivitiesInQueue(sql, it->sourceSe, it->destSe, it->voName);
+                planQueue(state, fixedPriority, plan);
             }
-            std::set<std::string> default_activities;
-            std::map<std::string, int> activityFilesNum =
-                getFilesNumPerActivity(sql, it->sourceSe, it->destSe, it->voName, filesNum, default_activities);
+            const int filesNum = plan.filesNum;
+            const int maxPriority = plan.maxPriority;
+            const std::set<std::string> &default_activities = plan.defaultActivities;
+            const std::map<std::string, int> &activityFilesNum = plan.activityFilesNum;
 
             struct tm tTime;
             gmtime_r(&now, &tTime);
@@ -1205,185 +1134,177 @@ boost::tuple<bool, std::string>  MySqlAPI::updateTransferStatus(const std::strin
 }
 
 
-boost::tuple<bool, std::string>  MySqlAPI::updateFileTransferStatusInternal(soci::session& sql, double throughput,
-        std::string jobId, uint64_t fileId,
-        std::string newFileState, std::string transferMessage,
-        int processId, double filesize, double duration, bool retry,
-        std::string fileMetadata)
+/// How many status messages are applied within the same transaction
+static const size_t STATUS_UPDATE_BATCH_SIZE = 200;
+
+
+std::vector<TransferStatusOutcome> MySqlAPI::updateTransferStatusBulk(const std::vector<fts3::events::Message>& messages)
 {
-    std::string storedState;
-    soci::indicator destSurlUuidInd;
-    std::string destSurlUuid;
+    std::vector<TransferStatusOutcome> outcomes(messages.size());
+    soci::session sql(*connectionPool);
 
-    try
-    {
-        sql.begin();
-        
-        std::string storedState, jobState, archiveTimeoutStr;
-        soci::indicator archiveTimeoutInd = soci::i_ok;
-        int archiveTimeout = -1;
-        Job::JobType jobType;
+    for (size_t start = 0; start < messages.size(); start += STATUS_UPDATE_BATCH_SIZE) {
+        size_t end = std::min(messages.size(), start + STATUS_UPDATE_BATCH_SIZE);
 
-        time_t now = time(NULL);
-        struct tm tTime;
-        gmtime_r(&now, &tTime);
+        std::vector<std::string> jobIds(end - start);
+        std::vector<uint64_t> fileIds(end - start, 0);
+        std::vector<std::string> newStates(end - start);
+        std::vector<StoredTransferState> previousStates(end - start);
 
-        if(jobId.empty() || fileId == 0) {
-            sql << "SELECT job_id, file_id FROM t_file WHERE pid=:pid AND file_state = 'ACTIVE' LIMIT 1 ",
-                soci::use(processId), soci::into(jobId), soci::into(fileId);
-        }
+        try {
+            sql.begin();
 
-        // Need to know the type of job, to know what's coming next
-        sql << "SELECT job_type, job_state, archive_timeout FROM t_job WHERE job_id = :job_id",
-            soci::use(jobId), soci::into(jobType), soci::into(jobState),
-            soci::into(archiveTimeoutStr, archiveTimeoutInd);
+            // Messages without job or file id are bound to the transfer by the pid
+            std::ostringstream fileIdList;
+            for (size_t i = start; i < end; ++i) {
+                const fts3::events::Message &msg = messages[i];
+                std::string &jobId = jobIds[i - start];
+                uint64_t &fileId = fileIds[i - start];
 
-        // query for the file state in DB
-        sql << "SELECT file_state, dest_surl_uuid FROM t_file WHERE file_id=:fileId",
-            soci::use(fileId),
-            soci::into(storedState),
-            soci::into(destSurlUuid, destSurlUuidInd);
+                jobId = msg.job_id();
+                fileId = msg.file_id();
+                if (jobId.empty() || fileId == 0) {
+                    int processId = msg.process_id();
+                    sql << "SELECT job_id, file_id FROM t_file WHERE pid=:pid AND file_state = 'ACTIVE' LIMIT 1 ",
+                        soci::use(processId), soci::into(jobId), soci::into(fileId);
+                }
 
-        if (archiveTimeoutInd == soci::i_ok) {
-            archiveTimeout = std::atoi(archiveTimeoutStr.c_str());
-        }
+                if (i > start) {
+                    fileIdList << ", ";
+                }
+                fileIdList << fileId;
+            }
+
+            // Stored state of all the files in the batch, and their jobs
+            std::map<uint64_t, StoredTransferState> storedStates;
+            soci::rowset<soci::row> rs = (sql.prepare <<
+                "SELECT f.file_id, f.file_state, f.dest_surl_uuid, j.job_type, j.job_state, j.archive_timeout "
+                "FROM t_file f INNER JOIN t_job j ON f.job_id = j.job_id "
+                "WHERE f.file_id IN (" << fileIdList.str() << ")");
+            for (auto i = rs.begin(); i != rs.end(); ++i) {
+                StoredTransferState &stored = storedStates[i->get<unsigned long long>("file_id")];
+                stored.fileState = i->get<std::string>("file_state");
+                stored.destSurlUuidInd = i->get_indicator("dest_surl_uuid");
+                if (stored.destSurlUuidInd == soci::i_ok) {
+                    stored.destSurlUuid = i->get<std::string>("dest_surl_uuid");
+                }
+                stored.jobType = i->get<Job::JobType>("job_type", Job::kTypeRegular);
+                stored.jobState = i->get<std::string>("job_state");
+                if (i->get_indicator("archive_timeout") == soci::i_ok) {
+                    stored.archiveTimeout = std::atoi(i->get<std::string>("archive_timeout").c_str());
+                }
+            }
 
-        bool isStaging = (storedState == "STAGING");
+            for (size_t i = start; i < end; ++i) {
+                const fts3::events::Message &msg = messages[i];
+                size_t index = i - start;
 
-        // If file is in terminal don't do anything, just return
-        if(storedState == "FAILED" || storedState == "FINISHED" || storedState == "CANCELED" )
-        {
-            sql.rollback();
-            return boost::tuple<bool, std::string>(false, storedState);
-        }
+                // Files not found behave as in updateFileTransferStatusInternal: nothing matches the update
+                StoredTransferState &stored = storedStates[fileIds[index]];
+                previousStates[index] = stored;
+                newStates[index] = msg.transfer_status();
 
-        // If trying to go from ACTIVE back to READY, do nothing either
-        if (storedState == "ACTIVE" && newFileState == "READY") {
+                outcomes[i].storedState = stored.fileState;
+                outcomes[i].updated = applyFileTransferStatus(sql, stored, msg.throughput(),
+                    jobIds[index], fileIds[index], newStates[index], msg.transfer_message(), msg.process_id(),
+                    msg.filesize(), msg.time_in_secs(), msg.retry(), msg.file_metadata());
+
+                // Later messages for the same file must see this transition
+                if (outcomes[i].updated) {
+                    stored.fileState = newStates[index];
+                }
+            }
+
+            sql.commit();
+        }
+        catch (std::exception& e) {
             sql.rollback();
-            return boost::tuple<bool, std::string>(false, storedState);
+            FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Could not apply a batch of " << (end - start)
+                << " status messages, applying them one by one: " << e.what() << commit;
+
+            // Fall back to individual transactions, so only the offending messages fail
+            for (size_t i = start; i < end; ++i) {
+                const fts3::events::Message &msg = messages[i];
+                try {
+                    boost::tuple<bool, std::string> updated = updateFileTransferStatusInternal(sql,
+                        msg.throughput(), msg.job_id(), msg.file_id(), msg.transfer_status(), msg.transfer_message(),
+                        msg.process_id(), msg.filesize(), msg.time_in_secs(), msg.retry(), msg.file_metadata());
+                    outcomes[i].updated = updated.get<0>();
+                    outcomes[i].storedState = updated.get<1>();
+                }
+                catch (std::exception& e) {
+                    outcomes[i].failed = true;
+                    outcomes[i].error = e.what();
+                }
+            }
+            continue;
         }
 
-        // If the file already in the same state, don't do anything either
-        // avoid 2 url-copy on the same file id to start ( condition processId==0)
-        if (storedState == newFileState) {
-            if (newFileState == "READY" && processId != 0) {}
-            else {
+        // Multiple replica and multihop jobs need to trigger the next file,
+        // each in its own transaction, as updateFileTransferStatusInternal does
+        for (size_t i = start; i < end; ++i) {
+            size_t index = i - start;
+            if (!outcomes[i].updated) {
+                continue;
+            }
+            try {
+                followUpFileTransferStatus(sql, previousStates[index], jobIds[index], fileIds[index], newStates[index]);
+            }
+            catch (std::exception& e) {
                 sql.rollback();
-                return boost::tuple<bool, std::string>(false, storedState);
+                outcomes[i].failed = true;
+                outcomes[i].error = std::string(__func__) + ": Caught exception " + e.what();
             }
         }
+    }
 
-        soci::statement stmt(sql);
-        std::ostringstream query;
+    return outcomes;
+}
 
-        query << "UPDATE t_file SET "
-              "    file_state = :state, reason = :reason";
-        stmt.exchange(soci::use(newFileState, "state"));
-        stmt.exchange(soci::use(transferMessage, "reason"));
 
-        if (newFileState == "FINISHED" || newFileState == "FAILED" || newFileState == "CANCELED")
-        {
-            query << ", FINISH_TIME = :time1, DEST_SURL_UUID = NULL";
-            stmt.exchange(soci::use(tTime, "time1"));
-        }
-        if (newFileState == "ACTIVE" || newFileState == "READY")
-        {
-            query << ", START_TIME = :time1";
-            stmt.exchange(soci::use(tTime, "time1"));
-        }
+boost::tuple<bool, std::string>  MySqlAPI::updateFileTransferStatusInternal(soci::session& sql, double throughput,
+        std::string jobId, uint64_t fileId,
+        std::string newFileState, std::string transferMessage,
+        int processId, double filesize, double duration, bool retry,
+        std::string fileMetadata)
+{
+    try
+    {
+        sql.begin();
 
-        query << ", transfer_Host = :hostname";
-        stmt.exchange(soci::use(hostname, "hostname"));
+        StoredTransferState stored;
+        std::string archiveTimeoutStr;
+        soci::indicator archiveTimeoutInd = soci::i_ok;
 
-        if (newFileState == "FINISHED")
-        {
-            query << ", transferred = :filesize";
-            stmt.exchange(soci::use(filesize, "filesize"));
+        if(jobId.empty() || fileId == 0) {
+            sql << "SELECT job_id, file_id FROM t_file WHERE pid=:pid AND file_state = 'ACTIVE' LIMIT 1 ",
+                soci::use(processId), soci::into(jobId), soci::into(fileId);
         }
 
-        if (newFileState == "FAILED" || newFileState == "CANCELED")
-        {
-            query << ", transferred = :transferred";
-            stmt.exchange(soci::use(0, "transferred"));
-        }
+        // Need to know the type of job, to know what's coming next
+        sql << "SELECT job_type, job_state, archive_timeout FROM t_job WHERE job_id = :job_id",
+            soci::use(jobId), soci::into(stored.jobType), soci::into(stored.jobState),
+            soci::into(archiveTimeoutStr, archiveTimeoutInd);
 
-        if (newFileState == "STAGING")
-        {
-            if (isStaging)
-            {
-                query << ", STAGING_FINISHED = :time1";
-                stmt.exchange(soci::use(tTime, "time1"));
-            }
-            else
-            {
-                query << ", STAGING_START = :time1";
-                stmt.exchange(soci::use(tTime, "time1"));
-            }
-        }
-        
-        // Move the new state to ARCHIVING if the transfer completed and the archive timeout is set
-        if (newFileState == "FINISHED" && isArchivingTransfer(sql, jobId, jobType, archiveTimeout)) {
-            FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Moving transfer " << jobId << " " << fileId
-                                             << " to ARCHIVING state" << commit;
-            newFileState = "ARCHIVING";
-        }
+        // query for the file state in DB
+        sql << "SELECT file_state, dest_surl_uuid FROM t_file WHERE file_id=:fileId",
+            soci::use(fileId),
+            soci::into(stored.fileState),
+            soci::into(stored.destSurlUuid, stored.destSurlUuidInd);
 
-        if (!fileMetadata.empty()) {
-            query << ", file_metadata = :file_metadata";
-            stmt.exchange(soci::use(fileMetadata, "file_metadata"));
+        if (archiveTimeoutInd == soci::i_ok) {
+            stored.archiveTimeout = std::atoi(archiveTimeoutStr.c_str());
         }
 
-        query << "   , pid = :pid, filesize = :filesize, tx_duration = :duration, throughput = :throughput, current_failures = :current_failures "
-              "WHERE file_id = :fileId AND file_state = :oldState";
-        stmt.exchange(soci::use(processId, "pid"));
-        stmt.exchange(soci::use(filesize, "filesize"));
-        stmt.exchange(soci::use(duration, "duration"));
-        stmt.exchange(soci::use(throughput, "throughput"));
-        stmt.exchange(soci::use(static_cast<int>(retry), "current_failures"));
-        stmt.exchange(soci::use(fileId, "fileId"));
-        stmt.exchange(soci::use(storedState, "oldState"));
-        stmt.alloc();
-        stmt.prepare(query.str());
-        stmt.define_and_bind();
-
-        stmt.execute(true);
-
-        if (get_affected_rows(sql) == 0) {
+        if (!applyFileTransferStatus(sql, stored, throughput, jobId, fileId, newFileState, transferMessage,
+                processId, filesize, duration, retry, fileMetadata)) {
             sql.rollback();
-            return boost::tuple<bool, std::string>(false, storedState);
+            return boost::tuple<bool, std::string>(false, stored.fileState);
         }
 
         sql.commit();
 
-        switch (jobType) {
-            // Multiple replica job, on failure, need to pick next option
-            case Job::kTypeMultipleReplica:
-                if ((jobState != "CANCELED" && jobState != "FAILED") &&
-                    (newFileState == "FAILED" || newFileState == "CANCELED")) {
-                    sql.begin();
-                    useFileReplica(sql, jobId, fileId, destSurlUuid, destSurlUuidInd);
-                    sql.commit();
-                }
-                break;
-            // For multihop jobs, on success enable next option
-            case Job::kTypeMultiHop:
-                if ((jobState != "CANCELED" && jobState != "FAILED") &&
-                    (newFileState == "FINISHED")) {
-                    sql.begin();
-                    useNextHop(sql, jobId);
-                    sql.commit();
-                }
-                else {
-                    // need to remove all dest_surl_uuid from all jobs
-                    sql.begin();
-                    setNullDestSURLMultiHop(sql, jobId);
-                    sql.commit();
-                }
-                break;
-            // Nothing special for other type of jobs
-            default:
-                break;
-        }
+        followUpFileTransferStatus(sql, stored, jobId, fileId, newFileState);
     }
     catch (std::exception& e)
     {
@@ -1395,57 +1316,209 @@ boost::tuple<bool, std::string>  MySqlAPI::updateFileTransferStatusInternal(soci
         sql.rollback();
         throw UserError(std::string(__func__) + ": Caught exception ");
     }
-    return  boost::tuple<bool, std::string>(true, storedState);
+    return  boost::tuple<bool, std::string>(true, std::string());
 }
 
 
-bool MySqlAPI::updateJobStatus(const std::string& jobId, const std::string& jobState)
+bool MySqlAPI::applyFileTransferStatus(soci::session& sql, const StoredTransferState& stored, double throughput,
+        const std::string& jobId, uint64_t fileId,
+        std::string& newFileState, const std::string& transferMessage,
+        int processId, double filesize, double duration, bool retry,
+        const std::string& fileMetadata)
 {
-    soci::session sql(*connectionPool);
-    return updateJobTransferStatusInternal(sql, jobId, jobState);
-}
+    const std::string &storedState = stored.fileState;
+
+    time_t now = time(NULL);
+    struct tm tTime;
+    gmtime_r(&now, &tTime);
 
+    bool isStaging = (storedState == "STAGING");
 
-bool MySqlAPI::updateJobTransferStatusInternal(soci::session& sql, std::string jobId, const std::string& state)
-{
-    try
+    // If file is in terminal don't do anything, just return
+    if(storedState == "FAILED" || storedState == "FINISHED" || storedState == "CANCELED" )
     {
-        int numberOfFilesInJob = 0;
-        int numberOfFilesCanceled = 0;
-        int numberOfFilesFinished = 0;
-        int numberOfFilesFailed = 0;
-        int numberOfStaging = 0;
-        int numberOfFilesArchiving = 0;
+        return false;
+    }
 
-        int numberOfFilesNotCanceled = 0;
-        int numberOfFilesNotCanceledNorFailed = 0;
+    // If trying to go from ACTIVE back to READY, do nothing either
+    if (storedState == "ACTIVE" && newFileState == "READY") {
+        return false;
+    }
 
-        std::string currentState("");
-        Job::JobType jobType;
-        soci::indicator isNull = soci::i_ok;
-        std::string sourceSe;
-        soci::indicator isNullFileId = soci::i_ok;
+    // If the file already in the same state, don't do anything either
+    // avoid 2 url-copy on the same file id to start ( condition processId==0)
+    if (storedState == newFileState) {
+        if (newFileState == "READY" && processId != 0) {}
+        else {
+            return false;
+        }
+    }
 
-        soci::statement stmt1 = (
-            sql.prepare << " SELECT job_state, job_type FROM t_job  "
-            " WHERE job_id = :job_id ",
-            soci::use(jobId),
-            soci::into(currentState),
-            soci::into(jobType, isNull));
-        stmt1.execute(true);
+    soci::statement stmt(sql);
+    std::ostringstream query;
 
-        if(currentState == state)
-            return true;
+    query << "UPDATE t_file SET "
+          "    file_state = :state, reason = :reason";
+    stmt.exchange(soci::use(newFileState, "state"));
+    stmt.exchange(soci::use(transferMessage, "reason"));
 
-        if(currentState == "STAGING" && state == "STARTED")
-            return true;
+    if (newFileState == "FINISHED" || newFileState == "FAILED" || newFileState == "CANCELED")
+    {
+        query << ", FINISH_TIME = :time1, DEST_SURL_UUID = NULL";
+        stmt.exchange(soci::use(tTime, "time1"));
+    }
+    if (newFileState == "ACTIVE" || newFileState == "READY")
+    {
+        query << ", START_TIME = :time1";
+        stmt.exchange(soci::use(tTime, "time1"));
+    }
 
-        if(jobType == Job::kTypeMultipleReplica && currentState == "ARCHIVING" && state == "FAILED") {
-            // FTS-1882: Fail multi-replica archiving jobs when archive monitoring step fails
-            std::string reason = "Archive monitoring failed in a multiple replica job";
+    query << ", transfer_Host = :hostname";
+    stmt.exchange(soci::use(hostname, "hostname"));
 
-            sql <<  " SELECT source_se FROM t_file WHERE job_id=:job_id AND file_state='FAILED' LIMIT 1 ",
-            soci::use(jobId), soci::into(sourceSe);
+    if (newFileState == "FINISHED")
+    {
+        query << ", transferred = :filesize";
+        stmt.exchange(soci::use(filesize, "filesize"));
+    }
+
+    if (newFileState == "FAILED" || newFileState == "CANCELED")
+    {
+        query << ", transferred = :transferred";
+        stmt.exchange(soci::use(0, "transferred"));
+    }
+
+    if (newFileState == "STAGING")
+    {
+        if (isStaging)
+        {
+            query << ", STAGING_FINISHED = :time1";
+            stmt.exchange(soci::use(tTime, "time1"));
+        }
+        else
+        {
+            query << ", STAGING_START = :time1";
+            stmt.exchange(soci::use(tTime, "time1"));
+        }
+    }
+
+    // Move the new state to ARCHIVING if the transfer completed and the archive timeout is set
+    if (newFileState == "FINISHED" && isArchivingTransfer(sql, jobId, stored.jobType, stored.archiveTimeout)) {
+        FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Moving transfer " << jobId << " " << fileId
+                                         << " to ARCHIVING state" << commit;
+        newFileState = "ARCHIVING";
+    }
+
+    if (!fileMetadata.empty()) {
+        query << ", file_metadata = :file_metadata";
+        stmt.exchange(soci::use(fileMetadata, "file_metadata"));
+    }
+
+    int currentFailures = static_cast<int>(retry);
+
+    query << "   , pid = :pid, filesize = :filesize, tx_duration = :duration, throughput = :throughput, current_failures = :current_failures "
+          "WHERE file_id = :fileId AND file_state = :oldState";
+    stmt.exchange(soci::use(processId, "pid"));
+    stmt.exchange(soci::use(filesize, "filesize"));
+    stmt.exchange(soci::use(duration, "duration"));
+    stmt.exchange(soci::use(throughput, "throughput"));
+    stmt.exchange(soci::use(currentFailures, "current_failures"));
+    stmt.exchange(soci::use(fileId, "fileId"));
+    stmt.exchange(soci::use(storedState, "oldState"));
+    stmt.alloc();
+    stmt.prepare(query.str());
+    stmt.define_and_bind();
+
+    stmt.execute(true);
+
+    return get_affected_rows(sql) > 0;
+}
+
+
+void MySqlAPI::followUpFileTransferStatus(soci::session& sql, const StoredTransferState& stored,
+        const std::string& jobId, uint64_t fileId, const std::string& newFileState)
+{
+    const std::string &jobState = stored.jobState;
+
+    switch (stored.jobType) {
+        // Multiple replica job, on failure, need to pick next option
+        case Job::kTypeMultipleReplica:
+            if ((jobState != "CANCELED" && jobState != "FAILED") &&
+                (newFileState == "FAILED" || newFileState == "CANCELED")) {
+                sql.begin();
+                useFileReplica(sql, jobId, fileId, stored.destSurlUuid, stored.destSurlUuidInd);
+                sql.commit();
+            }
+            break;
+        // For multihop jobs, on success enable next option
+        case Job::kTypeMultiHop:
+            if ((jobState != "CANCELED" && jobState != "FAILED") &&
+                (newFileState == "FINISHED")) {
+                sql.begin();
+                useNextHop(sql, jobId);
+                sql.commit();
+            }
+            else {
+                // need to remove all dest_surl_uuid from all jobs
+                sql.begin();
+                setNullDestSURLMultiHop(sql, jobId);
+                sql.commit();
+            }
+            break;
+        // Nothing special for other type of jobs
+        default:
+            break;
+    }
+}
+
+
+bool MySqlAPI::updateJobStatus(const std::string& jobId, const std::string& jobState)
+{
+    soci::session sql(*connectionPool);
+    return updateJobTransferStatusInternal(sql, jobId, jobState);
+}
+
+
+bool MySqlAPI::updateJobTransferStatusInternal(soci::session& sql, std::string jobId, const std::string& state)
+{
+    try
+    {
+        int numberOfFilesInJob = 0;
+        int numberOfFilesCanceled = 0;
+        int numberOfFilesFinished = 0;
+        int numberOfFilesFailed = 0;
+        int numberOfStaging = 0;
+        int numberOfFilesArchiving = 0;
+
+        int numberOfFilesNotCanceled = 0;
+        int numberOfFilesNotCanceledNorFailed = 0;
+
+        std::string currentState("");
+        Job::JobType jobType;
+        soci::indicator isNull = soci::i_ok;
+        std::string sourceSe;
+        soci::indicator isNullFileId = soci::i_ok;
+
+        soci::statement stmt1 = (
+            sql.prepare << " SELECT job_state, job_type FROM t_job  "
+            " WHERE job_id = :job_id ",
+            soci::use(jobId),
+            soci::into(currentState),
+            soci::into(jobType, isNull));
+        stmt1.execute(true);
+
+        if(currentState == state)
+            return true;
+
+        if(currentState == "STAGING" && state == "STARTED")
+            return true;
+
+        if(jobType == Job::kTypeMultipleReplica && currentState == "ARCHIVING" && state == "FAILED") {
+            // FTS-1882: Fail multi-replica archiving jobs when archive monitoring step fails
+            std::string reason = "Archive monitoring failed in a multiple replica job";
+
+            sql <<  " SELECT source_se FROM t_file WHERE job_id=:job_id AND file_state='FAILED' LIMIT 1 ",
+            soci::use(jobId), soci::into(sourceSe);
 
 
             sql.begin();
@@ -1749,7 +1822,7 @@ void MySqlAPI::updateFileTransferProgressVector(const std::vector<fts3::events::
 }
 
 
-void MySqlAPI::getCancelJob(std::vector<int>& requestIDs)
+void MySqlAPI::getCancelJob(std::vector<std::pair<int, uint64_t>>& requestIDs)
 {
     soci::session sql(*connectionPool);
     int pid = 0;
@@ -1775,7 +1848,7 @@ void MySqlAPI::getCancelJob(std::vector<int>& requestIDs)
             file_id = row.get<unsigned long long>("file_id");
 
             if(pid > 0)
-                requestIDs.push_back(pid);
+                requestIDs.emplace_back(pid, file_id);
 
             stmt1.execute(true);
         }
@@ -2914,6 +2987,38 @@ static std::string int2str(uint64_t v) {
 }
 
 
+/// Join the ids as comma separated lists of at most STATE_UPDATE_BATCH elements each
+static std::vector<std::string> joinIdBatches(const std::vector<uint64_t> &ids)
+{
+    std::vector<std::string> batches;
+    for (size_t start = 0; start < ids.size(); start += STATE_UPDATE_BATCH) {
+        size_t end = std::min(start + STATE_UPDATE_BATCH, ids.size());
+        std::ostringstream batch;
+        for (size_t i = start; i < end; ++i) {
+            if (i != start) {
+                batch << ", ";
+            }
+            batch << ids[i];
+        }
+        batches.push_back(batch.str());
+    }
+    return batches;
+}
+
+
+/// Call update_state for each distinct (job, state), in order of appearance
+template <typename F>
+static void forEachJobState(const std::vector<std::pair<std::string, std::string> > &jobStates, F update_state)
+{
+    std::set<std::pair<std::string, std::string> > seen;
+    for (auto i = jobStates.begin(); i != jobStates.end(); ++i) {
+        if (seen.insert(*i).second) {
+            update_state(i->first, i->second);
+        }
+    }
+}
+
+
 void MySqlAPI::updateArchivingState(const std::vector<MinFileStatus>& archivingOpStatus)
 {
     soci::session sql(*connectionPool);
@@ -2980,25 +3085,38 @@ void MySqlAPI::updateArchivingStateInternal(soci::session& sql, const std::vecto
     // Updates to ARCHIVING state always lead to terminal state
     try
     {
+        StateGroups groups;
+        for (auto i = archivingOpStatus.begin(); i < archivingOpStatus.end(); ++i) {
+            groups[std::make_pair(i->state, i->reason)].push_back(i->fileId);
+        }
+
         sql.begin();
 
-        for (auto i = archivingOpStatus.begin(); i < archivingOpStatus.end(); ++i) {
-            sql <<
-                "UPDATE t_file "
-                "SET archive_finish_time = UTC_TIMESTAMP(), file_state = :fileState, reason = :reason "
-                "WHERE file_id = :fileId",
-                soci::use(i->state),
-                soci::use(i->reason),
-                soci::use(i->fileId);
+        for (auto group = groups.begin(); group != groups.end(); ++group) {
+            std::vector<std::string> batches = joinIdBatches(group->second);
+            for (auto batch = batches.begin(); batch != batches.end(); ++batch) {
+                sql <<
+                    "UPDATE t_file "
+                    "SET archive_finish_time = UTC_TIMESTAMP(), file_state = :fileState, reason = :reason "
+                    "WHERE file_id IN (" << *batch << ")",
+                    soci::use(group->first.first),
+                    soci::use(group->first.second);
+            }
         }
 
         sql.commit();
 
         Producer producer(ServerConfig::instance().get<std::string>("MessagingDirectory"));
 
+        std::vector<std::pair<std::string, std::string> > jobStates;
         for (auto i = archivingOpStatus.begin(); i < archivingOpStatus.end(); ++i) {
-            updateJobTransferStatusInternal(sql, i->jobId, i->state);
+            jobStates.emplace_back(i->jobId, i->state);
+        }
+        forEachJobState(jobStates, [&](const std::string &jobId, const std::string &state) {
+            updateJobTransferStatusInternal(sql, jobId, state);
+        });
 
+        for (auto i = archivingOpStatus.begin(); i < archivingOpStatus.end(); ++i) {
             // Send monitoring state message
             std::vector<TransferState> filesMsg = getStateOfTransferInternal(sql, i->jobId, i->fileId);
 
@@ -3087,51 +3205,91 @@ void MySqlAPI::updateBringOnlineToken(std::map< std::string, std::map<std::strin
 void MySqlAPI::updateDeletionsStateInternal(soci::session& sql, const std::vector<MinFileStatus>& delOpsStatus)
 {
     std::vector<TransferState> filesMsg;
-    std::vector<std::string> distinctJobIds;
+    std::set<std::string> distinctJobIds;
 
     try
     {
-        sql.begin();
+        std::vector<uint64_t> started;
+        std::vector<const MinFileStatus*> retriable;
+        StateGroups terminal;
 
         for (auto i = delOpsStatus.begin(); i < delOpsStatus.end(); ++i)
         {
-            if (i->state == "STARTED")
-            {
-                sql <<
-                    " UPDATE t_dm "
-                    " SET start_time = UTC_TIMESTAMP(), dmHost=:thost, file_state='STARTED' "
-                    " WHERE  "
-                    "   file_id= :fileId ",
-                    soci::use(hostname),
-                    soci::use(i->fileId)
-                    ;
+            if (i->state == "STARTED") {
+                started.push_back(i->fileId);
+            }
+            else if (i->state == "FAILED" && i->retry) {
+                retriable.push_back(&(*i));
+            }
+            else {
+                terminal[std::make_pair(i->state, i->reason)].push_back(i->fileId);
+            }
+        }
+
+        sql.begin();
+
+        std::vector<std::string> batches = joinIdBatches(started);
+        for (auto batch = batches.begin(); batch != batches.end(); ++batch)
+        {
+            sql <<
+                " UPDATE t_dm "
+                " SET start_time = UTC_TIMESTAMP(), dmHost=:thost, file_state='STARTED' "
+                " WHERE  "
+                "   file_id IN (" << *batch << ")",
+                soci::use(hostname)
+                ;
+        }
+
+        // Failures that can be retried go back to DELETE, grouped by (delay, retry)
+        std::map<uint64_t, RetryAttempt> attempts = getRetryAttempts(sql, "t_dm", retriable);
+        std::map<std::pair<int, int>, std::vector<uint64_t> > retries;
+
+        for (auto i = retriable.begin(); i != retriable.end(); ++i)
+        {
+            auto attempt = attempts.find((*i)->fileId);
+            if (attempt == attempts.end()) {
+                terminal[std::make_pair((*i)->state, (*i)->reason)].push_back((*i)->fileId);
             }
-            else if(i->state == "FAILED")
+            else {
+                retries[std::make_pair(attempt->second.delay, attempt->second.maxRetries + 1)].push_back((*i)->fileId);
+            }
+        }
+
+        for (auto retry = retries.begin(); retry != retries.end(); ++retry)
+        {
+            int retryDelay = retry->first.first;
+            int retryCount = retry->first.second;
+
+            time_t now = getUTC(retryDelay > 0 ? retryDelay : DEFAULT_RETRY_DELAY);
+            struct tm tTime;
+            gmtime_r(&now, &tTime);
+
+            // With the default delay, files already back in SUBMITTED are not touched
+            const char *skipStates = retryDelay > 0 ?
+                "'FINISHED','DELETE','FAILED','CANCELED'" :
+                "'FINISHED','SUBMITTED','FAILED','CANCELED'";
+
+            batches = joinIdBatches(retry->second);
+            for (auto batch = batches.begin(); batch != batches.end(); ++batch)
             {
-                bool shouldBeRetried = resetForRetryDelete(sql, i->fileId, i->jobId, i->retry);
-                if (!shouldBeRetried)
-                {
-                    sql <<
-                        " UPDATE t_dm "
-                        " SET  job_finished=UTC_TIMESTAMP(), finish_time=UTC_TIMESTAMP(), reason = :reason, file_state = :fileState "
-                        " WHERE "
-                        "   file_id = :fileId ",
-                        soci::use(i->reason),
-                        soci::use(i->state),
-                        soci::use(i->fileId)
-                        ;
-                }
+                sql << "UPDATE t_dm SET retry_timestamp=:1, retry = :retry, file_state = 'DELETE', start_time=NULL, dmHost=NULL "
+                    " WHERE file_id IN (" << *batch << ") AND file_state NOT IN (" << skipStates << ")",
+                    soci::use(tTime), soci::use(retryCount);
             }
-            else
+        }
+
+        for (auto group = terminal.begin(); group != terminal.end(); ++group)
+        {
+            batches = joinIdBatches(group->second);
+            for (auto batch = batches.begin(); batch != batches.end(); ++batch)
             {
                 sql <<
                     " UPDATE t_dm "
                     " SET  job_finished=UTC_TIMESTAMP(), finish_time=UTC_TIMESTAMP(), reason = :reason, file_state = :fileState "
                     " WHERE "
-                    "   file_id = :fileId ",
-                    soci::use(i->reason),
-                    soci::use(i->state),
-                    soci::use(i->fileId)
+                    "   file_id IN (" << *batch << ")",
+                    soci::use(group->first.second),
+                    soci::use(group->first.first)
                     ;
             }
         }
@@ -3143,14 +3301,10 @@ void MySqlAPI::updateDeletionsStateInternal(soci::session& sql, const std::vecto
         for (auto i = delOpsStatus.begin(); i < delOpsStatus.end(); ++i)
         {
             //prevent multiple times of updating the same job id
-            if (std::find(distinctJobIds.begin(), distinctJobIds.end(), i->jobId) != distinctJobIds.end())
+            if (!distinctJobIds.insert(i->jobId).second)
             {
                 continue;
             }
-            else
-            {
-                distinctJobIds.push_back(i->jobId);
-            }
 
             //now update job state
             long long numberOfFilesCanceled = 0;
@@ -3739,177 +3893,151 @@ void MySqlAPI::updateFileStateToQosTerminal(const std::string& jobId, uint64_t f
 void MySqlAPI::getFilesForStaging(std::vector<StagingOperation> &stagingOps)
 {
     soci::session sql(*connectionPool);
-    std::vector<fts3::events::MessageBringonline> messages;
 
-    int maxStagingBulkSize = ServerConfig::instance().get<int>("StagingBulkSize");
-    int stagingWaitingFactor = ServerConfig::instance().get<int>("StagingWaitingFactor");
-    int maxStagingConcurrentRequests = ServerConfig::instance().get<int>("StagingConcurrentRequests");
+    StagingConfig stagingConfig;
+    stagingConfig.bulkSize = ServerConfig::instance().get<int>("StagingBulkSize");
+    stagingConfig.waitingFactor = ServerConfig::instance().get<int>("StagingWaitingFactor");
+    stagingConfig.concurrentRequests = ServerConfig::instance().get<int>("StagingConcurrentRequests");
+    int defaultBringOnlineTimeout = ServerConfig::instance().get<int>("DefaultBringOnlineTimeout");
+    int defaultCopyPinLifetime = ServerConfig::instance().get<int>("DefaultCopyPinLifetime");
+
+    typedef std::pair<std::string, std::string> VoEndpoint;
 
     try
     {
-        //now get fresh states/files from the database
-        soci::rowset<soci::row> rs2 = (sql.prepare <<
-            " SELECT DISTINCT vo_name, source_se "
+        // Configured limits for all endpoints
+        StagingLimits stagingLimits;
+        soci::rowset<soci::row> rsLimits = (sql.prepare <<
+            " SELECT vo_name, host, concurrent_ops FROM t_stage_req "
+            " WHERE operation = 'staging' AND concurrent_ops IS NOT NULL "
+        );
+        for (auto i = rsLimits.begin(); i != rsLimits.end(); ++i)
+        {
+            stagingLimits.addConcurrentOps(i->get<std::string>("vo_name"), i->get<std::string>("host"),
+                i->get<int>("concurrent_ops", 0));
+        }
+
+        // Queued and active counts for every (vo, source_se) with files staging, in a single grouped query.
+        // idx_staging narrows down the rows, but hashed_id and bringonline_token are read from the table.
+        soci::rowset<soci::row> rsCounts = (sql.prepare <<
+            " SELECT vo_name, source_se, "
+            "   COUNT(CASE WHEN file_state = 'STAGING' AND hashed_id BETWEEN :hStart AND :hEnd THEN 1 END) AS segment_staging, "
+            "   COUNT(CASE WHEN file_state = 'STAGING' THEN 1 END) AS queued, "
+            "   COUNT(CASE WHEN file_state = 'STARTED' THEN 1 END) AS started, "
+            "   COUNT(DISTINCT CASE WHEN file_state = 'STARTED' THEN bringonline_token END) AS active_requests "
             " FROM t_file "
-            " WHERE "
-            "      file_state = 'STAGING' AND "
-            "      (hashed_id >= :hStart AND hashed_id <= :hEnd)  ",
+            " WHERE file_state IN ('STAGING', 'STARTED') "
+            " GROUP BY vo_name, source_se "
+            " ORDER BY vo_name, source_se ",
             soci::use(hashSegment.start), soci::use(hashSegment.end)
         );
 
-        for (auto i2 = rs2.begin(); i2 != rs2.end(); ++i2)
-        {
-            soci::row const& r = *i2;
-            std::string source_se = r.get<std::string>("source_se","");
-            std::string vo_name = r.get<std::string>("vo_name","");
-
-            int maxValueConfig = 0;
-            int currentStagingActive = 0;
-            int limit = 0;
+        // How many files can be picked for each endpoint
+        // Keys in lower case, since the grouping is case insensitive
+        std::map<VoEndpoint, int> limits;
+        auto now = boost::posix_time::second_clock::local_time();
 
-            //check max configured
-            sql <<  "SELECT concurrent_ops FROM t_stage_req "
-                "WHERE vo_name=:vo_name AND host = :endpoint AND operation='staging' AND concurrent_ops IS NOT NULL ",
-                soci::use(vo_name), soci::use(source_se), soci::into(maxValueConfig);
-            if (maxValueConfig <= 0) {
-                sql <<  "SELECT concurrent_ops FROM t_stage_req "
-                    "WHERE vo_name=:vo_name AND host = '*' AND operation='staging' AND concurrent_ops IS NOT NULL ",
-                    soci::use(vo_name), soci::into(maxValueConfig);
-            }
+        for (auto i = rsCounts.begin(); i != rsCounts.end(); ++i)
+        {
+            if (i->get<long long>("segment_staging") == 0)
+                continue;
 
-            if(maxValueConfig > 0)
-            {
-                //check current staging
-                sql <<  "SELECT count(*) FROM t_file "
-                    "WHERE vo_name=:vo_name AND source_se = :endpoint AND file_state='STARTED'",
-                    soci::use(vo_name), soci::use(source_se), soci::into(currentStagingActive);
+            std::string vo_name = i->get<std::string>("vo_name", "");
+            std::string source_se = i->get<std::string>("source_se", "");
 
-                if(currentStagingActive > 0)
-                {
-                    limit = maxValueConfig - currentStagingActive;
-                }
-                else
-                {
-                    limit = maxValueConfig;
-                }
+            StagingState state;
+            state.started = static_cast<int>(i->get<long long>("started"));
+            state.activeRequests = static_cast<int>(i->get<long long>("active_requests"));
+            state.queued = static_cast<int>(i->get<long long>("queued"));
 
-                if(limit <= 0)
-                    continue;
-            }
-            else
-            {
-                limit = maxStagingBulkSize; // Use a sensible default
+            int limit = planStaging(source_se, state, stagingLimits.getConcurrentOps(vo_name, source_se),
+                stagingConfig, queuedStagingFiles, now);
+            if (limit > 0) {
+                limits[VoEndpoint(boost::algorithm::to_lower_copy(vo_name),
+                    boost::algorithm::to_lower_copy(source_se))] = limit;
             }
+        }
 
-            // Make sure we do not grab more than the limit for a bulk
-            if (limit > maxStagingBulkSize)
-                limit = maxStagingBulkSize;
-
-            //now check for max concurrent active requests, must no exceed the limit
-            int countActiveRequests = 0;
-            sql << " SELECT COUNT(distinct bringonline_token) FROM t_file where "
-                " vo_name=:vo_name AND file_state='STARTED' AND source_se=:source_se AND bringonline_token IS NOT NULL ",
-                soci::use(vo_name), soci::use(source_se), soci::into(countActiveRequests);
+        if (limits.empty())
+            return;
 
-            if(countActiveRequests > maxStagingConcurrentRequests)
-                continue;
+        // Up to limit files per (vo, source_se, cred_id), several selects per round-trip
+        soci::rowset<soci::row> rsCreds = (sql.prepare <<
+            " SELECT DISTINCT f.vo_name, f.source_se, j.cred_id "
+            " FROM t_file f INNER JOIN t_job j ON (f.job_id = j.job_id) "
+            " WHERE "
+            "  f.file_state = 'STAGING' "
+            "  AND (f.hashed_id >= :hStart AND f.hashed_id <= :hEnd)",
+            soci::use(hashSegment.start), soci::use(hashSegment.end)
+        );
 
-            //now make sure there are enough files to put in a single request
-            int countQueuedFiles = 0;
-            sql << " SELECT COUNT(*) FROM t_file WHERE vo_name=:vo_name AND source_se=:source_se AND file_state='STAGING' ",
-                soci::use(vo_name), soci::use(source_se), soci::into(countQueuedFiles);
+        std::vector<std::string> selects;
+        for (auto i = rsCreds.begin(); i != rsCreds.end(); ++i)
+        {
+            std::string vo_name = i->get<std::string>("vo_name", "");
+            std::string source_se = i->get<std::string>("source_se", "");
 
+            auto limit = limits.find(VoEndpoint(boost::algorithm::to_lower_copy(vo_name),
+                boost::algorithm::to_lower_copy(source_se)));
+            if (limit == limits.end())
+                continue;
 
-            // If we haven't got enough for a bulk request, give some time for more
-            // requests to arrive
-            if(countQueuedFiles < maxStagingBulkSize)
-            {
-                auto now = boost::posix_time::second_clock::local_time();
-                auto itQueue = queuedStagingFiles.find(source_se);
+            std::ostringstream select;
+            select <<
+                "SELECT f.source_surl, f.staging_metadata, f.job_id, f.file_id, "
+                "   j.copy_pin_lifetime, j.bring_online, j.cred_id, j.user_dn, j.source_space_token, "
+                "   " << sqlQuote(sql, vo_name) << " AS sched_vo_name "
+                "FROM t_file f JOIN t_job j ON f.job_id = j.job_id "
+                "WHERE "
+                "   f.file_state = 'STAGING'"
+                "   AND f.hashed_id BETWEEN " << hashSegment.start << " AND " << hashSegment.end <<
+                "   AND f.source_se = " << sqlQuote(sql, source_se) <<
+                "   AND j.cred_id = " << sqlQuote(sql, i->get<std::string>("cred_id")) <<
+                "   AND j.vo_name = " << sqlQuote(sql, vo_name) <<
+                " LIMIT " << limit->second;
+            selects.push_back(select.str());
+        }
 
-                if(itQueue != queuedStagingFiles.end())
-                {
-                    auto nextSubmission = itQueue->second;
+        for (size_t batchStart = 0; batchStart < selects.size(); batchStart += STAGING_UNION_BATCH)
+        {
+            size_t batchEnd = std::min(batchStart + STAGING_UNION_BATCH, selects.size());
 
-                    if(nextSubmission > now) {
-                        continue;
-                    }
-                    queuedStagingFiles.erase(itQueue);
-                }
-                else
-                {
-                    queuedStagingFiles[source_se] = now + boost::posix_time::seconds(stagingWaitingFactor);
-                    continue;
+            std::ostringstream query;
+            for (size_t i = batchStart; i < batchEnd; ++i) {
+                if (i != batchStart) {
+                    query << " UNION ALL ";
                 }
+                query << "(" << selects[i] << ")";
             }
 
+            soci::rowset<soci::row> rs = (sql.prepare << query.str());
 
-            soci::rowset<soci::row> rs = (
-                                             sql.prepare <<
-                                             " SELECT DISTINCT f.source_se, j.cred_id "
-                                             " FROM t_file f INNER JOIN t_job j ON (f.job_id = j.job_id) "
-                                             " WHERE "
-                                             "  f.file_state = 'STAGING' "
-                                             "  AND (f.hashed_id >= :hStart AND f.hashed_id <= :hEnd)"
-                                             "  AND f.vo_name = :vo_name AND f.source_se=:source_se ",
-                                             soci::use(hashSegment.start), soci::use(hashSegment.end),
-                                             soci::use(vo_name), soci::use(source_se)
-                                         );
-
-            for (soci::rowset<soci::row>::const_iterator i = rs.begin(); i != rs.end(); ++i)
+            for (auto i = rs.begin(); i != rs.end(); ++i)
             {
                 soci::row const& row = *i;
-
-                source_se = row.get<std::string>("source_se");
+                std::string source_url = row.get<std::string>("source_surl");
+                std::string metadata = row.get<std::string>("staging_metadata", "");
+                std::string job_id = row.get<std::string>("job_id");
+                uint64_t file_id = row.get<unsigned long long>("file_id");
+                int copy_pin_lifetime = row.get<int>("copy_pin_lifetime",0);
+                int bring_online = row.get<int>("bring_online",0);
+
+                if(copy_pin_lifetime > 0 && bring_online <= 0)
+                    bring_online = defaultBringOnlineTimeout;
+                else if (bring_online > 0 && copy_pin_lifetime <= 0)
+                    copy_pin_lifetime = defaultCopyPinLifetime;
+
+                std::string vo_name = row.get<std::string>("sched_vo_name");
+                std::string user_dn = row.get<std::string>("user_dn");
                 std::string cred_id = row.get<std::string>("cred_id");
+                std::string source_space_token = row.get<std::string>("source_space_token", "");
 
-                soci::rowset<soci::row> rs3 = (sql.prepare <<
-                    "SELECT f.source_surl, f.staging_metadata, f.job_id, f.file_id,"
-                    "   j.copy_pin_lifetime, j.bring_online, j.cred_id, j.user_dn, j.source_space_token "
-                    "FROM t_file f JOIN t_job j ON f.job_id = j.job_id "
-                    "WHERE "
-                    "   f.file_state = 'STAGING'"
-                    "   AND f.hashed_id BETWEEN :hStart AND :hEnd "
-                    "   AND f.source_se=:source_se "
-                    "   AND j.cred_id=:cred_id "
-                    "   AND j.vo_name=:vo_name "
-                    "LIMIT :limit",
-                    soci::use(hashSegment.start), soci::use(hashSegment.end),
-                    soci::use(source_se),
-                    soci::use(cred_id),
-                    soci::use(vo_name),
-                    soci::use(limit)
+                stagingOps.emplace_back(
+                    job_id, file_id, vo_name,
+                    user_dn, cred_id, source_url, metadata,
+                    copy_pin_lifetime, bring_online, 0,
+                    source_space_token, std::string()
                 );
-
-                std::string initState = "STARTED";
-                std::string reason;
-
-                for (soci::rowset<soci::row>::const_iterator i3 = rs3.begin(); i3 != rs3.end(); ++i3)
-                {
-                    soci::row const& row = *i3;
-                    std::string source_url = row.get<std::string>("source_surl");
-                    std::string metadata = row.get<std::string>("staging_metadata", "");
-                    std::string job_id = row.get<std::string>("job_id");
-                    uint64_t file_id = row.get<unsigned long long>("file_id");
-                    int copy_pin_lifetime = row.get<int>("copy_pin_lifetime",0);
-                    int bring_online = row.get<int>("bring_online",0);
-
-                    if(copy_pin_lifetime > 0 && bring_online <= 0)
-                        bring_online = ServerConfig::instance().get<int>("DefaultBringOnlineTimeout");
-                    else if (bring_online > 0 && copy_pin_lifetime <= 0)
-                        copy_pin_lifetime = ServerConfig::instance().get<int>("DefaultCopyPinLifetime");
-
-                    std::string user_dn = row.get<std::string>("user_dn");
-                    std::string cred_id = row.get<std::string>("cred_id");
-                    std::string source_space_token = row.get<std::string>("source_space_token", "");
-
-                    stagingOps.emplace_back(
-                        job_id, file_id, vo_name,
-                        user_dn, cred_id, source_url, metadata,
-                        copy_pin_lifetime, bring_online, 0,
-                        source_space_token, std::string()
-                    );
-                }
             }
         }
     }
@@ -3987,6 +4115,74 @@ void MySqlAPI::getAlreadyStartedArchiving(std::vector<ArchivingOperation> &archi
 }
 
 
+void MySqlAPI::getStagingDurations(std::map<std::string, std::vector<time_t>> &durations, time_t window)
+{
+    soci::session sql(*connectionPool);
+    long long windowSeconds = window;
+
+    try
+    {
+        // Files staged for a transfer go back to SUBMITTED, and then follow the transfer states.
+        // Only those already done are sampled: finish_time is indexed, and comes after staging_finished.
+        soci::rowset<soci::row> rs = (sql.prepare <<
+            " SELECT source_se, TIMESTAMPDIFF(SECOND, staging_start, staging_finished) AS duration "
+            " FROM t_file USE INDEX(idx_finish_time) "
+            " WHERE finish_time > (UTC_TIMESTAMP() - INTERVAL :window SECOND) "
+            "   AND staging_start IS NOT NULL AND staging_finished >= staging_start "
+            "   AND file_state IN ('FINISHED', 'ARCHIVING') ",
+            soci::use(windowSeconds)
+        );
+
+        for (auto i = rs.begin(); i != rs.end(); ++i) {
+            durations[i->get<std::string>("source_se", "")].push_back(i->get<long long>("duration"));
+        }
+    }
+    catch (std::exception& e)
+    {
+        throw UserError(std::string(__func__) + ": Caught exception " + e.what());
+    }
+    catch (...)
+    {
+        throw UserError(std::string(__func__) + ": Caught exception ");
+    }
+}
+
+
+void MySqlAPI::getArchivingDurations(std::map<std::string, std::vector<time_t>> &durations, time_t window)
+{
+    soci::session sql(*connectionPool);
+    long long windowSeconds = window;
+    long long lookbackSeconds = 2 * windowSeconds;
+
+    try
+    {
+        // Archiving starts when the transfer finishes. Bound the scan by the indexed finish_time,
+        // allowing the archiving up to one more window to complete.
+        soci::rowset<soci::row> rs = (sql.prepare <<
+            " SELECT dest_se, TIMESTAMPDIFF(SECOND, archive_start_time, archive_finish_time) AS duration "
+            " FROM t_file USE INDEX(idx_finish_time) "
+            " WHERE finish_time > (UTC_TIMESTAMP() - INTERVAL :lookback SECOND) "
+            "   AND archive_finish_time > (UTC_TIMESTAMP() - INTERVAL :window SECOND) "
+            "   AND archive_start_time IS NOT NULL AND archive_finish_time >= archive_start_time "
+            "   AND file_state = 'FINISHED' ",
+            soci::use(lookbackSeconds), soci::use(windowSeconds)
+        );
+
+        for (auto i = rs.begin(); i != rs.end(); ++i) {
+            durations[i->get<std::string>("dest_se", "")].push_back(i->get<long long>("duration"));
+        }
+    }
+    catch (std::exception& e)
+    {
+        throw UserError(std::string(__func__) + ": Caught exception " + e.what());
+    }
+    catch (...)
+    {
+        throw UserError(std::string(__func__) + ": Caught exception ");
+    }
+}
+
+
 void MySqlAPI::getAlreadyStartedStaging(std::vector<StagingOperation> &stagingOps)
 {
     soci::session sql(*connectionPool);
@@ -4084,155 +4280,217 @@ void MySqlAPI::updateStagingStateInternal(soci::session& sql, const std::vector<
 
     try
     {
+        std::vector<uint64_t> started;
+        std::vector<const MinFileStatus*> retriable;
+        std::vector<const MinFileStatus*> completed;
+
+        for (auto i = stagingOpsStatus.begin(); i < stagingOpsStatus.end(); ++i)
+        {
+            if (i->state == "STARTED") {
+                started.push_back(i->fileId);
+            }
+            else if (i->state == "FAILED" && i->retry) {
+                retriable.push_back(&(*i));
+            }
+            else {
+                completed.push_back(&(*i));
+            }
+        }
 
         sql.begin();
 
-        for (auto i = stagingOpsStatus.begin(); i < stagingOpsStatus.end(); ++i)
+        std::vector<std::string> batches = joinIdBatches(started);
+        for (auto batch = batches.begin(); batch != batches.end(); ++batch)
         {
-            if (i->state == "STARTED")
-            {
-                sql <<
-                    " UPDATE t_file "
-                    " SET start_time = UTC_TIMESTAMP(),staging_start=UTC_TIMESTAMP(), staging_host=:thost, "
-                    "   transfer_host=:thost, file_state='STARTED' "
-                    " WHERE  "
-                    "   file_id= :fileId "
-                    "   AND file_state='STAGING'",
-                    soci::use(hostname),
-                    soci::use(hostname),
-                    soci::use(i->fileId)
-                    ;
+            sql <<
+                " UPDATE t_file "
+                " SET start_time = UTC_TIMESTAMP(),staging_start=UTC_TIMESTAMP(), staging_host=:thost, "
+                "   transfer_host=:thost, file_state='STARTED' "
+                " WHERE  "
+                "   file_id IN (" << *batch << ") "
+                "   AND file_state='STAGING'",
+                soci::use(hostname),
+                soci::use(hostname)
+                ;
+        }
+
+        // Failures that can be retried go back to STAGING, grouped by (delay, retry),
+        // and their errors are kept in t_file_retry_errors
+        std::map<uint64_t, RetryAttempt> attempts = getRetryAttempts(sql, "t_file", retriable);
+        std::map<std::pair<int, int>, std::vector<uint64_t> > retries;
+        std::vector<std::string> retryErrors;
+
+        for (auto i = retriable.begin(); i != retriable.end(); ++i)
+        {
+            auto attempt = attempts.find((*i)->fileId);
+            if (attempt == attempts.end()) {
+                completed.push_back(*i);
+                continue;
             }
-            else if(i->state == "FAILED")
-            {
-                bool shouldBeRetried = i->retry;
 
-                if(i->retry)
-                {
-                    int times = 0;
-                    shouldBeRetried = resetForRetryStaging(sql, i->fileId, i->jobId, i->retry, times);
-                    if(shouldBeRetried)
-                    {
-                        if(times > 0)
-                        {
-                            sql << "INSERT IGNORE INTO t_file_retry_errors "
-                                "    (file_id, attempt, datetime, reason) "
-                                "VALUES (:fileId, :attempt, UTC_TIMESTAMP(), :reason)",
-                                soci::use(i->fileId), soci::use(times), soci::use(i->reason);
-                        }
+            int times = attempt->second.previous + 1;
+            int retryDelay = attempt->second.delay > 0 ? attempt->second.delay : DEFAULT_RETRY_DELAY;
+            retries[std::make_pair(retryDelay, times)].push_back((*i)->fileId);
 
-                        continue;
-                    }
-                }
+            if (times > 0) {
+                std::ostringstream row;
+                row << "(" << (*i)->fileId << ", " << times << ", UTC_TIMESTAMP(), " << sqlQuote(sql, (*i)->reason) << ")";
+                retryErrors.push_back(row.str());
+            }
+        }
 
-                if (!i->retry || !shouldBeRetried)
-                {
-                    sql <<
-                        " UPDATE t_file "
-                        " SET finish_time=UTC_TIMESTAMP(), staging_finished=UTC_TIMESTAMP(), reason = :reason, file_state = :fileState, dest_surl_uuid = NULL "
-                        " WHERE "
-                        "   file_id = :fileId "
-                        "   AND file_state in ('STAGING','STARTED')",
-                        soci::use(i->reason),
-                        soci::use(i->state),
-                        soci::use(i->fileId)
-                        ;
+        for (auto retry = retries.begin(); retry != retries.end(); ++retry)
+        {
+            time_t now = getUTC(retry->first.first);
+            struct tm tTime;
+            gmtime_r(&now, &tTime);
+
+            batches = joinIdBatches(retry->second);
+            for (auto batch = batches.begin(); batch != batches.end(); ++batch)
+            {
+                sql << "UPDATE t_file SET retry_timestamp=:1, retry = :retry, file_state = 'STAGING', start_time=NULL, staging_start=NULL, transfer_host=NULL, log_file=NULL,"
+                    " log_file_debug=NULL, throughput = 0, current_failures = 1 "
+                    " WHERE file_id IN (" << *batch << ") AND file_state NOT IN ('FINISHED','STAGING','FAILED','CANCELED')",
+                    soci::use(tTime), soci::use(retry->first.second);
+            }
+        }
+
+        for (size_t start = 0; start < retryErrors.size(); start += STATE_UPDATE_BATCH)
+        {
+            size_t end = std::min(start + STATE_UPDATE_BATCH, retryErrors.size());
+            std::ostringstream insert;
+            insert << "INSERT IGNORE INTO t_file_retry_errors "
+                "    (file_id, attempt, datetime, reason) "
+                "VALUES ";
+            for (size_t i = start; i < end; ++i) {
+                if (i != start) {
+                    insert << ", ";
                 }
+                insert << retryErrors[i];
             }
-            else
-            {
-                std::string dbState;
-                std::string dbReason;
-                int stage_in_only = 0;
+            sql << insert.str();
+        }
 
-                sql << "select count(*) from t_file where file_id=:file_id and source_surl=dest_surl",
-                    soci::use(i->fileId),
-                    soci::into(stage_in_only);
+        // Finished files of stage-in only jobs (source == destination) are terminal,
+        // otherwise they go to SUBMITTED for the transfer
+        std::vector<uint64_t> finished;
+        for (auto i = completed.begin(); i != completed.end(); ++i) {
+            if ((*i)->state == "FINISHED") {
+                finished.push_back((*i)->fileId);
+            }
+        }
 
-                if(stage_in_only == 0)  //stage-in and transfer
-                {
-                    dbState = i->state == "FINISHED" ? "SUBMITTED" : i->state;
-                    dbReason = i->state == "FINISHED" ? std::string() : i->reason;
-                }
-                else //stage-in only
-                {
-                    dbState = i->state == "FINISHED" ? "FINISHED" : i->state;
-                    dbReason = i->state == "FINISHED" ? std::string() : i->reason;
-
-                    // Find out job type
-                    Job::JobType jobType;
-                    sql << "SELECT job_type FROM t_job WHERE job_id = :job_id",
-                        soci::use(i->jobId),
-                        soci::into(jobType);
-
-                    // Trigger next hop after stage-in only operation
-                    if (dbState == "FINISHED" && jobType == Job::kTypeMultiHop) {
-                        useNextHop(sql, i->jobId);
-                    }
-                }
+        std::set<uint64_t> stageInOnly;
+        batches = joinIdBatches(finished);
+        for (auto batch = batches.begin(); batch != batches.end(); ++batch)
+        {
+            soci::rowset<soci::row> rs = (sql.prepare <<
+                "SELECT file_id FROM t_file WHERE file_id IN (" << *batch << ") AND source_surl = dest_surl");
+            for (auto i = rs.begin(); i != rs.end(); ++i) {
+                stageInOnly.insert(i->get<unsigned long long>("file_id"));
+            }
+        }
 
-                if(dbState == "SUBMITTED")
-                {
-                    unsigned hashedId = getHashedId();
-
-                    sql <<
-                        " UPDATE t_file "
-                        " SET hashed_id = :hashed_id, staging_finished=UTC_TIMESTAMP(), finish_time=NULL, start_time=NULL, transfer_host=NULL, reason = '', file_state = :fileState "
-                        " WHERE "
-                        "   file_id = :fileId "
-                        "   AND file_state in ('STAGING','STARTED')",
-                        soci::use(hashedId),
-                        soci::use(dbState),
-                        soci::use(i->fileId)
-                        ;
+        std::set<std::string> stageInOnlyJobs;
+        for (auto i = completed.begin(); i != completed.end(); ++i) {
+            if ((*i)->state == "FINISHED" && stageInOnly.count((*i)->fileId)) {
+                stageInOnlyJobs.insert((*i)->jobId);
+            }
+        }
+
+        std::set<std::string> multiHopJobs;
+        if (!stageInOnlyJobs.empty())
+        {
+            soci::rowset<soci::row> rs = (sql.prepare <<
+                "SELECT job_id, job_type FROM t_job WHERE job_id IN (" << sqlQuoteList(sql, stageInOnlyJobs) << ")");
+            for (auto i = rs.begin(); i != rs.end(); ++i) {
+                if (i->get<Job::JobType>("job_type", Job::kTypeRegular) == Job::kTypeMultiHop) {
+                    multiHopJobs.insert(i->get<std::string>("job_id"));
                 }
-                else if(dbState == "FINISHED")
-                {
-                    sql <<
-                        " UPDATE t_file "
-                        " SET staging_finished=UTC_TIMESTAMP(), finish_time=UTC_TIMESTAMP(), reason = :reason, file_state = :fileState, dest_surl_uuid = NULL "
-                        " WHERE "
-                        "   file_id = :fileId "
-                        "   AND file_state in ('STAGING','STARTED')",
-                        soci::use(dbReason),
-                        soci::use(dbState),
-                        soci::use(i->fileId)
-                        ;
+            }
+        }
+
+        std::vector<uint64_t> submitted;
+        StateGroups terminal;
+
+        for (auto i = completed.begin(); i != completed.end(); ++i)
+        {
+            if ((*i)->state == "SUBMITTED") {
+                submitted.push_back((*i)->fileId);
+            }
+            else if ((*i)->state != "FINISHED") {
+                terminal[std::make_pair((*i)->state, (*i)->reason)].push_back((*i)->fileId);
+            }
+            else if (stageInOnly.count((*i)->fileId) == 0) {
+                submitted.push_back((*i)->fileId);
+            }
+            else {
+                // Trigger next hop after stage-in only operation
+                if (multiHopJobs.count((*i)->jobId)) {
+                    useNextHop(sql, (*i)->jobId);
                 }
-                else
-                {
-                    sql <<
-                        " UPDATE t_file "
-                        " SET staging_finished=UTC_TIMESTAMP(), finish_time=UTC_TIMESTAMP(), reason = :reason, file_state = :fileState, dest_surl_uuid = NULL "
-                        " WHERE "
-                        "   file_id = :fileId "
-                        "   AND file_state in ('STAGING','STARTED')",
-                        soci::use(dbReason),
-                        soci::use(dbState),
-                        soci::use(i->fileId)
-                        ;
+                terminal[std::make_pair("FINISHED", std::string())].push_back((*i)->fileId);
+            }
+        }
+
+        // Each file resubmitted for transfer gets a new random hashed_id
+        for (size_t start = 0; start < submitted.size(); start += STATE_UPDATE_BATCH)
+        {
+            size_t end = std::min(start + STATE_UPDATE_BATCH, submitted.size());
+            std::ostringstream hashedIds, fileIds;
+            for (size_t i = start; i < end; ++i) {
+                hashedIds << " WHEN " << submitted[i] << " THEN " << getHashedId();
+                if (i != start) {
+                    fileIds << ", ";
                 }
+                fileIds << submitted[i];
+            }
+
+            sql <<
+                " UPDATE t_file "
+                " SET hashed_id = CASE file_id " << hashedIds.str() << " END, "
+                "   staging_finished=UTC_TIMESTAMP(), finish_time=NULL, start_time=NULL, transfer_host=NULL, reason = '', file_state = 'SUBMITTED' "
+                " WHERE "
+                "   file_id IN (" << fileIds.str() << ") "
+                "   AND file_state in ('STAGING','STARTED')";
+        }
+
+        for (auto group = terminal.begin(); group != terminal.end(); ++group)
+        {
+            batches = joinIdBatches(group->second);
+            for (auto batch = batches.begin(); batch != batches.end(); ++batch)
+            {
+                sql <<
+                    " UPDATE t_file "
+                    " SET staging_finished=UTC_TIMESTAMP(), finish_time=UTC_TIMESTAMP(), reason = :reason, file_state = :fileState, dest_surl_uuid = NULL "
+                    " WHERE "
+                    "   file_id IN (" << *batch << ") "
+                    "   AND file_state in ('STAGING','STARTED')",
+                    soci::use(group->first.second),
+                    soci::use(group->first.first)
+                    ;
             }
         }
+
         sql.commit();
 
+        std::vector<std::pair<std::string, std::string> > jobStates;
         for (auto i = stagingOpsStatus.begin(); i < stagingOpsStatus.end(); ++i)
         {
-            if(i->state == "SUBMITTED")
-                updateJobTransferStatusInternal(sql, i->jobId, "ACTIVE");
-            else
-                updateJobTransferStatusInternal(sql, i->jobId, i->state);
+            jobStates.emplace_back(i->jobId, i->state == "SUBMITTED" ? "ACTIVE" : i->state);
+        }
+        forEachJobState(jobStates, [&](const std::string &jobId, const std::string &state) {
+            updateJobTransferStatusInternal(sql, jobId, state);
+        });
 
+        Producer producer(ServerConfig::instance().get<std::string>("MessagingDirectory"));
+        for (auto i = stagingOpsStatus.begin(); i < stagingOpsStatus.end(); ++i)
+        {
             //send state message
             filesMsg = getStateOfTransferInternal(sql, i->jobId, i->fileId);
-            if(!filesMsg.empty())
+            for (auto it = filesMsg.begin(); it != filesMsg.end(); ++it)
             {
-                Producer producer(ServerConfig::instance().get<std::string>("MessagingDirectory"));
-                for (auto it = filesMsg.begin(); it != filesMsg.end(); ++it)
-                {
-                    TransferState tmp = (*it);
-                    MsgIfce::getInstance()->SendTransferStatusChange(producer, tmp);
-                }
+                MsgIfce::getInstance()->SendTransferStatusChange(producer, *it);
             }
             filesMsg.clear();
         }
@@ -4342,223 +4600,99 @@ void MySqlAPI::getStagingFilesForCanceling(std::set< std::pair<std::string, std:
 }
 
 
-bool MySqlAPI::resetForRetryStaging(soci::session& sql, uint64_t fileId, const std::string & jobId, bool retry, int& times)
+std::map<uint64_t, MySqlAPI::RetryAttempt> MySqlAPI::getRetryAttempts(soci::session& sql, const std::string& table,
+    const std::vector<const MinFileStatus*>& failures)
 {
-    bool willBeRetried = false;
-
-
-    if(retry)
-    {
-        int nRetries = 0;
-        soci::indicator isNull = soci::i_ok;
-        std::string vo_name;
-        int retry_delay = 0;
-
-
-        try
-        {
-            sql <<
-                " SELECT retry, vo_name, retry_delay "
-                " FROM t_job "
-                " WHERE job_id = :job_id ",
-                soci::use(jobId),
-                soci::into(nRetries, isNull),
-                soci::into(vo_name),
-                soci::into(retry_delay)
-                ;
-
-
-            if (isNull == soci::i_null || nRetries <= 0)
-            {
-                sql <<
-                    " SELECT retry "
-                    " FROM t_server_config WHERE vo_name=:vo_name LIMIT 1",
-                    soci::use(vo_name), soci::into(nRetries, isNull)
-                    ;
-            }
-            else if (isNull != soci::i_null && nRetries <= 0)
-            {
-                nRetries = 0;
-            }
-
-            int nRetriesTimes = 0;
-            soci::indicator isNull2 = soci::i_ok;
-
-            sql << "SELECT retry FROM t_file WHERE file_id = :file_id AND job_id = :jobId ",
-                soci::use(fileId), soci::use(jobId), soci::into(nRetriesTimes, isNull2);
-
-
-
-
-            if(isNull != soci::i_null &&  isNull2 != soci::i_null  && nRetries > 0 && nRetriesTimes <= nRetries-1 )
-            {
-
-
-
-                //expressed in secs, default delay
-                const int default_retry_delay = 120;
-
-
-                if (retry_delay > 0)
-                {
-                    // update
-                    time_t now = getUTC(retry_delay);
-                    struct tm tTime;
-                    gmtime_r(&now, &tTime);
-
-                    sql.begin();
-
-                    sql << "UPDATE t_file SET retry_timestamp=:1, retry = :retry, file_state = 'STAGING', start_time=NULL, staging_start=NULL, transfer_host=NULL, log_file=NULL,"
-                        " log_file_debug=NULL, throughput = 0, current_failures = 1 "
-                        " WHERE  file_id = :fileId AND  job_id = :jobId AND file_state NOT IN ('FINISHED','STAGING','FAILED','CANCELED')",
-                        soci::use(tTime), soci::use(nRetriesTimes+1), soci::use(fileId), soci::use(jobId);
-
-                    willBeRetried = true;
-
-                    times = nRetriesTimes + 1;
-
-                    sql.commit();
-                }
-                else
-                {
-                    // update
-                    time_t now = getUTC(default_retry_delay);
-                    struct tm tTime;
-                    gmtime_r(&now, &tTime);
-
-                    sql.begin();
+    std::map<uint64_t, RetryAttempt> attempts;
+    if (failures.empty()) {
+        return attempts;
+    }
 
-                    sql << "UPDATE t_file SET retry_timestamp=:1, retry = :retry, file_state = 'STAGING', "
-                        "   staging_start=NULL, start_time=NULL, transfer_Host=NULL, "
-                        "   log_file=NULL, log_file_debug=NULL, throughput = 0,  current_failures = 1 "
-                        " WHERE  file_id = :fileId AND  job_id = :jobId AND file_state NOT IN ('FINISHED','STAGING','FAILED','CANCELED')",
-                        soci::use(tTime), soci::use(nRetriesTimes+1), soci::use(fileId), soci::use(jobId);
+    std::set<std::string> jobIds;
+    std::vector<uint64_t> fileIds;
+    for (auto i = failures.begin(); i != failures.end(); ++i) {
+        jobIds.insert((*i)->jobId);
+        fileIds.push_back((*i)->fileId);
+    }
 
-                    willBeRetried = true;
+    // Retries configured by the job, or by the VO if the job does not set them
+    std::map<std::string, std::pair<int, int> > jobRetries;
+    std::map<std::string, std::vector<std::string> > jobsPerVo;
 
-                    times = nRetriesTimes + 1;
+    soci::rowset<soci::row> rsJobs = (sql.prepare <<
+        " SELECT job_id, retry, vo_name, retry_delay "
+        " FROM t_job "
+        " WHERE job_id IN (" << sqlQuoteList(sql, jobIds) << ")");
 
-                    sql.commit();
-                }
-            }
-        }
-        catch (std::exception& e)
-        {
-            sql.rollback();
-            throw UserError(std::string(__func__) + ": Caught exception " + e.what());
+    for (auto i = rsJobs.begin(); i != rsJobs.end(); ++i) {
+        std::string jobId = i->get<std::string>("job_id");
+        int retry = i->get<int>("retry", 0);
+        if (i->get_indicator("retry") != soci::i_null && retry > 0) {
+            jobRetries[jobId] = std::make_pair(retry, i->get<int>("retry_delay", 0));
         }
-        catch (...)
-        {
-            sql.rollback();
-            throw UserError(std::string(__func__) + ": Caught exception " );
+        else {
+            jobRetries[jobId] = std::make_pair(0, i->get<int>("retry_delay", 0));
+            jobsPerVo[i->get<std::string>("vo_name", "")].push_back(jobId);
         }
     }
 
-    return willBeRetried;
-}
-
-
-bool MySqlAPI::resetForRetryDelete(soci::session& sql, uint64_t fileId, const std::string & jobId, bool retry)
-{
-    bool willBeRetried = false;
-
-    if(retry)
-    {
-        int nRetries = 0;
-        int retry_delay = 0;
-        soci::indicator isNull = soci::i_ok;
-        std::string vo_name;
+    if (!jobsPerVo.empty()) {
+        std::set<std::string> vos;
+        for (auto i = jobsPerVo.begin(); i != jobsPerVo.end(); ++i) {
+            vos.insert(i->first);
+        }
 
-        try
-        {
-            sql <<
-                " SELECT retry, vo_name, retry_delay "
-                " FROM t_job "
-                " WHERE job_id = :jobId ",
-                soci::use(jobId),
-                soci::into(nRetries, isNull),
-                soci::into(vo_name),
-                soci::into(retry_delay)
-                ;
+        std::set<std::string> seen;
+        soci::rowset<soci::row> rsVos = (sql.prepare <<
+            " SELECT vo_name, retry "
+            " FROM t_server_config WHERE vo_name IN (" << sqlQuoteList(sql, vos) << ")");
 
-            if (isNull == soci::i_null || nRetries <= 0)
-            {
-                sql <<
-                    " SELECT retry "
-                    " FROM t_server_config where vo_name=:vo_name LIMIT 1",
-                    soci::use(vo_name), soci::into(nRetries, isNull)
-                    ;
+        for (auto i = rsVos.begin(); i != rsVos.end(); ++i) {
+            std::string voName = i->get<std::string>("vo_name");
+            if (!seen.insert(voName).second) {
+                continue;
             }
-            else if (isNull != soci::i_null && nRetries <= 0)
-            {
-                nRetries = 0;
+            int retry = 0;
+            if (i->get_indicator("retry") != soci::i_null) {
+                retry = i->get<int>("retry");
             }
-
-            int nRetriesTimes = 0;
-            soci::indicator isNull2 = soci::i_ok;
-
-            sql << "SELECT retry FROM t_dm WHERE file_id = :fileId AND job_id = :jobId ",
-                soci::use(fileId), soci::use(jobId), soci::into(nRetriesTimes, isNull2);
-
-
-            if(isNull != soci::i_null &&  isNull2 != soci::i_null  && nRetries > 0 && nRetriesTimes <= nRetries-1 )
-            {
-                //expressed in secs, default delay
-                const int default_retry_delay = 120;
-
-                if (retry_delay > 0)
-                {
-                    // update
-                    time_t now = getUTC(retry_delay);
-                    struct tm tTime;
-                    gmtime_r(&now, &tTime);
-
-                    sql.begin();
-
-                    sql << "UPDATE t_dm SET retry_timestamp=:1, retry = :retry, file_state = 'DELETE', start_time=NULL, dmHost=NULL "
-                        " WHERE  file_id = :fileId AND  job_id = :jobId AND file_state NOT IN ('FINISHED','DELETE',"
-                        "'FAILED','CANCELED')",
-                        soci::use(tTime), soci::use(nRetries+1), soci::use(fileId), soci::use(jobId);
-
-                    willBeRetried = true;
-
-                    sql.commit();
-                }
-                else
-                {
-                    // update
-                    time_t now = getUTC(default_retry_delay);
-                    struct tm tTime;
-                    gmtime_r(&now, &tTime);
-
-                    sql.begin();
-
-                    sql << "UPDATE t_dm SET retry_timestamp=:1, retry = :retry, file_state = 'DELETE', start_time=NULL, dmHost=NULL  "
-                        " WHERE  file_id = :fileId AND  job_id = :jobId AND file_state NOT IN ('FINISHED','SUBMITTED',"
-                        "'FAILED','CANCELED')",
-                        soci::use(tTime), soci::use(nRetries+1), soci::use(fileId), soci::use(jobId);
-
-                    willBeRetried = true;
-
-                    sql.commit();
-                }
+            const std::vector<std::string> &voJobs = jobsPerVo[voName];
+            for (auto job = voJobs.begin(); job != voJobs.end(); ++job) {
+                jobRetries[*job].first = retry;
             }
+        }
+    }
 
-
+    // How many times each file has been retried already
+    std::map<uint64_t, int> fileRetries;
+    std::vector<std::string> batches = joinIdBatches(fileIds);
+    for (auto batch = batches.begin(); batch != batches.end(); ++batch) {
+        soci::rowset<soci::row> rs = (sql.prepare <<
+            "SELECT file_id, retry FROM " << table << " WHERE file_id IN (" << *batch << ")");
+        for (auto i = rs.begin(); i != rs.end(); ++i) {
+            if (i->get_indicator("retry") != soci::i_null) {
+                fileRetries[i->get<unsigned long long>("file_id")] = i->get<int>("retry");
+            }
         }
-        catch (std::exception& e)
-        {
-            sql.rollback();
-            throw UserError(std::string(__func__) + ": Caught exception " + e.what());
+    }
+
+    for (auto i = failures.begin(); i != failures.end(); ++i) {
+        auto job = jobRetries.find((*i)->jobId);
+        auto file = fileRetries.find((*i)->fileId);
+        if (job == jobRetries.end() || file == fileRetries.end()) {
+            continue;
         }
-        catch (...)
-        {
-            sql.rollback();
-            throw UserError(std::string(__func__) + ": Caught exception " );
+
+        int maxRetries = job->second.first;
+        if (maxRetries > 0 && file->second <= maxRetries - 1) {
+            RetryAttempt &attempt = attempts[(*i)->fileId];
+            attempt.previous = file->second;
+            attempt.maxRetries = maxRetries;
+            attempt.delay = job->second.second;
         }
     }
 
-    return willBeRetried;
+    return attempts;
 }
 
 
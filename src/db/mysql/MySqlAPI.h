@@ -28,6 +28,12 @@
 
 OptimizerMode getOptimizerModeInner(soci::session &sql, const std::string &source, const std::string &dest);
 
+/// Escape and quote value so it can be embedded as a literal in a dynamically built statement
+std::string sqlQuote(soci::session &sql, const std::string &value);
+
+/// Quote and join the values as a comma separated list
+std::string sqlQuoteList(soci::session &sql, const std::set<std::string> &values);
+
 class MySqlAPI : public GenericDbIfce
 {
 public:
@@ -82,6 +88,12 @@ public:
         const std::string& transferState, const std::string& errorReason,
         int processId, double filesize, double duration, bool retry, std::string fileMetadata = "");
 
+    /// Update the status of a set of transfers, as reported by fts_url_copy
+    /// @param messages         Status messages. UPDATE messages must not be included.
+    /// @return                 One outcome per message, in the same order
+    virtual std::vector<TransferStatusOutcome> updateTransferStatusBulk(
+        const std::vector<fts3::events::Message>& messages);
+
     /// Update the status of a job
     /// @param jobId            The job ID
     /// @param jobState         The job state
@@ -207,7 +219,7 @@ public:
     virtual unsigned int updateFileStatusReuse(const TransferFile &file, const std::string &status);
 
     /// Puts into requestIDs, jobs that have been cancelled, and for which the running fts_url_copy must be killed
-    virtual void getCancelJob(std::vector<int>& requestIDs);
+    virtual void getCancelJob(std::vector<std::pair<int, uint64_t>>& requestIDs);
 
     /// Returns list of transfers that need to be force started
     virtual std::list<TransferFile> getForceStartTransfers();
@@ -310,6 +322,16 @@ public:
     /// @params[out] archivingOps The list of started archiving operations will be put here
     virtual void getAlreadyStartedArchiving(std::vector<ArchivingOperation> &archivingOps);
 
+    /// Get how long the staging requests that succeeded recently took
+    /// @param[out] durations   Durations in seconds, by storage endpoint
+    /// @param window           Only requests that finished in the last window seconds
+    virtual void getStagingDurations(std::map<std::string, std::vector<time_t>> &durations, time_t window);
+
+    /// Get how long the archiving requests that succeeded recently took
+    /// @param[out] durations   Durations in seconds, by storage endpoint
+    /// @param window           Only requests that finished in the last window seconds
+    virtual void getArchivingDurations(std::map<std::string, std::vector<time_t>> &durations, time_t window);
+
     /// Put into files a set of bring online requests that must be cancelled
     /// @param files    Each entry in the set if a pair of surl / token
     virtual void getStagingFilesForCanceling(std::set< std::pair<std::string, std::string> >& files);
@@ -330,6 +352,10 @@ public:
     /// Get the configuration for a given storage
     virtual StorageConfig getStorageConfig(const std::string &storage);
 
+    /// Returns an opaque version of the link, storage and server configuration
+    /// It changes whenever any of them is modified, so cached values can be invalidated
+    virtual std::string getConfigurationVersion();
+
 private:
     size_t                poolSize;
     soci::connection_pool* connectionPool;
@@ -340,15 +366,18 @@ private:
     void updateHeartBeatInternal(soci::session& sql, unsigned* index, unsigned* count, unsigned* start, unsigned* end,
         std::string serviceName);
 
-    std::map<std::string, int> getFilesNumPerActivity(soci::session& sql,
-        std::string src, std::string dst, std::string vo, int filesNum,
-        std::set<std::string> & defaultActivities);
-
     std::map<std::string, long long> getActivitiesInQueue(soci::session& sql, std::string src,
         std::string dst, std::string vo);
 
     std::map<std::string, double> getActivityShareConf(soci::session& sql, std::string vo);
 
+    static std::map<std::string, double> parseActivityShareConf(std::string activityShareStr);
+
+    /// Same as getReadyTransfers, but loading the scheduling state for all the queues
+    /// with a handful of set-based queries instead of several round-trips per queue
+    void getReadyTransfersSnapshot(soci::session& sql, const std::vector<QueueId>& queues,
+        std::map< std::string, std::list<TransferFile>>& files);
+
     void updateArchivingStateInternal(soci::session& sql, const std::vector<MinFileStatus> &archivingOpsStatus);
 
     void updateDeletionsStateInternal(soci::session& sql, const std::vector<MinFileStatus> &delOpsStatus);
@@ -360,11 +389,44 @@ private:
         std::string newFileState, std::string transferMessage, int processId, double filesize, double duration, bool retry,
         std::string fileMetadata = "");
 
-    bool updateJobTransferStatusInternal(soci::session& sql, std::string jobId, const std::string& state);
+    /// State of a transfer and its job, as stored in the database
+    struct StoredTransferState {
+        StoredTransferState(): jobType(Job::kTypeRegular), archiveTimeout(-1), destSurlUuidInd(soci::i_null) {}
+
+        Job::JobType jobType;
+        std::string jobState;
+        int archiveTimeout;
+        std::string fileState;
+        std::string destSurlUuid;
+        soci::indicator destSurlUuidInd;
+    };
+
+    /// Update t_file within the current transaction, if the transition from the stored state is allowed
+    /// @param[in,out] newFileState     May be changed to ARCHIVING
+    /// @return true if the file was updated
+    bool applyFileTransferStatus(soci::session& sql, const StoredTransferState& stored, double throughput,
+        const std::string& jobId, uint64_t fileId,
+        std::string& newFileState, const std::string& transferMessage, int processId, double filesize, double duration,
+        bool retry, const std::string& fileMetadata);
+
+    /// Pick the next replica or hop once a transfer state change has been committed
+    void followUpFileTransferStatus(soci::session& sql, const StoredTransferState& stored,
+        const std::string& jobId, uint64_t fileId, const std::string& newFileState);
 
-    bool resetForRetryStaging(soci::session& sql, uint64_t fileId, const std::string & jobId, bool retry, int& times);
+    bool updateJobTransferStatusInternal(soci::session& sql, std::string jobId, const std::string& state);
 
-    bool resetForRetryDelete(soci::session& sql, uint64_t fileId, const std::string & jobId, bool retry);
+    /// A failed staging or deletion that will be retried
+    struct RetryAttempt {
+        int previous;       ///< Retries already done
+        int maxRetries;     ///< Retries allowed by the job, or its VO
+        int delay;          ///< Retry delay set by the job, 0 for the default
+    };
+
+    /// Find which of the failures can be retried, with a few queries for all of them
+    /// @param table    t_file for staging, t_dm for deletions
+    /// @return         The attempts, by file id. Failures that can not be retried are missing.
+    std::map<uint64_t, RetryAttempt> getRetryAttempts(soci::session& sql, const std::string& table,
+        const std::vector<const MinFileStatus*>& failures);
 
     uint64_t getBestNextReplica(soci::session& sql, const std::string & jobId, const std::string & voName);
 
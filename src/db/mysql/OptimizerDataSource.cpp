@@ -18,7 +18,11 @@
  * limitations under the License.
  */
 
+#include <cmath>
+#include <iomanip>
+#include <locale>
 #include <numeric>
+#include <sstream>
 #include "MySqlAPI.h"
 #include "db/generic/DbUtils.h"
 #include "common/Exceptions.h"
@@ -30,45 +34,124 @@ using namespace fts3;
 using namespace fts3::common;
 using namespace fts3::optimizer;
 
+// Maximum number of rows per INSERT statement when flushing the optimizer decisions
+static const size_t OPTIMIZER_FLUSH_BATCH = 500;
+
+
+// A decision waiting to be flushed
+struct PendingDecision {
+    Pair pair;
+    int active;
+    PairState state;
+    int diff;
+    std::string rationale;
+
+    PendingDecision(const Pair &pair, int active, const PairState &state, int diff, const std::string &rationale):
+        pair(pair), active(active), state(state), diff(diff), rationale(rationale)
+    {}
+};
+
+
+// Format a double so it can be embedded into a query. Non finite values are stored as NULL.
+static std::string sqlDouble(double value)
+{
+    if (!std::isfinite(value)) {
+        return "NULL";
+    }
+    std::ostringstream str;
+    str.imbue(std::locale::classic());
+    str << std::setprecision(17) << value;
+    return str.str();
+}
+
+
+// Run query, followed by the rows generated by formatRow for each item, in batches
+template <typename T, typename F>
+static void insertInBatches(soci::session &sql, const std::string &query, const std::string &onDuplicate,
+    const std::vector<T> &items, F formatRow)
+{
+    for (size_t first = 0; first < items.size(); first += OPTIMIZER_FLUSH_BATCH) {
+        size_t last = std::min(first + OPTIMIZER_FLUSH_BATCH, items.size());
+
+        std::ostringstream statement;
+        statement << query;
+        for (size_t i = first; i < last; ++i) {
+            if (i > first) {
+                statement << ", ";
+            }
+            statement << "(";
+            formatRow(statement, items[i]);
+            statement << ")";
+        }
+        statement << onDuplicate;
+
+        sql << statement.str();
+    }
+}
+
+
 // Set the new number of actives
-static void setNewOptimizerValue(soci::session &sql,
-    const Pair &pair, int optimizerDecision, double ema)
+static void setNewOptimizerValues(soci::session &sql, const std::vector<PendingDecision> &decisions)
+{
+    insertInBatches(sql,
+        "INSERT INTO t_optimizer (source_se, dest_se, active, ema, datetime) VALUES ",
+        " ON DUPLICATE KEY UPDATE "
+        "   active = VALUES(active), ema = VALUES(ema), datetime = UTC_TIMESTAMP()",
+        decisions, [&sql](std::ostream &row, const PendingDecision &decision) {
+            row << sqlQuote(sql, decision.pair.source) << ", " << sqlQuote(sql, decision.pair.destination) << ", "
+                << decision.active << ", " << sqlDouble(decision.state.ema) << ", UTC_TIMESTAMP()";
+        }
+    );
+}
+
+
+// Set the new number of streams
+// Streams are only stored after a decision for the same pair, so the row is already there
+static void setNewOptimizerStreams(soci::session &sql, const std::vector<std::pair<Pair, int>> &streams)
 {
-    sql.begin();
-    sql <<
-        "INSERT INTO t_optimizer (source_se, dest_se, active, ema, datetime) "
-        "VALUES (:source, :dest, :active, :ema, UTC_TIMESTAMP()) "
-        "ON DUPLICATE KEY UPDATE "
-        "   active = :active, ema = :ema, datetime = UTC_TIMESTAMP()",
-        soci::use(pair.source, "source"), soci::use(pair.destination, "dest"),
-        soci::use(optimizerDecision, "active"), soci::use(ema, "ema");
-    sql.commit();
+    insertInBatches(sql,
+        "INSERT INTO t_optimizer (source_se, dest_se, nostreams, datetime) VALUES ",
+        " ON DUPLICATE KEY UPDATE "
+        "   nostreams = VALUES(nostreams), datetime = UTC_TIMESTAMP()",
+        streams, [&sql](std::ostream &row, const std::pair<Pair, int> &entry) {
+            row << sqlQuote(sql, entry.first.source) << ", " << sqlQuote(sql, entry.first.destination) << ", "
+                << entry.second << ", UTC_TIMESTAMP()";
+        }
+    );
 }
 
-// Insert the optimizer decision into the historical table, so we can follow
+
+// Insert the optimizer decisions into the historical table, so we can follow
 // the progress
-static void updateOptimizerEvolution(soci::session &sql,
-    const Pair &pair, int active, int diff, const std::string &rationale, const PairState &newState)
+// Runs in its own transaction: if it fails, MySQL may roll back the whole transaction
+// (i.e. on a deadlock), and the decisions themselves must not go with it
+static void updateOptimizerEvolution(soci::session &sql, const std::vector<PendingDecision> &decisions)
 {
+    if (decisions.empty()) {
+        return;
+    }
+
     try {
         sql.begin();
-        sql << " INSERT INTO t_optimizer_evolution "
+        insertInBatches(sql,
+            " INSERT INTO t_optimizer_evolution "
             " (datetime, source_se, dest_se, "
             "  ema, active, throughput, success, "
             "  filesize_avg, filesize_stddev, "
             "  actual_active, queue_size, "
             "  rationale, diff) "
-            " VALUES "
-            " (UTC_TIMESTAMP(), :source, :dest, "
-            "  :ema, :active, :throughput, :success, "
-            "  :filesize_avg, :filesize_stddev, "
-            "  :actual_active, :queue_size, "
-            "  :rationale, :diff)",
-            soci::use(pair.source), soci::use(pair.destination),
-            soci::use(newState.ema), soci::use(active), soci::use(newState.throughput), soci::use(newState.successRate),
-            soci::use(newState.filesizeAvg), soci::use(newState.filesizeStdDev),
-            soci::use(newState.activeCount), soci::use(newState.queueSize),
-            soci::use(rationale), soci::use(diff);
+            " VALUES ", "",
+            decisions, [&sql](std::ostream &row, const PendingDecision &decision) {
+                const PairState &state = decision.state;
+                row << "UTC_TIMESTAMP(), "
+                    << sqlQuote(sql, decision.pair.source) << ", " << sqlQuote(sql, decision.pair.destination) << ", "
+                    << sqlDouble(state.ema) << ", " << decision.active << ", "
+                    << sqlDouble(state.throughput) << ", " << sqlDouble(state.successRate) << ", "
+                    << sqlDouble(state.filesizeAvg) << ", " << sqlDouble(state.filesizeStdDev) << ", "
+                    << state.activeCount << ", " << state.queueSize << ", "
+                    << sqlQuote(sql, decision.rationale) << ", " << decision.diff;
+            }
+        );
         sql.commit();
     }
     catch (std::exception &e) {
@@ -96,12 +179,302 @@ static int getCountInState(soci::session &sql, const Pair &pair, const std::stri
 }
 
 
+// Convert a nullable timestamp. Returns 0 if not set.
+static time_t toTimestamp(struct tm timestamp)
+{
+    if (timestamp.tm_year <= 0) {
+        return 0;
+    }
+    return timegm(&timestamp);
+}
+
+
+// Build a terminal transfer from a row of the terminal transfers query
+static TerminalTransfer toTerminalTransfer(const soci::row &row)
+{
+    static struct tm nulltm = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+    auto starttm = row.get<struct tm>("start_time", nulltm);
+
+    TerminalTransfer transfer;
+    transfer.state = row.get<std::string>("file_state", "");
+    transfer.start = timegm(&starttm);
+    transfer.end = toTimestamp(row.get<struct tm>("finish_time", nulltm));
+    transfer.filesize = row.get<long long>("filesize", 0);
+    transfer.duration = row.get<double>("tx_duration", 0.0);
+    transfer.recoverable = row.get<bool>("recoverable", false);
+    transfer.retry = row.get<int>("retry", 0);
+    return transfer;
+}
+
+
+// Metrics of a pair over one time frame, accumulated row by row
+// Running and terminal transfers are kept apart, so they can be queried separately
+struct WindowMetrics {
+    time_t windowStart;
+    WindowStatistics active, terminal;
+
+    WindowMetrics(time_t windowStart): windowStart(windowStart)
+    {}
+
+    WindowStatistics getTotal() const {
+        WindowStatistics total(active);
+        total.merge(terminal);
+        return total;
+    }
+};
+
+
+// Everything the optimizer needs from a pair, loaded in bulk
+struct PairMetrics {
+    OptimizerMode mode;
+    Range range;
+    StorageLimits limits;
+    int optimizerValue;
+    int active, submitted;
+    // Keyed by the time frame length, in seconds
+    std::map<long, WindowMetrics> windows;
+
+    PairMetrics(): mode(kOptimizerConservative), optimizerValue(0), active(0), submitted(0)
+    {}
+};
+
+
+// Row of t_link_config relevant for the optimizer
+struct LinkConfigRow {
+    bool hasRange;
+    int minActive, maxActive;
+    OptimizerMode mode;
+};
+
+
+// Row of t_se relevant for the optimizer
+struct StorageRow {
+    int inboundMaxActive, outboundMaxActive;
+    double inboundMaxThroughput, outboundMaxThroughput;
+};
+
+
+// Find the most specific configuration for the pair: source => dest, source => *, * => dest and * => *
+// Returns NULL if there is none. isSpecific is set to false for * => *
+template <typename T>
+static const T *findLinkConfig(const std::map<std::pair<std::string, std::string>, T> &configs,
+    const Pair &pair, bool *isSpecific)
+{
+    const std::pair<std::string, std::string> candidates[] = {
+        {pair.source, pair.destination},
+        {pair.source, "*"},
+        {"*", pair.destination},
+        {"*", "*"}
+    };
+    for (size_t i = 0; i < 4; ++i) {
+        auto config = configs.find(candidates[i]);
+        if (config != configs.end()) {
+            *isSpecific = (i < 3);
+            return &config->second;
+        }
+    }
+    return NULL;
+}
+
+
+// Find the configuration for the storage, or the default * one
+static const StorageRow *findStorageConfig(const std::map<std::string, StorageRow> &configs,
+    const std::string &storage)
+{
+    auto config = configs.find(storage);
+    if (config == configs.end()) {
+        config = configs.find("*");
+    }
+    if (config == configs.end()) {
+        return NULL;
+    }
+    return &config->second;
+}
+
+
 class MySqlOptimizerDataSource: public OptimizerDataSource {
 private:
+    // Used to run the optimizer and store the decisions
     soci::session sql;
+    // The methods used to evaluate a pair may be called concurrently by the optimizer workers,
+    // so each call gets its own session from the pool
+    soci::connection_pool *connectionPool;
+
+    // Decisions and streams stored since the last flush, in order
+    std::vector<PendingDecision> pendingDecisions;
+    std::vector<std::pair<Pair, int>> pendingStreams;
+
+    // Filled by prefetch
+    bool hasPrefetched;
+    std::map<Pair, PairMetrics> prefetched;
+    std::map<std::string, double> prefetchedAsSource, prefetchedAsDestination;
+
+    const PairMetrics *findPrefetched(const Pair &pair) {
+        auto i = prefetched.find(pair);
+        if (i == prefetched.end()) {
+            return NULL;
+        }
+        return &i->second;
+    }
+
+    const WindowMetrics *findPrefetched(const Pair &pair, const boost::posix_time::time_duration &interval) {
+        const PairMetrics *metrics = findPrefetched(pair);
+        if (!metrics) {
+            return NULL;
+        }
+        auto i = metrics->windows.find(interval.total_seconds());
+        if (i == metrics->windows.end()) {
+            return NULL;
+        }
+        return &i->second;
+    }
+
+    // Limits, working range and optimizer mode, resolved from the full configuration tables
+    void prefetchConfiguration(std::map<Pair, PairMetrics> &metrics) {
+        std::map<std::string, StorageRow> storages;
+        soci::rowset<soci::row> seRows = (sql.prepare <<
+            "SELECT storage, inbound_max_active, outbound_max_active, "
+            "   inbound_max_throughput, outbound_max_throughput "
+            "FROM t_se"
+        );
+        for (auto i = seRows.begin(); i != seRows.end(); ++i) {
+            StorageRow &row = storages[i->get<std::string>("storage")];
+            row.inboundMaxActive = i->get<int>("inbound_max_active", 0);
+            row.outboundMaxActive = i->get<int>("outbound_max_active", 0);
+            row.inboundMaxThroughput = i->get<double>("inbound_max_throughput", 0.0);
+            row.outboundMaxThroughput = i->get<double>("outbound_max_throughput", 0.0);
+        }
+
+        std::map<std::pair<std::string, std::string>, LinkConfigRow> links;
+        soci::rowset<soci::row> linkRows = (sql.prepare <<
+            "SELECT source_se, dest_se, min_active, max_active, optimizer_mode "
+            "FROM t_link_config"
+        );
+        for (auto i = linkRows.begin(); i != linkRows.end(); ++i) {
+            LinkConfigRow &row = links[std::make_pair(i->get<std::string>("source_se"), i->get<std::string>("dest_se"))];
+            row.hasRange = (i->get_indicator("min_active") != soci::i_null &&
+                i->get_indicator("max_active") != soci::i_null);
+            row.minActive = i->get<int>("min_active", 0);
+            row.maxActive = i->get<int>("max_active", 0);
+            row.mode = i->get<OptimizerMode>("optimizer_mode", kOptimizerDisabled);
+        }
+
+        for (auto i = metrics.begin(); i != metrics.end(); ++i) {
+            const Pair &pair = i->first;
+            PairMetrics &pairMetrics = i->second;
+
+            const StorageRow *source = findStorageConfig(storages, pair.source);
+            if (source) {
+                pairMetrics.limits.source = source->outboundMaxActive;
+                pairMetrics.limits.throughputSource = source->outboundMaxThroughput;
+            }
+            const StorageRow *destination = findStorageConfig(storages, pair.destination);
+            if (destination) {
+                pairMetrics.limits.destination = destination->inboundMaxActive;
+                pairMetrics.limits.throughputDestination = destination->inboundMaxThroughput;
+            }
+
+            bool isSpecific = false;
+            const LinkConfigRow *link = findLinkConfig(links, pair, &isSpecific);
+            if (link) {
+                pairMetrics.range.specific = isSpecific;
+                if (link->hasRange) {
+                    pairMetrics.range.min = link->minActive;
+                    pairMetrics.range.max = link->maxActive;
+                }
+                pairMetrics.mode = link->mode;
+            }
+        }
+    }
+
+    // Stored optimizer decisions
+    void prefetchOptimizerValues(std::map<Pair, PairMetrics> &metrics) {
+        soci::rowset<soci::row> rows = (sql.prepare <<
+            "SELECT source_se, dest_se, active FROM t_optimizer"
+        );
+        for (auto i = rows.begin(); i != rows.end(); ++i) {
+            auto pairMetrics = metrics.find(Pair(i->get<std::string>("source_se"), i->get<std::string>("dest_se")));
+            if (pairMetrics != metrics.end()) {
+                pairMetrics->second.optimizerValue = i->get<int>("active", 0);
+            }
+        }
+    }
+
+    // Queue sizes
+    void prefetchSubmitted(std::map<Pair, PairMetrics> &metrics) {
+        soci::rowset<soci::row> rows = (sql.prepare <<
+            "SELECT source_se, dest_se, COUNT(*) AS count FROM t_file "
+            "WHERE file_state = 'SUBMITTED' "
+            "GROUP BY source_se, dest_se ORDER BY NULL"
+        );
+        for (auto i = rows.begin(); i != rows.end(); ++i) {
+            auto pairMetrics = metrics.find(Pair(i->get<std::string>("source_se"), i->get<std::string>("dest_se")));
+            if (pairMetrics != metrics.end()) {
+                pairMetrics->second.submitted = i->get<long long>("count");
+            }
+        }
+    }
+
+    // Running transfers: active count, their share of the throughput, and the throughput per storage
+    void prefetchActive(std::map<Pair, PairMetrics> &metrics, time_t now) {
+        static struct tm nulltm = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+        soci::rowset<soci::row> rows = (sql.prepare <<
+            "SELECT source_se, dest_se, start_time, finish_time, transferred, filesize, throughput "
+            "FROM t_file "
+            "WHERE file_state = 'ACTIVE'"
+        );
+        for (auto i = rows.begin(); i != rows.end(); ++i) {
+            const std::string source = i->get<std::string>("source_se");
+            const std::string destination = i->get<std::string>("dest_se");
+
+            if (i->get_indicator("throughput") != soci::i_null) {
+                double throughput = i->get<double>("throughput");
+                prefetchedAsSource[source] += throughput;
+                prefetchedAsDestination[destination] += throughput;
+            }
+
+            auto pairMetrics = metrics.find(Pair(source, destination));
+            if (pairMetrics == metrics.end()) {
+                continue;
+            }
+            ++pairMetrics->second.active;
+
+            auto transferred = i->get<long long>("transferred", 0);
+            auto filesize = i->get<long long>("filesize", 0);
+            auto starttm = i->get<struct tm>("start_time", nulltm);
+            time_t start = timegm(&starttm);
+            time_t end = toTimestamp(i->get<struct tm>("finish_time", nulltm));
+
+            for (auto w = pairMetrics->second.windows.begin(); w != pairMetrics->second.windows.end(); ++w) {
+                WindowMetrics &window = w->second;
+                window.active.bytes += getBytesInWindow(now, window.windowStart, start, end, transferred, filesize);
+                if (filesize > 0) {
+                    window.active.addFilesize(filesize);
+                }
+            }
+        }
+    }
+
+    // Transfers that reached a terminal state within the longest time frame
+    void prefetchFinished(std::map<Pair, PairMetrics> &metrics, time_t now, long longestTimeFrame) {
+        getTerminalTransfers(boost::posix_time::seconds(longestTimeFrame),
+            [&metrics, now](const Pair &pair, const TerminalTransfer &transfer) {
+                auto pairMetrics = metrics.find(pair);
+                if (pairMetrics == metrics.end()) {
+                    return;
+                }
+                for (auto w = pairMetrics->second.windows.begin(); w != pairMetrics->second.windows.end(); ++w) {
+                    w->second.terminal.addTerminal(transfer, w->second.windowStart, now);
+                }
+            }
+        );
+    }
 
 public:
-    MySqlOptimizerDataSource(soci::connection_pool* connectionPool): sql(*connectionPool)
+    MySqlOptimizerDataSource(soci::connection_pool* connectionPool): sql(*connectionPool),
+        connectionPool(connectionPool), hasPrefetched(false)
     {
     }
 
@@ -127,11 +500,73 @@ public:
     }
 
 
+    void prefetch(const std::list<Pair> &pairs, const std::vector<boost::posix_time::time_duration> &timeFrames,
+        bool withTerminal) {
+        clearPrefetched();
+        if (pairs.empty() || timeFrames.empty()) {
+            return;
+        }
+
+        time_t now = time(NULL);
+        long longestTimeFrame = 0;
+
+        std::map<Pair, PairMetrics> metrics;
+        for (auto i = pairs.begin(); i != pairs.end(); ++i) {
+            PairMetrics &pairMetrics = metrics[*i];
+            for (auto j = timeFrames.begin(); j != timeFrames.end(); ++j) {
+                pairMetrics.windows.emplace(j->total_seconds(), WindowMetrics(now - j->total_seconds()));
+                longestTimeFrame = std::max<long>(longestTimeFrame, j->total_seconds());
+            }
+        }
+
+        try {
+            prefetchConfiguration(metrics);
+            prefetchOptimizerValues(metrics);
+            prefetchSubmitted(metrics);
+            prefetchActive(metrics, now);
+            if (withTerminal) {
+                prefetchFinished(metrics, now, longestTimeFrame);
+            }
+        }
+        catch (std::exception &e) {
+            clearPrefetched();
+            FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Could not prefetch the optimizer metrics, querying per pair: "
+                << e.what() << commit;
+            return;
+        }
+
+        prefetched.swap(metrics);
+        hasPrefetched = true;
+
+        FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Optimizer metrics prefetched for " << prefetched.size() << " pairs"
+            << commit;
+    }
+
+    void clearPrefetched(void) {
+        hasPrefetched = false;
+        prefetched.clear();
+        prefetchedAsSource.clear();
+        prefetchedAsDestination.clear();
+    }
+
     OptimizerMode getOptimizerMode(const std::string &source, const std::string &dest) {
+        const PairMetrics *metrics = findPrefetched(Pair(source, dest));
+        if (metrics) {
+            return metrics->mode;
+        }
+        soci::session sql(*connectionPool);
         return getOptimizerModeInner(sql, source, dest);
     }
 
     void getPairLimits(const Pair &pair, Range *range, StorageLimits *limits) {
+        const PairMetrics *metrics = findPrefetched(pair);
+        if (metrics) {
+            *range = metrics->range;
+            *limits = metrics->limits;
+            return;
+        }
+
+        soci::session sql(*connectionPool);
         soci::indicator nullIndicator;
 
         limits->source = limits->destination = 0;
@@ -173,6 +608,12 @@ public:
     }
 
     int getOptimizerValue(const Pair &pair) {
+        const PairMetrics *metrics = findPrefetched(pair);
+        if (metrics) {
+            return metrics->optimizerValue;
+        }
+
+        soci::session sql(*connectionPool);
         soci::indicator isCurrentNull;
         int currentActive = 0;
 
@@ -194,9 +635,19 @@ public:
 
         *throughput = *filesizeAvg = *filesizeStdDev = 0;
 
+        const WindowMetrics *window = findPrefetched(pair, interval);
+        if (window) {
+            WindowStatistics total = window->getTotal();
+            *throughput = total.bytes / interval.total_seconds();
+            *filesizeAvg = total.filesizeMean;
+            *filesizeStdDev = total.getFilesizeStdDev();
+            return;
+        }
+
         time_t now = time(NULL);
         time_t windowStart = now - interval.total_seconds();
 
+        soci::session sql(*connectionPool);
         soci::rowset<soci::row> transfers = (sql.prepare <<
         "SELECT start_time, finish_time, transferred, filesize "
         " FROM t_file "
@@ -218,34 +669,9 @@ public:
             auto transferred = j->get<long long>("transferred", 0.0);
             auto filesize = j->get<long long>("filesize", 0.0);
             auto starttm = j->get<struct tm>("start_time");
-            auto endtm = j->get<struct tm>("finish_time", nulltm);
+            time_t end = toTimestamp(j->get<struct tm>("finish_time", nulltm));
 
-            time_t start = timegm(&starttm);
-            time_t end = timegm(&endtm);
-            time_t periodInWindow = 0;
-            double bytesInWindow = 0;
-
-            // Not finish information
-            if (endtm.tm_year <= 0) {
-                periodInWindow = now - std::max(start, windowStart);
-                long duration = now - start;
-                if (duration > 0) {
-                    bytesInWindow = double(transferred / duration) * periodInWindow;
-                }
-            }
-            // Finished
-            else {
-                periodInWindow = end - std::max(start, windowStart);
-                long duration = end - start;
-                if (duration > 0 && filesize > 0) {
-                    bytesInWindow = double(filesize / duration) * periodInWindow;
-                }
-                else if (duration <= 0) {
-                    bytesInWindow = filesize;
-                }
-            }
-
-            totalBytes += bytesInWindow;
+            totalBytes += getBytesInWindow(now, windowStart, timegm(&starttm), end, transferred, filesize);
             if (filesize > 0) {
                 filesizes.push_back(filesize);
             }
@@ -269,6 +695,12 @@ public:
     }
 
     time_t getAverageDuration(const Pair &pair, const boost::posix_time::time_duration &interval) {
+        const WindowMetrics *window = findPrefetched(pair, interval);
+        if (window) {
+            return window->terminal.getAverageDuration();
+        }
+
+        soci::session sql(*connectionPool);
         double avgDuration = 0.0;
         soci::indicator isNullAvg = soci::i_ok;
 
@@ -284,6 +716,13 @@ public:
 
     double getSuccessRateForPair(const Pair &pair, const boost::posix_time::time_duration &interval,
         int *retryCount) {
+        const WindowMetrics *window = findPrefetched(pair, interval);
+        if (window) {
+            *retryCount = window->terminal.retryCount;
+            return window->terminal.getSuccessRate();
+        }
+
+        soci::session sql(*connectionPool);
         soci::rowset<soci::row> rs = (sql.prepare <<
             "SELECT file_state, retry, current_failures AS recoverable FROM t_file USE INDEX(idx_finish_time)"
             " WHERE "
@@ -331,15 +770,83 @@ public:
         }
     }
 
+    void getActiveStatistics(const Pair &pair, const boost::posix_time::time_duration &interval,
+        WindowStatistics *stats) {
+        static struct tm nulltm = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+        const WindowMetrics *window = findPrefetched(pair, interval);
+        if (window) {
+            stats->merge(window->active);
+            return;
+        }
+
+        time_t now = time(NULL);
+        time_t windowStart = now - interval.total_seconds();
+
+        soci::session sql(*connectionPool);
+        soci::rowset<soci::row> transfers = (sql.prepare <<
+            "SELECT start_time, finish_time, transferred, filesize "
+            " FROM t_file "
+            " WHERE source_se = :sourceSe AND dest_se = :destSe AND file_state = 'ACTIVE'",
+            soci::use(pair.source, "sourceSe"), soci::use(pair.destination, "destSe"));
+
+        WindowStatistics active;
+        for (auto j = transfers.begin(); j != transfers.end(); ++j) {
+            auto transferred = j->get<long long>("transferred", 0);
+            auto filesize = j->get<long long>("filesize", 0);
+            auto starttm = j->get<struct tm>("start_time", nulltm);
+            time_t end = toTimestamp(j->get<struct tm>("finish_time", nulltm));
+
+            active.bytes += getBytesInWindow(now, windowStart, timegm(&starttm), end, transferred, filesize);
+            if (filesize > 0) {
+                active.addFilesize(filesize);
+            }
+        }
+        stats->merge(active);
+    }
+
+    void getTerminalTransfers(const boost::posix_time::time_duration &interval,
+        const std::function<void(const Pair&, const TerminalTransfer&)> &callback) {
+        long seconds = interval.total_seconds();
+
+        soci::rowset<soci::row> rows = (sql.prepare <<
+            "SELECT source_se, dest_se, file_state, start_time, finish_time, filesize, "
+            "   tx_duration, retry, current_failures AS recoverable "
+            "FROM t_file USE INDEX(idx_finish_time) "
+            "WHERE finish_time >= (UTC_TIMESTAMP() - INTERVAL :interval SECOND) AND file_state <> 'NOT_USED'",
+            soci::use(seconds, "interval")
+        );
+        for (auto i = rows.begin(); i != rows.end(); ++i) {
+            callback(Pair(i->get<std::string>("source_se"), i->get<std::string>("dest_se")),
+                toTerminalTransfer(*i));
+        }
+    }
+
     int getActive(const Pair &pair) {
+        const PairMetrics *metrics = findPrefetched(pair);
+        if (metrics) {
+            return metrics->active;
+        }
+        soci::session sql(*connectionPool);
         return getCountInState(sql, pair, "ACTIVE");
     }
 
     int getSubmitted(const Pair &pair) {
+        const PairMetrics *metrics = findPrefetched(pair);
+        if (metrics) {
+            return metrics->submitted;
+        }
+        soci::session sql(*connectionPool);
         return getCountInState(sql, pair, "SUBMITTED");
     }
 
     double getThroughputAsSource(const std::string &se) {
+        if (hasPrefetched) {
+            auto i = prefetchedAsSource.find(se);
+            return i != prefetchedAsSource.end() ? i->second : 0;
+        }
+
+        soci::session sql(*connectionPool);
         double throughput = 0;
         soci::indicator isNull;
 
@@ -352,6 +859,12 @@ public:
     }
 
     double getThroughputAsDestination(const std::string &se) {
+        if (hasPrefetched) {
+            auto i = prefetchedAsDestination.find(se);
+            return i != prefetchedAsDestination.end() ? i->second : 0;
+        }
+
+        soci::session sql(*connectionPool);
         double throughput = 0;
         soci::indicator isNull;
 
@@ -364,21 +877,40 @@ public:
 
     void storeOptimizerDecision(const Pair &pair, int activeDecision,
         const PairState &newState, int diff, const std::string &rationale) {
-
-        setNewOptimizerValue(sql, pair, activeDecision, newState.ema);
-        updateOptimizerEvolution(sql, pair, activeDecision, diff, rationale, newState);
+        pendingDecisions.emplace_back(pair, activeDecision, newState, diff, rationale);
     }
 
     void storeOptimizerStreams(const Pair &pair, int streams) {
-        sql.begin();
+        pendingStreams.emplace_back(pair, streams);
+    }
 
-        sql << "UPDATE t_optimizer "
-               "SET nostreams = :nostreams, datetime = UTC_TIMESTAMP() "
-               "WHERE source_se = :source AND dest_se = :dest",
-            soci::use(pair.source, "source"), soci::use(pair.destination, "dest"),
-            soci::use(streams, "nostreams");
+    // Write all the pending decisions and streams in a single transaction,
+    // and then their history
+    void flushDecisions(void) {
+        if (pendingDecisions.empty() && pendingStreams.empty()) {
+            return;
+        }
 
-        sql.commit();
+        std::vector<PendingDecision> decisions;
+        std::vector<std::pair<Pair, int>> streams;
+        decisions.swap(pendingDecisions);
+        streams.swap(pendingStreams);
+
+        try {
+            sql.begin();
+            setNewOptimizerValues(sql, decisions);
+            setNewOptimizerStreams(sql, streams);
+            sql.commit();
+        }
+        catch (...) {
+            sql.rollback();
+            throw;
+        }
+
+        updateOptimizerEvolution(sql, decisions);
+
+        FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Flushed " << decisions.size() << " optimizer decisions and "
+            << streams.size() << " stream decisions" << commit;
     }
 };
 
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SchedulingPlan.h"
+
+#include <chrono>
+#include <random>
+
+#include <boost/algorithm/string.hpp>
+
+#include "common/Logger.h"
+
+using namespace fts3::common;
+
+
+std::string normaliseActivityName(const std::string &activity)
+{
+    if (activity.empty()) {
+        return "default";
+    }
+    return boost::algorithm::to_lower_copy(activity);
+}
+
+
+std::map<std::string, int> assignFilesToActivities(std::map<std::string, double> activityShares,
+    std::map<std::string, long long> activitiesInQueue, int filesNum,
+    std::set<std::string> &defaultActivities)
+{
+    std::map<std::string, int> activityFilesNum;
+
+    // sum of all activity shares in the queue (needed for normalization)
+    double sum = 0.0;
+
+    std::map<std::string, long long>::iterator it;
+    for (it = activitiesInQueue.begin(); it != activitiesInQueue.end(); it++)
+    {
+        std::map<std::string, double>::iterator pos = activityShares.find(it->first);
+        if (pos != activityShares.end() && it->first != "default")
+        {
+            sum += pos->second;
+        }
+        else
+        {
+            // if the activity has not been defined it falls to default
+            defaultActivities.insert(it->first);
+        }
+    }
+
+    // if default was used add it as well
+    if (!defaultActivities.empty())
+        sum += activityShares["default"];
+
+    static thread_local std::default_random_engine randomEngine(
+        static_cast<unsigned>(std::chrono::system_clock::now().time_since_epoch().count()));
+    std::uniform_real_distribution<double> dice(0.0, 1.0);
+
+    // assign slots to activities
+    for (int i = 0; i < filesNum; i++)
+    {
+        // if sum <= 0 there is nothing to assign
+        if (sum <= 0) break;
+        // a random number from (0, 1)
+        double r = dice(randomEngine);
+
+        FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << __func__ << ": Dice result: " << r << commit;
+
+        // interval corresponding to given activity
+        double interval = 0;
+
+        for (it = activitiesInQueue.begin(); it != activitiesInQueue.end(); it++)
+        {
+            // if there are no more files for this activity continue
+            if (it->second <= 0) continue;
+            // get the activity name (if it was not defined use default)
+            std::string activity_name = defaultActivities.count(it->first) ? "default" : it->first;
+
+            // calculate the interval (normalize)
+            interval += activityShares[activity_name] / sum;
+
+            // if the slot has been assigned to the given activity ...
+
+            if (r < interval)
+            {
+                ++activityFilesNum[activity_name];
+
+                --it->second;
+                // if there are no more files for the given ativity remove it from the sum
+                if (it->second == 0)
+                {
+                    sum -= activityShares[activity_name];
+                }
+                break;
+
+            }
+        }
+    }
+
+    // Debug output
+    std::map<std::string, int>::const_iterator j;
+    for (j = activityFilesNum.begin(); j != activityFilesNum.end(); ++j)
+    {
+        FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << __func__ << ": " << j->first << " assigned " << j->second << commit;
+    }
+
+    return activityFilesNum;
+}
+
+
+bool planQueue(const QueueState &state, int fixedPriority, QueuePlan &plan)
+{
+    plan = QueuePlan();
+
+    // Calculate how many tops we should pick
+    plan.filesNum = 10;
+    if (state.maxActive > 0) {
+        plan.filesNum = state.maxActive - state.activeCount;
+        if (plan.filesNum <= 0) {
+            return false;
+        }
+    }
+
+    if (fixedPriority == 0) {
+        if (!state.hasMaxPriority) {
+            FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "NULL MAX(priority), skip entry" << commit;
+            return false;
+        }
+        plan.maxPriority = state.maxPriority;
+    }
+    else {
+        plan.maxPriority = fixedPriority;
+    }
+
+    // if there is no configuration no assigment can be made
+    if (!state.activityShares.empty()) {
+        plan.activityFilesNum = assignFilesToActivities(state.activityShares, state.activitiesInQueue,
+            plan.filesNum, plan.defaultActivities);
+    }
+
+    return true;
+}
+
+
+void SchedulingSnapshot::addActiveCount(const std::string &source, const std::string &dest, int count)
+{
+    activeCount[LinkKey(source, dest)] += count;
+}
+
+
+void SchedulingSnapshot::addMaxActive(const std::string &source, const std::string &dest, int active)
+{
+    maxActive[LinkKey(source, dest)] = active;
+}
+
+
+void SchedulingSnapshot::addMaxPriority(const std::string &vo, const std::string &source, const std::string &dest,
+    int priority)
+{
+    maxPriorities[VoLinkKey(vo, source, dest)] = priority;
+}
+
+
+void SchedulingSnapshot::addActivityShares(const std::string &vo, const std::map<std::string, double> &shares)
+{
+    if (!shares.empty()) {
+        activityShares[vo] = shares;
+    }
+}
+
+
+void SchedulingSnapshot::addQueuedActivity(const std::string &vo, const std::string &source, const std::string &dest,
+    const std::string &activity, long long count)
+{
+    activitiesInQueue[VoLinkKey(vo, source, dest)][normaliseActivityName(activity)] += count;
+}
+
+
+std::set<std::string> SchedulingSnapshot::getVosWithShares() const
+{
+    std::set<std::string> vos;
+    for (auto i = activityShares.begin(); i != activityShares.end(); ++i) {
+        vos.insert(i->first);
+    }
+    return vos;
+}
+
+
+QueueState SchedulingSnapshot::getQueueState(const QueueId &queue) const
+{
+    LinkKey link(queue.sourceSe, queue.destSe);
+    VoLinkKey voLink(queue.voName, queue.sourceSe, queue.destSe);
+
+    QueueState state;
+
+    auto activeIter = activeCount.find(link);
+    if (activeIter != activeCount.end()) {
+        state.activeCount = activeIter->second;
+    }
+
+    auto maxActiveIter = maxActive.find(link);
+    if (maxActiveIter != maxActive.end()) {
+        state.maxActive = maxActiveIter->second;
+    }
+
+    auto priorityIter = maxPriorities.find(voLink);
+    if (priorityIter != maxPriorities.end()) {
+        state.hasMaxPriority = true;
+        state.maxPriority = priorityIter->second;
+    }
+
+    auto sharesIter = activityShares.find(queue.voName);
+    if (sharesIter != activityShares.end()) {
+        state.activityShares = sharesIter->second;
+        auto queuedIter = activitiesInQueue.find(voLink);
+        if (queuedIter != activitiesInQueue.end()) {
+            state.activitiesInQueue = queuedIter->second;
+        }
+    }
+
+    return state;
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef SCHEDULINGPLAN_H_
+#define SCHEDULINGPLAN_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+
+#include "db/generic/QueueId.h"
+
+
+/// Scheduling inputs of a single queue, however they were loaded
+struct QueueState
+{
+    QueueState(): activeCount(0), maxActive(0), hasMaxPriority(false), maxPriority(0) {}
+
+    /// Running transfers on the link
+    int activeCount;
+    /// Optimizer limit for the link, 0 if there is none
+    int maxActive;
+    /// False if nothing is waiting on the queue
+    bool hasMaxPriority;
+    /// Highest priority waiting on the queue
+    int maxPriority;
+    /// Activity shares of the VO, empty if it has none
+    std::map<std::string, double> activityShares;
+    /// Files waiting per activity, only loaded if the VO has activity shares
+    std::map<std::string, long long> activitiesInQueue;
+};
+
+
+/// What to pick from a queue
+struct QueuePlan
+{
+    QueuePlan(): filesNum(0), maxPriority(0) {}
+
+    int filesNum;
+    int maxPriority;
+    /// Files to pick per activity, empty if the VO has no activity shares
+    std::map<std::string, int> activityFilesNum;
+    /// Activities that fall into the default share
+    std::set<std::string> defaultActivities;
+};
+
+
+/// Activity name as used by the shares: lower case, and 'default' if it is not set
+std::string normaliseActivityName(const std::string &activity);
+
+/// Split filesNum slots among the activities in the queue, according to their shares
+std::map<std::string, int> assignFilesToActivities(std::map<std::string, double> activityShares,
+    std::map<std::string, long long> activitiesInQueue, int filesNum,
+    std::set<std::string> &defaultActivities);
+
+/// Apply the getReadyTransfers limits to a queue. Both scheduling paths go through here.
+/// @param fixedPriority UseFixedJobPriority, 0 to pick the highest priority waiting
+/// @return false if nothing is to be picked from the queue
+bool planQueue(const QueueState &state, int fixedPriority, QueuePlan &plan);
+
+
+/// Scheduling state of all the queues, as returned by a handful of grouped queries
+class SchedulingSnapshot
+{
+public:
+    void addActiveCount(const std::string &source, const std::string &dest, int count);
+    void addMaxActive(const std::string &source, const std::string &dest, int maxActive);
+    void addMaxPriority(const std::string &vo, const std::string &source, const std::string &dest, int priority);
+    void addActivityShares(const std::string &vo, const std::map<std::string, double> &shares);
+    void addQueuedActivity(const std::string &vo, const std::string &source, const std::string &dest,
+        const std::string &activity, long long count);
+
+    /// VOs with activity shares, for which the queued activities must be loaded
+    std::set<std::string> getVosWithShares() const;
+
+    /// Same inputs the per-queue queries would have loaded
+    QueueState getQueueState(const QueueId &queue) const;
+
+private:
+    typedef std::pair<std::string, std::string> LinkKey;
+    typedef std::tuple<std::string, std::string, std::string> VoLinkKey;
+
+    std::map<LinkKey, int> activeCount;
+    std::map<LinkKey, int> maxActive;
+    std::map<VoLinkKey, int> maxPriorities;
+    std::map<std::string, std::map<std::string, double> > activityShares;
+    std::map<VoLinkKey, std::map<std::string, long long> > activitiesInQueue;
+};
+
+#endif // SCHEDULINGPLAN_H_
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <sstream>
+
+#include "MySqlAPI.h"
+#include "SchedulingPlan.h"
+#include "sociConversions.h"
+#include "db/generic/DbUtils.h"
+
+#include "common/Exceptions.h"
+#include "common/Logger.h"
+
+using namespace fts3::common;
+
+
+/// How many per-queue selects are glued together with UNION ALL into a single statement
+static const size_t SNAPSHOT_UNION_BATCH = 50;
+
+/// One (queue, activity) slice of candidate files
+struct CandidateSelect
+{
+    CandidateSelect(const std::string& activity, const std::string& query): activity(activity), query(query) {}
+
+    std::string activity;
+    std::string query;
+};
+
+
+/// Build the select for the candidates of a single queue
+/// @param activity         Activity to pick, or empty if the VO has no activity shares
+/// @param defaultActivities Activities that fall into the default share
+static std::string buildCandidateSelect(soci::session& sql, const QueueId& queue,
+    const std::string& activity, const std::set<std::string>& defaultActivities,
+    const std::string& timestamp, unsigned hStart, unsigned hEnd, int maxPriority, int filesNum)
+{
+    std::ostringstream select;
+
+    select << " SELECT f.file_state, f.source_surl, f.dest_surl, f.job_id, j.vo_name, "
+              "       f.file_id, j.overwrite_flag, j.archive_timeout, j.dst_file_report, "
+              "       j.user_dn, j.cred_id, f.checksum, j.checksum_method, j.source_space_token, "
+              "       j.space_token, j.copy_pin_lifetime, j.bring_online, "
+              "       f.user_filesize, f.file_metadata, f.archive_metadata, j.job_metadata, "
+              "       f.file_index, f.bringonline_token, "
+              "       f.source_se, f.dest_se, f.selection_strategy, j.internal_job_params, j.job_type, "
+           << sqlQuote(sql, activity) << " AS sched_activity "
+              " FROM t_file f USE INDEX(idx_link_state_vo), t_job j "
+              " WHERE f.job_id = j.job_id AND f.file_state = 'SUBMITTED' AND "
+              "     f.source_se = " << sqlQuote(sql, queue.sourceSe) << " AND "
+              "     f.dest_se = " << sqlQuote(sql, queue.destSe) << " AND "
+              "     f.vo_name = " << sqlQuote(sql, queue.voName) << " AND "
+              "     (f.retry_timestamp IS NULL OR f.retry_timestamp < " << sqlQuote(sql, timestamp) << ") AND ";
+
+    if (activity.empty()) {
+        select << "     j.job_type IN ('N', 'R', 'H') AND ";
+    }
+    else {
+        select << "     (j.job_type = 'N' OR j.job_type = 'R') AND ";
+        if (activity == "default") {
+            // we are always checking empty string
+            select << "     (f.activity = 'default' OR f.activity IS NULL OR f.activity IN (''";
+            for (auto i = defaultActivities.begin(); i != defaultActivities.end(); ++i) {
+                select << ", " << sqlQuote(sql, *i);
+            }
+            select << ")) AND ";
+        }
+        else {
+            select << "     f.activity = " << sqlQuote(sql, activity) << " AND ";
+        }
+    }
+
+    select << "     f.hashed_id BETWEEN " << hStart << " AND " << hEnd << " AND "
+              "     j.priority = " << maxPriority <<
+              " ORDER BY file_id ASC "
+              " LIMIT " << filesNum;
+
+    return select.str();
+}
+
+
+void MySqlAPI::getReadyTransfersSnapshot(soci::session& sql, const std::vector<QueueId>& queues,
+    std::map<std::string, std::list<TransferFile> >& files)
+{
+    if (queues.empty()) {
+        return;
+    }
+
+    auto cycleStart = std::chrono::steady_clock::now();
+    unsigned nQueries = 0;
+
+    try
+    {
+        SchedulingSnapshot snapshot;
+
+        // Running transfers per link
+        soci::rowset<soci::row> activeRs = (sql.prepare <<
+            "SELECT f.source_se, f.dest_se, COUNT(*) AS active_count "
+            "FROM t_file f JOIN t_job j ON j.job_id = f.job_id "
+            "WHERE f.file_state = 'ACTIVE' "
+            "GROUP BY f.source_se, f.dest_se ORDER BY NULL");
+        ++nQueries;
+        for (auto i = activeRs.begin(); i != activeRs.end(); ++i) {
+            snapshot.addActiveCount(i->get<std::string>("source_se"), i->get<std::string>("dest_se"),
+                static_cast<int>(i->get<long long>("active_count")));
+        }
+
+        // How many can we run per link
+        soci::rowset<soci::row> optimizerRs = (sql.prepare <<
+            "SELECT source_se, dest_se, active FROM t_optimizer");
+        ++nQueries;
+        for (auto i = optimizerRs.begin(); i != optimizerRs.end(); ++i) {
+            if (i->get_indicator("active") == soci::i_null) {
+                continue;
+            }
+            snapshot.addMaxActive(i->get<std::string>("source_se"), i->get<std::string>("dest_se"),
+                i->get<int>("active"));
+        }
+
+        // Highest priority waiting per queue
+        int fixedPriority = ServerConfig::instance().get<int>("UseFixedJobPriority");
+        if (fixedPriority == 0) {
+            soci::rowset<soci::row> priorityRs = (sql.prepare <<
+                "SELECT vo_name, source_se, dest_se, CAST(MAX(priority) AS SIGNED) AS max_priority "
+                "FROM t_file "
+                "WHERE file_state = 'SUBMITTED' "
+                "GROUP BY vo_name, source_se, dest_se ORDER BY NULL");
+            ++nQueries;
+            for (auto i = priorityRs.begin(); i != priorityRs.end(); ++i) {
+                if (i->get_indicator("max_priority") == soci::i_null) {
+                    continue;
+                }
+                snapshot.addMaxPriority(i->get<std::string>("vo_name"),
+                    i->get<std::string>("source_se"), i->get<std::string>("dest_se"),
+                    static_cast<int>(i->get<long long>("max_priority")));
+            }
+        }
+        else {
+            FTS3_COMMON_LOGGER_NEWLOG(WARNING) << __func__
+                << " Using fixed priority for Jobs."
+                << commit;
+        }
+
+        // Activity shares for all the VOs
+        soci::rowset<soci::row> sharesRs = (sql.prepare <<
+            "SELECT vo, activity_share FROM t_activity_share_config WHERE active = 'on'");
+        ++nQueries;
+        for (auto i = sharesRs.begin(); i != sharesRs.end(); ++i) {
+            snapshot.addActivityShares(i->get<std::string>("vo"),
+                parseActivityShareConf(i->get<std::string>("activity_share", "")));
+        }
+
+        // Activities queued per queue, only for VOs with activity shares
+        std::set<std::string> vosWithShares = snapshot.getVosWithShares();
+        if (!vosWithShares.empty()) {
+            soci::rowset<soci::row> activityRs = (sql.prepare <<
+                " SELECT f.vo_name, f.source_se, f.dest_se, f.activity, "
+                "        COUNT(DISTINCT f.job_id, f.file_index) AS count "
+                " FROM t_file f INNER JOIN t_job j ON (f.job_id = j.job_id) WHERE "
+                "  j.vo_name = f.vo_name AND f.file_state = 'SUBMITTED' AND "
+                "  f.vo_name IN (" << sqlQuoteList(sql, vosWithShares) << ") AND "
+                "  (f.hashed_id >= :hStart AND f.hashed_id <= :hEnd) AND "
+                "  (j.job_type = 'N' OR j.job_type = 'R' OR j.job_type IS NULL) "
+                " GROUP BY f.vo_name, f.source_se, f.dest_se, f.activity ORDER BY NULL ",
+                soci::use(hashSegment.start),
+                soci::use(hashSegment.end));
+            ++nQueries;
+
+            for (auto i = activityRs.begin(); i != activityRs.end(); ++i) {
+                snapshot.addQueuedActivity(i->get<std::string>("vo_name"),
+                    i->get<std::string>("source_se"), i->get<std::string>("dest_se"),
+                    i->get<std::string>("activity", ""), i->get<long long>("count"));
+            }
+        }
+
+        // Plan the candidate selects, applying the same limits as getReadyTransfers
+        time_t now = time(NULL);
+        struct tm tTime;
+        gmtime_r(&now, &tTime);
+        char timestamp[32];
+        strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", &tTime);
+
+        auto seed = std::chrono::system_clock::now().time_since_epoch().count();
+        auto random_engine = std::default_random_engine{seed};
+
+        std::vector<CandidateSelect> selects;
+
+        for (auto it = queues.begin(); it != queues.end(); ++it)
+        {
+            QueuePlan plan;
+            if (!planQueue(snapshot.getQueueState(*it), fixedPriority, plan)) {
+                continue;
+            }
+
+            if (plan.activityFilesNum.empty())
+            {
+                selects.emplace_back("", buildCandidateSelect(sql, *it, "", plan.defaultActivities,
+                    timestamp, hashSegment.start, hashSegment.end, plan.maxPriority, plan.filesNum));
+            }
+            else
+            {
+                std::vector<std::pair<std::string, int> > vActivityFilesNum(plan.activityFilesNum.begin(),
+                    plan.activityFilesNum.end());
+                std::shuffle(vActivityFilesNum.begin(), vActivityFilesNum.end(), random_engine);
+
+                for (auto it_act = vActivityFilesNum.begin(); it_act != vActivityFilesNum.end(); ++it_act)
+                {
+                    if (it_act->second == 0) continue;
+                    selects.emplace_back(it_act->first, buildCandidateSelect(sql, *it, it_act->first,
+                        plan.defaultActivities, timestamp, hashSegment.start, hashSegment.end, plan.maxPriority,
+                        it_act->second));
+                }
+            }
+        }
+
+        // Fetch the candidates, several queues per round-trip
+        std::vector<TransferFile> candidates;
+        std::set<std::string> multiReplicaJobs, multiHopJobs;
+
+        for (size_t batchStart = 0; batchStart < selects.size(); batchStart += SNAPSHOT_UNION_BATCH)
+        {
+            size_t batchEnd = std::min(batchStart + SNAPSHOT_UNION_BATCH, selects.size());
+
+            std::ostringstream query;
+            for (size_t i = batchStart; i < batchEnd; ++i) {
+                if (i != batchStart) {
+                    query << " UNION ALL ";
+                }
+                query << "(" << selects[i].query << ")";
+            }
+
+            soci::rowset<soci::row> rs = (sql.prepare << query.str());
+            ++nQueries;
+
+            for (auto ti = rs.begin(); ti != rs.end(); ++ti)
+            {
+                TransferFile tfile;
+                soci::type_conversion<TransferFile>::fill(*ti, tfile);
+                tfile.activity = ti->get<std::string>("sched_activity", "");
+
+                if (tfile.jobType == Job::kTypeMultipleReplica) {
+                    multiReplicaJobs.insert(tfile.jobId);
+                }
+                if (tfile.jobType == Job::kTypeMultiHop) {
+                    multiHopJobs.insert(tfile.jobId);
+                }
+
+                candidates.push_back(tfile);
+            }
+        }
+
+        // Follow-ups for multiple replica and multihop jobs, one query for all of them
+        std::map<std::string, bool> lastReplica;
+        if (!multiReplicaJobs.empty()) {
+            soci::rowset<soci::row> rs = (sql.prepare <<
+                "SELECT job_id, COUNT(*) AS total, COUNT(NULLIF(file_state, 'NOT_USED')) AS remain "
+                "FROM t_file WHERE job_id IN (" << sqlQuoteList(sql, multiReplicaJobs) << ") "
+                "GROUP BY job_id");
+            ++nQueries;
+            for (auto i = rs.begin(); i != rs.end(); ++i) {
+                lastReplica[i->get<std::string>("job_id")] =
+                    (i->get<long long>("total") == i->get<long long>("remain"));
+            }
+        }
+
+        std::map<std::string, int> maxFileIndex;
+        if (!multiHopJobs.empty()) {
+            soci::rowset<soci::row> rs = (sql.prepare <<
+                "SELECT job_id, CAST(MAX(file_index) AS SIGNED) AS max_index "
+                "FROM t_file WHERE job_id IN (" << sqlQuoteList(sql, multiHopJobs) << ") "
+                "GROUP BY job_id");
+            ++nQueries;
+            for (auto i = rs.begin(); i != rs.end(); ++i) {
+                maxFileIndex[i->get<std::string>("job_id")] = static_cast<int>(i->get<long long>("max_index", 0));
+            }
+        }
+
+        for (auto ti = candidates.begin(); ti != candidates.end(); ++ti)
+        {
+            if (ti->jobType == Job::kTypeMultipleReplica) {
+                ti->lastReplica = lastReplica[ti->jobId] ? 1 : 0;
+            }
+            if (ti->jobType == Job::kTypeMultiHop) {
+                ti->lastHop = (maxFileIndex[ti->jobId] == ti->fileIndex) ? 1 : 0;
+            }
+            files[ti->voName].push_back(*ti);
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - cycleStart);
+        FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << __func__ << ": " << queues.size() << " queues, "
+            << candidates.size() << " candidates, "
+            << nQueries << " queries in " << elapsed.count() << "ms"
+            << commit;
+    }
+    catch (std::exception& e)
+    {
+        files.clear();
+        throw UserError(std::string(__func__) + ": Caught exception " + e.what());
+    }
+    catch (...)
+    {
+        files.clear();
+        throw UserError(std::string(__func__) + ": Caught exception ");
+    }
+}
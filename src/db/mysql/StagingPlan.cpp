@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "StagingPlan.h"
+
+#include <algorithm>
+#include <boost/algorithm/string.hpp>
+
+
+void StagingLimits::addConcurrentOps(const std::string &vo, const std::string &host, int ops)
+{
+    concurrentOps[VoEndpoint(boost::algorithm::to_lower_copy(vo), boost::algorithm::to_lower_copy(host))] = ops;
+}
+
+
+int StagingLimits::getConcurrentOps(const std::string &vo, const std::string &storage) const
+{
+    std::string voName = boost::algorithm::to_lower_copy(vo);
+
+    auto configured = concurrentOps.find(VoEndpoint(voName, boost::algorithm::to_lower_copy(storage)));
+    if (configured != concurrentOps.end() && configured->second > 0) {
+        return configured->second;
+    }
+    configured = concurrentOps.find(VoEndpoint(voName, "*"));
+    if (configured != concurrentOps.end() && configured->second > 0) {
+        return configured->second;
+    }
+    return 0;
+}
+
+
+int planStaging(const std::string &storage, const StagingState &state, int concurrentOps,
+    const StagingConfig &config, std::map<std::string, boost::posix_time::ptime> &nextSubmission,
+    const boost::posix_time::ptime &now)
+{
+    int limit = 0;
+
+    if (concurrentOps > 0) {
+        limit = concurrentOps - std::max(state.started, 0);
+        if (limit <= 0) {
+            return 0;
+        }
+    }
+    else {
+        limit = config.bulkSize; // Use a sensible default
+    }
+
+    // Make sure we do not grab more than the limit for a bulk
+    if (limit > config.bulkSize) {
+        limit = config.bulkSize;
+    }
+
+    // Now check for max concurrent active requests, must not exceed the limit
+    if (state.activeRequests > config.concurrentRequests) {
+        return 0;
+    }
+
+    // If we haven't got enough for a bulk request, give some time for more
+    // requests to arrive
+    if (state.queued < config.bulkSize) {
+        auto itQueue = nextSubmission.find(storage);
+        if (itQueue == nextSubmission.end()) {
+            nextSubmission[storage] = now + boost::posix_time::seconds(config.waitingFactor);
+            return 0;
+        }
+        if (itQueue->second > now) {
+            return 0;
+        }
+        nextSubmission.erase(itQueue);
+    }
+
+    return std::max(limit, 0);
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#pragma once
+#ifndef STAGINGPLAN_H_
+#define STAGINGPLAN_H_
+
+#include <map>
+#include <string>
+#include <utility>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+
+/// Configured concurrent staging operations (t_stage_req)
+/// The lookups ignore the case, as the database collation does
+class StagingLimits
+{
+public:
+    void addConcurrentOps(const std::string &vo, const std::string &host, int concurrentOps);
+
+    /// Configured value for the storage, or for the '*' wildcard of the VO if there is none
+    /// @return 0 if neither is configured
+    int getConcurrentOps(const std::string &vo, const std::string &storage) const;
+
+private:
+    typedef std::pair<std::string, std::string> VoEndpoint;
+    std::map<VoEndpoint, int> concurrentOps;
+};
+
+
+/// Staging files of a (vo, source_se) pair
+struct StagingState
+{
+    StagingState(): started(0), activeRequests(0), queued(0) {}
+
+    /// Files already being staged
+    int started;
+    /// Bring online requests of the started files
+    int activeRequests;
+    /// Files waiting to be staged
+    int queued;
+};
+
+
+/// Staging server configuration
+struct StagingConfig
+{
+    StagingConfig(): bulkSize(0), waitingFactor(0), concurrentRequests(0) {}
+
+    /// StagingBulkSize
+    int bulkSize;
+    /// StagingWaitingFactor, in seconds
+    int waitingFactor;
+    /// StagingConcurrentRequests
+    int concurrentRequests;
+};
+
+
+/// How many files can be picked from a (vo, source_se) pair for staging.
+/// If less than a bulk is queued, the storage is given waitingFactor seconds for more files to arrive.
+/// @param concurrentOps    As returned by StagingLimits::getConcurrentOps
+/// @param nextSubmission   When each storage waiting for a bulk can be submitted. Updated by the call.
+/// @return 0 if nothing is to be picked now
+int planStaging(const std::string &storage, const StagingState &state, int concurrentOps,
+    const StagingConfig &config, std::map<std::string, boost::posix_time::ptime> &nextSubmission,
+    const boost::posix_time::ptime &now);
+
+#endif // STAGINGPLAN_H_
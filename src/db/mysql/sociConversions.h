@@ -137,36 +137,44 @@ struct type_conversion<TransferFile>
 
     static void from_base(values const& v, indicator, TransferFile& file)
     {
-        file.fileState  = v.get<std::string>("file_state");
-        file.sourceSurl = v.get<std::string>("source_surl");
-        file.destSurl   = v.get<std::string>("dest_surl");
-        file.jobId      = v.get<std::string>("job_id");
-        file.voName     = v.get<std::string>("vo_name");
-        file.fileId     = v.get<unsigned long long>("file_id");
-        file.overwriteFlag   = v.get<std::string>("overwrite_flag","");
-        file.dstFileReport   = v.get<std::string>("dst_file_report","");
-        file.archiveTimeout  = v.get<int>("archive_timeout",-1);
-        file.userDn          = v.get<std::string>("user_dn");
-        file.credId     = v.get<std::string>("cred_id");
-        file.checksum    = v.get<std::string>("checksum","");
-        file.checksumMode    = v.get<std::string>("checksum_method","");
-        file.sourceSpaceToken = v.get<std::string>("source_space_token","");
-        file.destinationSpaceToken   = v.get<std::string>("space_token","");
-        file.bringOnline   = v.get<int>("bring_online",0);
-        file.pinLifetime  = v.get<int>("copy_pin_lifetime",0);
-        file.fileMetadata = v.get<std::string>("file_metadata", "");
-        file.transferMetadata = v.get<std::string>("archive_metadata", "");
-        file.jobMetadata  = v.get<std::string>("job_metadata", "");
-        file.userFilesize = v.get<long long>("user_filesize", 0);
-        file.fileIndex    = v.get<int>("file_index", 0);
-        file.bringOnlineToken = v.get<std::string>("bringonline_token", "");
-        file.sourceSe = v.get<std::string>("source_se", "");
-        file.destSe = v.get<std::string>("dest_se", "");
-        file.selectionStrategy = v.get<std::string>("selection_strategy", "");
-        file.internalFileParams = v.get<std::string>("internal_job_params", "");
+        fill(v, file);
+    }
+
+    /// Populate file from either a values or a row, since both share the same accessors
+    /// Used when the query carries extra columns and must be read as a raw row
+    template <typename ROW>
+    static void fill(ROW const& v, TransferFile& file)
+    {
+        file.fileState  = v.template get<std::string>("file_state");
+        file.sourceSurl = v.template get<std::string>("source_surl");
+        file.destSurl   = v.template get<std::string>("dest_surl");
+        file.jobId      = v.template get<std::string>("job_id");
+        file.voName     = v.template get<std::string>("vo_name");
+        file.fileId     = v.template get<unsigned long long>("file_id");
+        file.overwriteFlag   = v.template get<std::string>("overwrite_flag","");
+        file.dstFileReport   = v.template get<std::string>("dst_file_report","");
+        file.archiveTimeout  = v.template get<int>("archive_timeout",-1);
+        file.userDn          = v.template get<std::string>("user_dn");
+        file.credId     = v.template get<std::string>("cred_id");
+        file.checksum    = v.template get<std::string>("checksum","");
+        file.checksumMode    = v.template get<std::string>("checksum_method","");
+        file.sourceSpaceToken = v.template get<std::string>("source_space_token","");
+        file.destinationSpaceToken   = v.template get<std::string>("space_token","");
+        file.bringOnline   = v.template get<int>("bring_online",0);
+        file.pinLifetime  = v.template get<int>("copy_pin_lifetime",0);
+        file.fileMetadata = v.template get<std::string>("file_metadata", "");
+        file.transferMetadata = v.template get<std::string>("archive_metadata", "");
+        file.jobMetadata  = v.template get<std::string>("job_metadata", "");
+        file.userFilesize = v.template get<long long>("user_filesize", 0);
+        file.fileIndex    = v.template get<int>("file_index", 0);
+        file.bringOnlineToken = v.template get<std::string>("bringonline_token", "");
+        file.sourceSe = v.template get<std::string>("source_se", "");
+        file.destSe = v.template get<std::string>("dest_se", "");
+        file.selectionStrategy = v.template get<std::string>("selection_strategy", "");
+        file.internalFileParams = v.template get<std::string>("internal_job_params", "");
 
         try {
-            file.jobType = v.get<Job::JobType>("job_type", Job::kTypeRegular);
+            file.jobType = v.template get<Job::JobType>("job_type", Job::kTypeRegular);
         }
         catch (...) {
             // optional
@@ -175,6 +183,8 @@ struct type_conversion<TransferFile>
         // filesize and reason are NOT queried by any method that uses this
         // type
         file.filesize = 0;
+
+        file.internSymbols();
     }
 };
 
@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ShmRing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/Exceptions.h"
+#include "common/Logger.h"
+
+using fts3::common::commit;
+using fts3::common::SystemError;
+
+
+static const uint32_t SHM_RING_MAGIC = 0x46545352; // FTSR
+static const uint32_t SHM_RING_VERSION = 2;
+
+/// Set on the sequence of a slot the consumer skipped while its producer may still be writing
+static const uint64_t SHM_RING_ABANDONED = uint64_t(1) << 63;
+
+
+/// Layout of the beginning of the ring file
+/// head and tail are kept on their own cache lines, since they are written by different processes
+struct ShmRingHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t capacity;
+    uint32_t slotSize;
+    std::atomic<uint32_t> enabled;
+
+    alignas(64) std::atomic<uint64_t> head;
+    alignas(64) std::atomic<uint64_t> tail;
+};
+
+/// Layout of the beginning of each slot. The payload follows.
+/// sequence == position: free for the producer that reserves position
+/// sequence == position + 1: published, ready for the consumer
+/// sequence == position | SHM_RING_ABANDONED: skipped by the consumer. Its producer hands it
+///                                           over to the next round once done writing.
+/// owner is the pid of the producer that reserved, or is about to reserve, the slot. It is claimed
+/// before the reservation, so a producer that dies right after reserving still leaves its trace.
+/// It is only a hint: a pid can be reused, so the consumer recycles skipped slots after a timeout anyway.
+struct ShmRingSlot {
+    std::atomic<uint64_t> sequence;
+    uint32_t length;
+    std::atomic<int32_t> owner;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared memory ring requires lock free 64 bits atomics");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared memory ring requires lock free 32 bits atomics");
+static_assert(std::atomic<int32_t>::is_always_lock_free, "Shared memory ring requires lock free 32 bits atomics");
+
+/// True if the producer that reserved the slot does not exist anymore
+static bool isOwnerGone(const ShmRingSlot *slot)
+{
+    pid_t owner = slot->owner.load(std::memory_order_acquire);
+    return owner > 0 && kill(owner, 0) < 0 && errno == ESRCH;
+}
+
+static const size_t SHM_RING_HEADER_SIZE = (sizeof(ShmRingHeader) + 63) & ~size_t(63);
+
+
+static std::string errnoMessage(const std::string &prefix, const std::string &path)
+{
+    return prefix + " " + path + " (" + strerror(errno) + ")";
+}
+
+
+void ShmRing::configure(const std::string &path, bool enabled, uint32_t capacity, uint32_t slotSize)
+{
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+        throw SystemError("The capacity of the message ring must be a power of two");
+    }
+    if (slotSize <= sizeof(ShmRingSlot) || slotSize % alignof(ShmRingSlot) != 0) {
+        throw SystemError("Invalid slot size for the message ring");
+    }
+
+    std::unique_ptr<ShmRing> ring = ShmRing::open(path);
+    if (!ring) {
+        if (!enabled) {
+            return;
+        }
+
+        // Build the ring on a temporary file, and rename once initialized, so
+        // producers never see a half written header
+        std::string tmpPath = path + ".tmp";
+        size_t size = SHM_RING_HEADER_SIZE + size_t(capacity) * slotSize;
+
+        int fd = ::open(tmpPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0660);
+        if (fd < 0) {
+            throw SystemError(errnoMessage("Could not create the message ring", tmpPath));
+        }
+        if (ftruncate(fd, size) < 0) {
+            ::close(fd);
+            throw SystemError(errnoMessage("Could not resize the message ring", tmpPath));
+        }
+        void *mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            throw SystemError(errnoMessage("Could not map the message ring", tmpPath));
+        }
+
+        ShmRingHeader *header = new (mapping) ShmRingHeader;
+        header->magic = SHM_RING_MAGIC;
+        header->version = SHM_RING_VERSION;
+        header->capacity = capacity;
+        header->slotSize = slotSize;
+        header->enabled.store(0);
+        header->head.store(0);
+        header->tail.store(0);
+
+        for (uint32_t i = 0; i < capacity; ++i) {
+            char *address = static_cast<char*>(mapping) + SHM_RING_HEADER_SIZE + size_t(i) * slotSize;
+            ShmRingSlot *slot = new (address) ShmRingSlot;
+            slot->sequence.store(i);
+            slot->length = 0;
+            slot->owner.store(0);
+        }
+
+        msync(mapping, size, MS_SYNC);
+        munmap(mapping, size);
+
+        if (rename(tmpPath.c_str(), path.c_str()) < 0) {
+            throw SystemError(errnoMessage("Could not install the message ring", path));
+        }
+
+        FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Created message ring " << path
+            << " with " << capacity << " slots of " << slotSize << " bytes"
+            << commit;
+
+        ring = ShmRing::open(path);
+        if (!ring) {
+            throw SystemError("Could not open the newly created message ring " + path);
+        }
+    }
+
+    ring->header->enabled.store(enabled ? 1 : 0, std::memory_order_release);
+}
+
+
+std::unique_ptr<ShmRing> ShmRing::open(const std::string &path)
+{
+    int fd = ::open(path.c_str(), O_RDWR);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || size_t(st.st_size) < SHM_RING_HEADER_SIZE) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    void *mapping = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+
+    ShmRingHeader *header = static_cast<ShmRingHeader*>(mapping);
+    size_t expectedSize = SHM_RING_HEADER_SIZE + size_t(header->capacity) * header->slotSize;
+    if (header->magic != SHM_RING_MAGIC || header->version != SHM_RING_VERSION ||
+        header->capacity == 0 || (header->capacity & (header->capacity - 1)) != 0 ||
+        header->slotSize <= sizeof(ShmRingSlot) || expectedSize != size_t(st.st_size)) {
+        FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Ignoring invalid message ring " << path << commit;
+        munmap(mapping, st.st_size);
+        return nullptr;
+    }
+
+    return std::unique_ptr<ShmRing>(new ShmRing(path, mapping, st.st_size));
+}
+
+
+ShmRing::ShmRing(const std::string &path, void *mapping, size_t mappingSize):
+    path(path), mapping(mapping), mappingSize(mappingSize), header(static_cast<ShmRingHeader*>(mapping)),
+    stuckPosition(0), stuckSince(0), staleSlotTimeout(STALE_SLOT_TIMEOUT),
+    abandonedScanned(false), abandonedSlotTimeout(ABANDONED_SLOT_TIMEOUT)
+{
+}
+
+
+ShmRing::~ShmRing()
+{
+    munmap(mapping, mappingSize);
+}
+
+
+ShmRingSlot *ShmRing::getSlot(uint64_t position) const
+{
+    uint64_t index = position & (header->capacity - 1);
+    char *address = static_cast<char*>(mapping) + SHM_RING_HEADER_SIZE + index * header->slotSize;
+    return reinterpret_cast<ShmRingSlot*>(address);
+}
+
+
+bool ShmRing::isEnabled() const
+{
+    return header->enabled.load(std::memory_order_acquire) != 0;
+}
+
+
+size_t ShmRing::getMaxPayload() const
+{
+    return header->slotSize - sizeof(ShmRingSlot);
+}
+
+
+void ShmRing::setStaleSlotTimeout(time_t timeout)
+{
+    staleSlotTimeout = timeout;
+}
+
+
+void ShmRing::setAbandonedSlotTimeout(time_t timeout)
+{
+    abandonedSlotTimeout = timeout;
+}
+
+
+bool ShmRing::push(const std::string &payload)
+{
+    uint64_t position;
+    return reserve(payload.size(), position) && publish(position, payload);
+}
+
+
+bool ShmRing::reserve(size_t size, uint64_t &position)
+{
+    if (!isEnabled() || size > getMaxPayload()) {
+        return false;
+    }
+
+    const int32_t pid = getpid();
+    ShmRingSlot *slot = NULL;
+    position = header->head.load(std::memory_order_relaxed);
+    while (true) {
+        slot = getSlot(position);
+        uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence & SHM_RING_ABANDONED) {
+            // Skipped by the consumer. If its producer died meanwhile, nobody will give it back.
+            if (sequence == ((position - header->capacity) | SHM_RING_ABANDONED) && isOwnerGone(slot)) {
+                slot->owner.store(0, std::memory_order_relaxed);
+                slot->sequence.compare_exchange_strong(sequence, position, std::memory_order_acq_rel);
+                continue;
+            }
+            // Otherwise, the ring is full until it does
+            return false;
+        }
+
+        int64_t diff = int64_t(sequence) - int64_t(position);
+        if (diff == 0) {
+            // Claim the slot before reserving it, so there is no window where it is reserved
+            // without an owner. If another producer wins the reservation, it overwrites the claim.
+            int32_t noOwner = 0;
+            slot->owner.compare_exchange_strong(noOwner, pid, std::memory_order_release, std::memory_order_relaxed);
+            if (header->head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            // Full
+            return false;
+        }
+        else {
+            position = header->head.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Lets the consumer tell a slow producer from a dead one
+    slot->owner.store(pid, std::memory_order_release);
+    return true;
+}
+
+
+bool ShmRing::publish(uint64_t position, const std::string &payload)
+{
+    ShmRingSlot *slot = getSlot(position);
+
+    // Do not bother writing into a slot the consumer gave up on already
+    uint64_t expected = slot->sequence.load(std::memory_order_acquire);
+    if (expected == position) {
+        slot->length = std::min(payload.size(), getMaxPayload());
+        memcpy(reinterpret_cast<char*>(slot + 1), payload.data(), slot->length);
+
+        if (slot->sequence.compare_exchange_strong(expected, position + 1,
+            std::memory_order_release, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+
+    // The consumer gave up on this slot while it was being written.
+    // Nobody else touches it until it is handed over to the producers of the next round,
+    // so the write could not have clobbered another message.
+    // Unless this producer took so long the consumer recycled the slot itself. Then leave it,
+    // and its owner, be.
+    int32_t self = getpid();
+    slot->owner.compare_exchange_strong(self, 0, std::memory_order_relaxed);
+    expected = position | SHM_RING_ABANDONED;
+    slot->sequence.compare_exchange_strong(expected, position + header->capacity,
+        std::memory_order_release, std::memory_order_relaxed);
+    return false;
+}
+
+
+void ShmRing::recycleAbandoned()
+{
+    time_t now = time(NULL);
+
+    // Slots skipped by a previous consumer
+    if (!abandonedScanned) {
+        for (uint64_t i = 0; i < header->capacity; ++i) {
+            uint64_t sequence = getSlot(i)->sequence.load(std::memory_order_acquire);
+            if (sequence & SHM_RING_ABANDONED) {
+                abandoned[sequence & ~SHM_RING_ABANDONED] = now;
+            }
+        }
+        abandonedScanned = true;
+    }
+
+    for (auto i = abandoned.begin(); i != abandoned.end();) {
+        uint64_t position = i->first;
+        ShmRingSlot *slot = getSlot(position);
+        uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+
+        // Given back by its producer, or recycled by another producer
+        if (sequence != (position | SHM_RING_ABANDONED)) {
+            i = abandoned.erase(i);
+            continue;
+        }
+
+        bool dead = isOwnerGone(slot);
+        if (!dead && now - i->second < abandonedSlotTimeout) {
+            ++i;
+            continue;
+        }
+
+        slot->owner.store(0, std::memory_order_relaxed);
+        if (slot->sequence.compare_exchange_strong(sequence, position + header->capacity,
+            std::memory_order_acq_rel, std::memory_order_acquire) && !dead) {
+            FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Recycled a message slot on " << path
+                << " that was not given back after " << abandonedSlotTimeout << " seconds"
+                << commit;
+        }
+        i = abandoned.erase(i);
+    }
+}
+
+
+bool ShmRing::pop(std::string &payload)
+{
+    if (!abandonedScanned || !abandoned.empty()) {
+        recycleAbandoned();
+    }
+
+    while (true) {
+        uint64_t position = header->tail.load(std::memory_order_relaxed);
+        ShmRingSlot *slot = getSlot(position);
+        uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+
+        if (sequence == position + 1) {
+            size_t length = std::min<size_t>(slot->length, getMaxPayload());
+            payload.assign(reinterpret_cast<const char*>(slot + 1), length);
+            slot->owner.store(0, std::memory_order_relaxed);
+            slot->sequence.store(position + header->capacity, std::memory_order_release);
+            header->tail.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Empty, or the producer that reserved this slot has not finished writing yet
+        if (sequence != position || header->head.load(std::memory_order_acquire) <= position) {
+            return false;
+        }
+
+        time_t now = time(NULL);
+        if (stuckPosition != position || stuckSince == 0) {
+            stuckPosition = position;
+            stuckSince = now;
+            return false;
+        }
+        if (now - stuckSince < staleSlotTimeout) {
+            return false;
+        }
+
+        // Skip the slot. Its producer may still be writing into it, so it can not be recycled
+        // right away: the producer hands it over once done.
+        uint64_t expected = position;
+        if (slot->sequence.compare_exchange_strong(expected, position | SHM_RING_ABANDONED,
+            std::memory_order_acq_rel, std::memory_order_acquire)) {
+            header->tail.store(position + 1, std::memory_order_release);
+
+            // Unless the producer is gone for good. Then it is recycled right away.
+            abandoned[position] = now;
+            bool dead = isOwnerGone(slot);
+            if (dead) {
+                recycleAbandoned();
+            }
+
+            FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Skipped a message slot on " << path
+                << " reserved, but not published, for more than " << staleSlotTimeout << " seconds"
+                << (dead ? " (producer gone)" : "")
+                << commit;
+        }
+        stuckSince = 0;
+    }
+}
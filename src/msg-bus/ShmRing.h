@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SHMRING_H
+#define SHMRING_H
+
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <memory>
+#include <string>
+
+struct ShmRingHeader;
+struct ShmRingSlot;
+
+/// Multi-producer, single-consumer ring of messages, backed by a memory mapped file
+/// so it can be shared between the fts_url_copy processes and the server.
+/// Each slot carries a sequence number (bounded queue a la Vyukov), so producers
+/// reserve a slot with a single compare and swap, and never block each other.
+/// When the ring is full, disabled, or the message does not fit in a slot, push returns false
+/// and the caller is expected to fall back to the dirq queue.
+class ShmRing {
+public:
+    static const uint32_t DEFAULT_CAPACITY = 8192;
+    static const uint32_t DEFAULT_SLOT_SIZE = 2048;
+
+    /// A producer that reserved a slot, but did not publish it after this many seconds,
+    /// is given up on and the slot is skipped
+    static const time_t STALE_SLOT_TIMEOUT = 30;
+
+    /// A skipped slot is normally given back by its producer once done writing, or
+    /// recycled as soon as the producer is known to be gone. If neither happens after
+    /// this many seconds, the consumer recycles it anyway, so the ring can not be wedged.
+    static const time_t ABANDONED_SLOT_TIMEOUT = 300;
+
+    /// Create the ring file if it does not exist, and enable or disable it
+    /// If it does not exist, and enabled is false, nothing is done
+    /// @param path     Path of the ring file
+    /// @param enabled  If false, producers will write to the dirq queues instead
+    /// @param capacity Number of slots. Must be a power of two.
+    /// @param slotSize Size of each slot, including its header
+    static void configure(const std::string &path, bool enabled,
+        uint32_t capacity = DEFAULT_CAPACITY, uint32_t slotSize = DEFAULT_SLOT_SIZE);
+
+    /// Map an existing ring file
+    /// @return nullptr if the file does not exist or is not a valid ring
+    static std::unique_ptr<ShmRing> open(const std::string &path);
+
+    ~ShmRing();
+
+    ShmRing(const ShmRing&) = delete;
+    ShmRing& operator = (const ShmRing&) = delete;
+
+    /// Put a message into the ring. Same as reserve followed by publish.
+    /// @return false if the message could not be stored
+    bool push(const std::string &payload);
+
+    /// Reserve the next slot for a payload of the given size
+    /// @param size     Size of the payload that will be published
+    /// @param position Set to the position of the reserved slot
+    /// @return false if the ring is disabled or full, or the payload does not fit in a slot
+    bool reserve(size_t size, uint64_t &position);
+
+    /// Write the payload into a slot reserved by this process, and hand it over to the consumer
+    /// @param position As returned by reserve
+    /// @param payload  Not bigger than the size given to reserve
+    /// @return false if the consumer skipped the slot meanwhile. The message must be sent some other way.
+    bool publish(uint64_t position, const std::string &payload);
+
+    /// Get the oldest message in the ring
+    /// @note Only one consumer must call this method at the time
+    /// @return false if there are no messages ready
+    bool pop(std::string &payload);
+
+    /// True if producers should use this ring
+    bool isEnabled() const;
+
+    /// Maximum payload that fits in a slot
+    size_t getMaxPayload() const;
+
+    /// Change how long the consumer waits for a reserved slot before skipping it
+    void setStaleSlotTimeout(time_t timeout);
+
+    /// Change how long the consumer waits for a skipped slot to be given back before recycling it
+    void setAbandonedSlotTimeout(time_t timeout);
+
+private:
+    ShmRing(const std::string &path, void *mapping, size_t mappingSize);
+
+    ShmRingSlot *getSlot(uint64_t position) const;
+
+    /// Recycle the skipped slots whose producer is gone, or that were not given back in time
+    void recycleAbandoned();
+
+    std::string path;
+    void *mapping;
+    size_t mappingSize;
+    ShmRingHeader *header;
+
+    // Consumer side bookkeeping of a slot reserved, but not yet published
+    uint64_t stuckPosition;
+    time_t stuckSince;
+    time_t staleSlotTimeout;
+
+    // Consumer side bookkeeping of the skipped slots, by position
+    std::map<uint64_t, time_t> abandoned;
+    bool abandonedScanned;
+    time_t abandonedSlotTimeout;
+};
+
+#endif // SHMRING_H
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "Wakeup.h"
+
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/Exceptions.h"
+
+using fts3::common::SystemError;
+
+
+static bool fillAddress(const std::string &path, struct sockaddr_un &address)
+{
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        return false;
+    }
+    strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    return true;
+}
+
+
+WakeupListener::WakeupListener(const std::string &path): path(path), fd(-1)
+{
+    struct sockaddr_un address;
+    if (!fillAddress(path, address)) {
+        throw SystemError("Wakeup socket path too long: " + path);
+    }
+
+    fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        throw SystemError(std::string("Could not create the wakeup socket: ") + strerror(errno));
+    }
+
+    unlink(path.c_str());
+    if (bind(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) < 0) {
+        int err = errno;
+        close(fd);
+        throw SystemError("Could not bind the wakeup socket " + path + ": " + strerror(err));
+    }
+}
+
+
+WakeupListener::~WakeupListener()
+{
+    close(fd);
+    unlink(path.c_str());
+}
+
+
+bool WakeupListener::wait(int timeoutMs)
+{
+    struct pollfd pfd;
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    int ret = poll(&pfd, 1, timeoutMs);
+    if (ret <= 0) {
+        return false;
+    }
+
+    char buffer[16];
+    while (recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT) >= 0) {
+        // Drain
+    }
+    return true;
+}
+
+
+WakeupNotifier::WakeupNotifier(const std::string &path): fd(-1)
+{
+    if (fillAddress(path, address)) {
+        fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    }
+}
+
+
+WakeupNotifier::~WakeupNotifier()
+{
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+
+void WakeupNotifier::notify()
+{
+    if (fd < 0) {
+        return;
+    }
+    // Nobody listening, or the consumer already has notifications pending: either way, nothing to do
+    sendto(fd, "", 0, MSG_DONTWAIT | MSG_NOSIGNAL,
+        reinterpret_cast<const struct sockaddr*>(&address), sizeof(address));
+}
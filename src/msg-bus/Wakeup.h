@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef WAKEUP_H
+#define WAKEUP_H
+
+#include <string>
+#include <sys/un.h>
+
+/// Lets a consumer sleep until a producer tells it there are new messages, instead of polling the queues.
+/// Notifications are empty datagrams sent to a unix socket bound by the consumer. They are best effort:
+/// they are dropped if nobody is listening, or if the consumer has plenty of them pending already,
+/// so consumers must still drain the queues periodically.
+class WakeupListener {
+public:
+    /// Bind the socket. A stale socket left behind by a previous run is replaced.
+    explicit WakeupListener(const std::string &path);
+
+    ~WakeupListener();
+
+    WakeupListener(const WakeupListener&) = delete;
+    WakeupListener& operator = (const WakeupListener&) = delete;
+
+    /// Wait until a notification arrives, or the timeout expires
+    /// All pending notifications are consumed, so a burst of messages wakes up the consumer only once
+    /// @return true if there was a notification
+    bool wait(int timeoutMs);
+
+private:
+    std::string path;
+    int fd;
+};
+
+
+class WakeupNotifier {
+public:
+    explicit WakeupNotifier(const std::string &path);
+
+    ~WakeupNotifier();
+
+    WakeupNotifier(const WakeupNotifier&) = delete;
+    WakeupNotifier& operator = (const WakeupNotifier&) = delete;
+
+    /// Wake up the consumer, if any. Never blocks.
+    void notify();
+
+private:
+    int fd;
+    struct sockaddr_un address;
+};
+
+#endif // WAKEUP_H
@@ -18,10 +18,12 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <fstream>
 #include "common/Logger.h"
 #include "consumer.h"
 #include "DirQ.h"
+#include "ShmRing.h"
 
 
 Consumer::Consumer(const std::string &baseDir, unsigned limit):
@@ -38,15 +40,79 @@ Consumer::~Consumer()
 }
 
 
+/// Pop up to limit messages from the ring, if there is one, and pass them to handle
+/// @return How many messages were consumed
+template <typename F>
+static unsigned drainRing(std::unique_ptr<ShmRing> &ring, const std::string &path, unsigned limit, F handle)
+{
+    if (!ring) {
+        ring = ShmRing::open(path);
+        if (!ring) {
+            return 0;
+        }
+    }
+
+    std::string payload;
+    unsigned i = 0;
+    while (i < limit && ring->pop(payload)) {
+        handle(payload);
+        ++i;
+    }
+    return i;
+}
+
+
+/// Share of the limit the ring gets on each run. dirq gets the rest, so the messages
+/// that spilled over there under load are not starved by a ring that is always full.
+/// Whatever dirq does not use goes back to the ring.
+static unsigned ringShare(unsigned limit)
+{
+    return (limit + 1) / 2;
+}
+
+
+/// Messages come from two sources, so put them back in the order they were produced.
+/// Otherwise, a stale message that spilled over to dirq could be applied after a newer one from the ring.
+template <typename MSG>
+static void sortByTimestamp(typename std::vector<MSG>::iterator begin, typename std::vector<MSG>::iterator end)
+{
+    std::stable_sort(begin, end, [](const MSG &a, const MSG &b) {
+        return a.timestamp() < b.timestamp();
+    });
+}
+
+
+/// Staging and deletion messages carry no timestamp. They are left in the order they were read.
+template <>
+void sortByTimestamp<fts3::events::MessageBringonline>(std::vector<fts3::events::MessageBringonline>::iterator,
+    std::vector<fts3::events::MessageBringonline>::iterator)
+{
+}
+
+
 template <typename MSG>
-static int genericConsumer(std::unique_ptr<DirQ> &dirq, unsigned limit, std::vector<MSG> &messages)
+static int genericConsumer(std::unique_ptr<DirQ> &dirq, std::unique_ptr<ShmRing> &ring,
+    unsigned limit, std::vector<MSG> &messages)
 {
     MSG event;
+    const size_t first = messages.size();
+    const std::string ringPath = dirq->getPath() + ".ring";
+
+    auto parseRing = [&messages](const std::string &payload) {
+        MSG ringEvent;
+        if (ringEvent.ParseFromString(payload)) {
+            messages.emplace_back(ringEvent);
+        }
+        else {
+            FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Could not parse message from the ring" << fts3::common::commit;
+        }
+    };
+
+    unsigned i = drainRing(ring, ringPath, ringShare(limit), parseRing);
 
     const char *error = NULL;
     dirq_clear_error(*dirq);
 
-    unsigned i = 0;
     for (auto iter = dirq_first(*dirq); iter != NULL && i < limit; iter = dirq_next(*dirq), ++i) {
         if (dirq_lock(*dirq, iter, 0) == 0) {
             const char *path = dirq_get_path(*dirq, iter);
@@ -72,6 +138,9 @@ static int genericConsumer(std::unique_ptr<DirQ> &dirq, unsigned limit, std::vec
         }
     }
 
+    drainRing(ring, ringPath, limit - i, parseRing);
+    sortByTimestamp<MSG>(messages.begin() + first, messages.end());
+
     error = dirq_get_errstr(*dirq);
     if (error) {
         FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Failed to consume messages: " << error << fts3::common::commit;
@@ -84,24 +153,44 @@ static int genericConsumer(std::unique_ptr<DirQ> &dirq, unsigned limit, std::vec
 
 int Consumer::runConsumerStatus(std::vector<fts3::events::Message> &messages)
 {
-    return genericConsumer<fts3::events::Message>(statusQueue, limit, messages);
+    return genericConsumer<fts3::events::Message>(statusQueue, statusRing, limit, messages);
 }
 
 
 int Consumer::runConsumerStall(std::vector<fts3::events::MessageUpdater> &messages)
 {
-    return genericConsumer<fts3::events::MessageUpdater>(stalledQueue, limit, messages);
+    return genericConsumer<fts3::events::MessageUpdater>(stalledQueue, stalledRing, limit, messages);
 }
 
 
 int Consumer::runConsumerLog(std::map<int, fts3::events::MessageLog> &messages)
 {
     fts3::events::MessageLog buffer;
+    const std::string ringPath = logQueue->getPath() + ".ring";
+
+    // Keep the most recent message for each file, whichever source it came from
+    auto store = [&messages](const fts3::events::MessageLog &msg) {
+        auto stored = messages.find(msg.file_id());
+        if (stored == messages.end() || stored->second.timestamp() <= msg.timestamp()) {
+            messages[msg.file_id()] = msg;
+        }
+    };
+
+    auto parseRing = [&store](const std::string &payload) {
+        fts3::events::MessageLog ringEvent;
+        if (ringEvent.ParseFromString(payload)) {
+            store(ringEvent);
+        }
+        else {
+            FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Could not parse message from the ring" << fts3::common::commit;
+        }
+    };
+
+    unsigned i = drainRing(logRing, ringPath, ringShare(limit), parseRing);
 
     const char *error = NULL;
     dirq_clear_error(*logQueue);
 
-    unsigned i = 0;
     for (auto iter = dirq_first(*logQueue); iter != NULL && i < limit; iter = dirq_next(*logQueue), ++i) {
         if (dirq_lock(*logQueue, iter, 0) == 0) {
             const char *path = dirq_get_path(*logQueue, iter);
@@ -116,7 +205,7 @@ int Consumer::runConsumerLog(std::map<int, fts3::events::MessageLog> &messages)
                 << fts3::common::commit;
             }
 
-            messages[buffer.file_id()] = buffer;
+            store(buffer);
             if (dirq_remove(*logQueue, iter) < 0) {
                 error = dirq_get_errstr(*logQueue);
                 FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Failed to remove message from queue (" << path << "): "
@@ -127,6 +216,8 @@ int Consumer::runConsumerLog(std::map<int, fts3::events::MessageLog> &messages)
         }
     }
 
+    drainRing(logRing, ringPath, limit - i, parseRing);
+
     error = dirq_get_errstr(*logQueue);
     if (error) {
         FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Failed to consume messages: " << error << fts3::common::commit;
@@ -139,13 +230,13 @@ int Consumer::runConsumerLog(std::map<int, fts3::events::MessageLog> &messages)
 
 int Consumer::runConsumerDeletions(std::vector<fts3::events::MessageBringonline> &messages)
 {
-    return genericConsumer<fts3::events::MessageBringonline>(deletionQueue, limit, messages);
+    return genericConsumer<fts3::events::MessageBringonline>(deletionQueue, deletionRing, limit, messages);
 }
 
 
 int Consumer::runConsumerStaging(std::vector<fts3::events::MessageBringonline> &messages)
 {
-    return genericConsumer<fts3::events::MessageBringonline>(stagingQueue, limit, messages);
+    return genericConsumer<fts3::events::MessageBringonline>(stagingQueue, stagingRing, limit, messages);
 }
 
 
@@ -153,10 +244,16 @@ int Consumer::runConsumerMonitoring(std::vector<std::string> &messages)
 {
     std::string content;
 
+    const std::string ringPath = monitoringQueue->getPath() + ".ring";
+    auto parseRing = [&messages](const std::string &payload) {
+        messages.emplace_back(payload);
+    };
+
+    unsigned i = drainRing(monitoringRing, ringPath, ringShare(limit), parseRing);
+
     const char *error = NULL;
     dirq_clear_error(*monitoringQueue);
 
-    unsigned i = 0;
     for (auto iter = dirq_first(*monitoringQueue); iter != NULL && i < limit; iter = dirq_next(*monitoringQueue), ++i) {
         if (dirq_lock(*monitoringQueue, iter, 0) == 0) {
             const char *path = dirq_get_path(*monitoringQueue, iter);
@@ -183,6 +280,8 @@ int Consumer::runConsumerMonitoring(std::vector<std::string> &messages)
         }
     }
 
+    drainRing(monitoringRing, ringPath, limit - i, parseRing);
+
     error = dirq_get_errstr(*monitoringQueue);
     if (error) {
         FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Failed to consume messages: " << error << fts3::common::commit;
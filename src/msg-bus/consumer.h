@@ -29,6 +29,7 @@
 #include "events.h"
 
 struct DirQ;
+class ShmRing;
 
 class Consumer
 {
@@ -42,6 +43,15 @@ private:
     std::unique_ptr<DirQ> stagingQueue;
     std::unique_ptr<DirQ> deletionQueue;
 
+    // Shared memory rings, drained together with the dirq queues, each getting its share
+    // of the limit. Opened lazily, since they may be created after the consumer.
+    std::unique_ptr<ShmRing> monitoringRing;
+    std::unique_ptr<ShmRing> statusRing;
+    std::unique_ptr<ShmRing> stalledRing;
+    std::unique_ptr<ShmRing> logRing;
+    std::unique_ptr<ShmRing> stagingRing;
+    std::unique_ptr<ShmRing> deletionRing;
+
 public:
 
     Consumer(const std::string &baseDir, unsigned limit = 10000);
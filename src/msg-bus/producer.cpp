@@ -24,14 +24,20 @@
 #include <glib.h>
 #include <boost/thread/tss.hpp>
 #include "DirQ.h"
+#include "ShmRing.h"
+#include "Wakeup.h"
 
 #include "common/Logger.h"
 
 
-Producer::Producer(const std::string &baseDir): baseDir(baseDir),
+Producer::Producer(const std::string &baseDir, bool wakeupConsumer): baseDir(baseDir),
     monitoringQueue(new DirQ(baseDir + "/monitoring")), statusQueue(new DirQ(baseDir + "/status")),
     stalledQueue(new DirQ(baseDir + "/stalled")), logQueue(new DirQ(baseDir + "/logs")),
-    deletionQueue(new DirQ(baseDir + "/deletion")), stagingQueue(new DirQ(baseDir + "/staging"))
+    deletionQueue(new DirQ(baseDir + "/deletion")), stagingQueue(new DirQ(baseDir + "/staging")),
+    monitoringRing(ShmRing::open(baseDir + "/monitoring.ring")), statusRing(ShmRing::open(baseDir + "/status.ring")),
+    logRing(ShmRing::open(baseDir + "/logs.ring")), deletionRing(ShmRing::open(baseDir + "/deletion.ring")),
+    stagingRing(ShmRing::open(baseDir + "/staging.ring")),
+    consumerWakeup(wakeupConsumer ? new WakeupNotifier(baseDir + "/consumer.wakeup") : NULL)
 {
 }
 
@@ -60,9 +66,15 @@ static int producerDirqW(dirq_t, char *buffer, size_t length)
 }
 
 
-static int writeMessage(std::unique_ptr<DirQ> &dirqHandle, const google::protobuf::Message &msg)
+/// Try the ring first, and spill into the dirq queue if there is no ring, it is disabled or full,
+/// or the message is too big
+static int writeMessage(std::unique_ptr<DirQ> &dirqHandle, std::unique_ptr<ShmRing> &ring, const std::string &serialized)
 {
-    populateBuffer(msg.SerializeAsString());
+    if (ring && ring->push(serialized)) {
+        return 0;
+    }
+
+    populateBuffer(serialized);
     if (dirq_add(*dirqHandle, producerDirqW) == NULL) {
         return dirq_get_errcode(*dirqHandle);
     }
@@ -73,33 +85,36 @@ static int writeMessage(std::unique_ptr<DirQ> &dirqHandle, const google::protobu
 
 int Producer::runProducerStatus(const fts3::events::Message &msg)
 {
-    return writeMessage(statusQueue, msg);
+    int ret = writeMessage(statusQueue, statusRing, msg.SerializeAsString());
+    if (ret == 0 && consumerWakeup) {
+        consumerWakeup->notify();
+    }
+    return ret;
 }
 
 
 int Producer::runProducerLog(const fts3::events::MessageLog &msg)
 {
-    return writeMessage(logQueue, msg);
+    int ret = writeMessage(logQueue, logRing, msg.SerializeAsString());
+    if (ret == 0 && consumerWakeup) {
+        consumerWakeup->notify();
+    }
+    return ret;
 }
 
 int Producer::runProducerDeletions(const fts3::events::MessageBringonline &msg)
 {
-    return writeMessage(deletionQueue, msg);
+    return writeMessage(deletionQueue, deletionRing, msg.SerializeAsString());
 }
 
 
 int Producer::runProducerStaging(const fts3::events::MessageBringonline &msg)
 {
-    return writeMessage(stagingQueue, msg);
+    return writeMessage(stagingQueue, stagingRing, msg.SerializeAsString());
 }
 
 
 int Producer::runProducerMonitoring(const std::string &serialized)
 {
-    populateBuffer(serialized);
-    if (dirq_add(*monitoringQueue, producerDirqW) == NULL) {
-        return dirq_get_errcode(*monitoringQueue);
-    }
-
-    return 0;
+    return writeMessage(monitoringQueue, monitoringRing, serialized);
 }
@@ -27,6 +27,8 @@
 #include "events.h"
 
 struct DirQ;
+class ShmRing;
+class WakeupNotifier;
 
 class Producer {
 private:
@@ -38,8 +40,22 @@ private:
     std::unique_ptr<DirQ> deletionQueue;
     std::unique_ptr<DirQ> stagingQueue;
 
+    // Shared memory rings, used in front of the dirq queues when the server enables them
+    std::unique_ptr<ShmRing> monitoringRing;
+    std::unique_ptr<ShmRing> statusRing;
+    std::unique_ptr<ShmRing> logRing;
+    std::unique_ptr<ShmRing> deletionRing;
+    std::unique_ptr<ShmRing> stagingRing;
+
+    // Tells the server there are new status or log messages
+    std::unique_ptr<WakeupNotifier> consumerWakeup;
+
 public:
-    Producer(const std::string &baseDir);
+    /// Constructor
+    /// @param baseDir          Messaging directory
+    /// @param wakeupConsumer   Wake up the server when status or log messages are written.
+    ///                         Disable it when re-queueing from the consumer itself.
+    Producer(const std::string &baseDir, bool wakeupConsumer = true);
 
     ~Producer();
 
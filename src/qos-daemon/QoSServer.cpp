@@ -28,6 +28,7 @@
 #include "task/HttpPollTask.h"
 #include "task/CDMIPollTask.h"
 #include "task/ArchivingPollTask.h"
+#include "task/PollScheduler.h"
 #include "task/WaitingRoom.h"
 #include "fetch/FetchStaging.h"
 #include "fetch/FetchCancelStaging.h"
@@ -152,6 +153,8 @@ void QoSServer::start(void)
     systemThreads.create_thread(boost::bind(&DeletionStateUpdater::run, &deletionStateUpdater));
     systemThreads.create_thread(boost::bind(&StagingStateUpdater::run, &stagingStateUpdater));
     systemThreads.create_thread(boost::bind(&ArchivingStateUpdater::run, &archivingStateUpdater));
+    // Durations of past requests, for the poll intervals
+    systemThreads.create_thread(boost::bind(&PollScheduler::run, &PollScheduler::instance()));
 }
 
 
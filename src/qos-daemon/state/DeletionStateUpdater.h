@@ -63,6 +63,7 @@ public:
         // lock the vector
         boost::mutex::scoped_lock lock(m);
         updates.emplace_back(jobId, fileId, state, error.String(), error.IsRecoverable());
+        notifyIfFull();
         FTS3_COMMON_LOGGER_NEWLOG(INFO) << "DELETION Update : "
                 << fileId << "  " << state << "  " << error.String() << " " << jobId << " " << error.IsRecoverable()
                 << commit;
@@ -78,6 +78,7 @@ public:
                 }
             }
         }
+        notifyIfFull();
     }
 
     /**
@@ -99,20 +100,41 @@ public:
 
 protected:
 
+    /// Updates are sent to the DB as soon as there are this many pending
+    static constexpr size_t FLUSH_SIZE = 1000;
+    /// Otherwise, every this many seconds
+    static constexpr int FLUSH_INTERVAL = 10;
+
+    /// Wake up the DB thread if there are enough pending updates
+    /// Must be called with m held, after adding to updates
+    void notifyIfFull()
+    {
+        if (updates.size() >= FLUSH_SIZE) {
+            flushCondition.notify_one();
+        }
+    }
+
     /// this routine is executed in a separate thread
     void runImpl(UpdateStateFunc update_state)
     {
         // temporary vector for DB update
         std::vector<MinFileStatus> tmp;
+        // after a failure, wait the full interval before trying again
+        bool backoff = false;
 
         while (!boost::this_thread::interruption_requested()) {
             try {
-                // wait 10 seconds before checking again
-                boost::this_thread::sleep(boost::posix_time::seconds(10));
+                if (backoff) {
+                    boost::this_thread::sleep(boost::posix_time::seconds(FLUSH_INTERVAL));
+                    backoff = false;
+                }
                 // critical section
                 {
                     // lock the vector
                     boost::mutex::scoped_lock lock(m);
+                    // wait until there are enough updates, or for the interval
+                    flushCondition.timed_wait(lock, boost::posix_time::seconds(FLUSH_INTERVAL),
+                        [this]() { return updates.size() >= FLUSH_SIZE; });
                     // if the vector is empty there is nothing to do
                     if (updates.empty())
                         continue;
@@ -130,11 +152,13 @@ protected:
             catch (std::exception& ex) {
                 FTS3_COMMON_LOGGER_NEWLOG(ERR) << ex.what() << fts3::common::commit;
                 recover(tmp);
+                backoff = true;
             }
             catch(...) //use catch-all, the state must be recovered no matter what
             {
                 FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Something went really bad, trying to recover!" << fts3::common::commit;
                 recover(tmp);
+                backoff = true;
             }
             tmp.clear();
         }
@@ -146,6 +170,8 @@ protected:
     std::vector<MinFileStatus> updates;
     /// the mutex guarding the above vector
     boost::mutex m;
+    /// signaled when the vector is big enough to be flushed
+    boost::condition_variable flushCondition;
     /// DB interface
     GenericDbIfce& db;
     /// operation name ('_delete' or '_staging')
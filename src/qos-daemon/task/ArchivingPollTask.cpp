@@ -22,6 +22,7 @@
 #include "common/Logger.h"
 
 #include "ArchivingPollTask.h"
+#include "PollScheduler.h"
 
 boost::shared_mutex ArchivingPollTask::mx;
 
@@ -115,9 +116,10 @@ void ArchivingPollTask::run(const boost::any&)
 
 	// Schedule a new poll
 	if (status == 0 || forcePoll) {
-		time_t interval = getPollInterval(++nPolls);
 		time_t now = time(NULL);
-		wait_until = now + interval;
+		wait_until = PollScheduler::instance().nextPoll(PollScheduler::ARCHIVING,
+		    ctx.getStorageEndpoint(), ctx.getStartTime(), getPollInterval(++nPolls));
+		time_t interval = wait_until - now;
 
 		FTS3_COMMON_LOGGER_NEWLOG(INFO) << "ARCHIVING polling " << ctx.getLogMsg() << commit;
 		FTS3_COMMON_LOGGER_NEWLOG(INFO) << "ARCHIVING polling next attempt in " << interval << " seconds" << commit;
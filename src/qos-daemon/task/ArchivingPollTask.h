@@ -84,11 +84,11 @@ public:
     virtual void run(const boost::any &);
 
     /**
-     * @return : true if the task is still waiting, false otherwise
+     * @return : the time at which the task stops waiting
      */
-    bool waiting(time_t now)
+    time_t getWaitUntil() const
     {
-        return wait_until > now;
+        return wait_until;
     }
 
     static void cancel(const std::set<std::pair<std::string, std::string> > &urls)
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef GFAL2CONTEXTPOOL_H_
+#define GFAL2CONTEXTPOOL_H_
+
+#include <string>
+
+#include <boost/thread/mutex.hpp>
+#include <gfal_api.h>
+
+#include "common/IdlePool.h"
+
+/**
+ * Keeps initialized gfal2 contexts around, so tasks do not pay for the plugin
+ * loading and the configuration parsing each time one is created.
+ *
+ * Idle contexts are kept by the proxy certificate they were configured with,
+ * so a task for the same credential gets back one with its sessions still open.
+ * The per-task options (space token, bearer token) are cleared before a context
+ * goes back to the pool.
+ */
+class Gfal2ContextPool
+{
+public:
+
+    /// Maximum number of idle contexts kept, beyond that they are freed
+    static const size_t MAX_IDLE = 64;
+
+    /// Get the pool
+    static Gfal2ContextPool& instance();
+
+    /**
+     * Set the information system used by the contexts created from now on
+     *
+     * @param infosys : name of the information system, or 'false' to disable it
+     */
+    void setInfosys(const std::string &infosys);
+
+    /**
+     * Get an idle context configured for the given credential,
+     * or create a new one, with no credential set, if there is none
+     *
+     * @param operation  : the operation, e.g. 'DELETION', for the error messages
+     * @param credential : the proxy certificate
+     */
+    gfal2_context_t acquire(const std::string &operation, const std::string &credential);
+
+    /**
+     * Get an idle context configured for the given credential
+     *
+     * @return NULL if there is none
+     */
+    gfal2_context_t tryAcquire(const std::string &credential);
+
+    /**
+     * Give a context back
+     *
+     * @param context    : the context
+     * @param credential : the proxy certificate set on the context, empty if none
+     */
+    void release(gfal2_context_t context, const std::string &credential);
+
+private:
+    Gfal2ContextPool();
+
+    /// Create and configure a new context
+    gfal2_context_t create(const std::string &operation);
+
+    /// Remove the options that belong to the task that used the context
+    static bool reset(gfal2_context_t context);
+
+    boost::mutex mutex;
+    /// the infosys used to create all gfal2 contexts
+    std::string infosys;
+    /// idle contexts, by credential
+    fts3::common::IdlePool<gfal2_context_t> idle;
+};
+
+#endif // GFAL2CONTEXTPOOL_H_
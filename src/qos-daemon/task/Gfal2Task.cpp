@@ -23,9 +23,6 @@
 
 using namespace fts3::common;
 
-std::string Gfal2Task::infosys;
-
-
 void Gfal2Task::setProxy(const JobContext &ctx)
 {
     GError *error = NULL;
@@ -40,6 +37,18 @@ void Gfal2Task::setProxy(const JobContext &ctx)
         throw UserError(ss.str());
     }
 
+    // Nothing to do if the context is already set up for this proxy
+    if (gfal2_ctx.credential == ctx.getProxy()) {
+        return;
+    }
+
+    // Prefer an idle context that was already used with this proxy, it may still have open sessions
+    gfal2_context_t pooled = Gfal2ContextPool::instance().tryAcquire(ctx.getProxy());
+    if (pooled) {
+        gfal2_ctx.replace(pooled, ctx.getProxy());
+        return;
+    }
+
     char* cert = const_cast<char*>(ctx.getProxy().c_str());
 
     int status = gfal2_set_opt_string(gfal2_ctx, "X509", "CERT", cert, &error);
@@ -63,6 +72,8 @@ void Gfal2Task::setProxy(const JobContext &ctx)
         g_clear_error(&error);
         throw UserError(ss.str());
     }
+
+    gfal2_ctx.credential = ctx.getProxy();
 }
 
 
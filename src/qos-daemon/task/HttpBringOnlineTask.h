@@ -52,10 +52,10 @@ public:
      */
     HttpBringOnlineTask(HttpStagingContext&& copy_ctx) : Gfal2Task("HTTP_STAGING"), ctx(std::move(copy_ctx))
     {
+        // set the proxy certificate (first, since it may switch to a pooled context)
+        setProxy(ctx);
         // set up the space token
         setSpaceToken(ctx.getSpaceToken());
-        // set the proxy certificate
-        setProxy(ctx);
         // add urls to active
         auto surls = ctx.getSurls();
         boost::unique_lock<boost::shared_mutex> lock(mx);
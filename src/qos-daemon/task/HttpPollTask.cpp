@@ -23,6 +23,7 @@
 
 #include "BringOnlineTask.h"
 #include "HttpPollTask.h"
+#include "PollScheduler.h"
 
 
 void HttpPollTask::run(const boost::any&)
@@ -205,9 +206,10 @@ void HttpPollTask::run(const boost::any&)
 
     // If status was 0, not everything is terminal, so schedule a new poll
     if (status == 0 || forcePoll) {
-        time_t interval = getPollInterval(++nPolls);
         time_t now = time(NULL);
-        wait_until = now + interval;
+        wait_until = PollScheduler::instance().nextPoll(PollScheduler::STAGING,
+            ctx.getStorageEndpoint(), ctx.getStartTime(), getPollInterval(++nPolls));
+        time_t interval = wait_until - now;
 
         FTS3_COMMON_LOGGER_NEWLOG(INFO) << "BRINGONLINE polling " << ctx.getLogMsg() << commit;
         FTS3_COMMON_LOGGER_NEWLOG(INFO) << "BRINGONLINE next attempt in " << interval << " seconds" << commit;
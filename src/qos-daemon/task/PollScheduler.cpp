@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "PollScheduler.h"
+
+#include <algorithm>
+#include <boost/thread.hpp>
+
+#include "common/Logger.h"
+#include "config/ServerConfig.h"
+#include "db/generic/SingleDbInstance.h"
+
+using namespace fts3::common;
+using fts3::config::ServerConfig;
+
+
+PollScheduler& PollScheduler::instance()
+{
+    // Never destroyed, since the waiting rooms may still use it while the process exits
+    static PollScheduler *scheduler = new PollScheduler;
+    return *scheduler;
+}
+
+
+time_t PollScheduler::nextPoll(Operation operation, const std::string &endpoint, time_t started, time_t fallback)
+{
+    time_t now = time(NULL);
+    int rateLimit = ServerConfig::instance().get<int>("StagingPollRateLimit");
+
+    boost::mutex::scoped_lock lock(mutex);
+
+    time_t interval = fallback;
+    auto history = durations[operation].find(endpoint);
+    if (history != durations[operation].end()) {
+        interval = PollPlanner::getInterval(history->second, now - started, fallback);
+    }
+
+    return planner.reserve(endpoint, now + interval, now, rateLimit);
+}
+
+
+void PollScheduler::setDurations(Operation operation, std::map<std::string, std::vector<time_t>> &&newDurations)
+{
+    for (auto i = newDurations.begin(); i != newDurations.end(); ++i) {
+        std::sort(i->second.begin(), i->second.end());
+    }
+
+    boost::mutex::scoped_lock lock(mutex);
+    durations[operation].swap(newDurations);
+}
+
+
+void PollScheduler::run()
+{
+    while (!boost::this_thread::interruption_requested()) {
+        refresh();
+        boost::this_thread::sleep(boost::posix_time::seconds(REFRESH_INTERVAL));
+    }
+}
+
+
+void PollScheduler::refresh()
+{
+    // The workers keep using the previous durations meanwhile
+    try {
+        std::map<std::string, std::vector<time_t>> staging, archiving;
+        db::DBSingleton::instance().getDBObjectInstance()->getStagingDurations(staging, HISTORY_WINDOW);
+        db::DBSingleton::instance().getDBObjectInstance()->getArchivingDurations(archiving, HISTORY_WINDOW);
+
+        FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Poll scheduler loaded the durations for "
+            << staging.size() << " staging and " << archiving.size() << " archiving endpoints"
+            << commit;
+
+        setDurations(STAGING, std::move(staging));
+        setDurations(ARCHIVING, std::move(archiving));
+    }
+    catch (const std::exception &e) {
+        FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Poll scheduler could not load the durations: " << e.what() << commit;
+    }
+}
+
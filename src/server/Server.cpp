@@ -31,6 +31,7 @@
 #include "services/optimizer/OptimizerService.h"
 #include "services/transfers/MessageProcessingService.h"
 #include "services/transfers/SupervisorService.h"
+#include "services/transfers/UrlCopyWorkerService.h"
 
 
 namespace fts3 {
@@ -90,6 +91,7 @@ void Server::start()
     }
 
     addService(new OptimizerService(heartBeatService));
+    addService(new UrlCopyWorkerService);
     addService(new TransfersService);
     addService(new ReuseTransfersService);
     addService(new SupervisorService);
@@ -23,6 +23,7 @@
 #include <signal.h>
 
 #include <boost/filesystem.hpp>
+#include <algorithm>
 #include <sstream>
 #include <common/PidTools.h>
 
@@ -32,6 +33,7 @@
 #include "common/Logger.h"
 #include "common/panic.h"
 #include "db/generic/SingleDbInstance.h"
+#include "msg-bus/ShmRing.h"
 
 #include "Server.h"
 
@@ -100,6 +102,14 @@ static void doServer(void)
     }
     theLogger().setLogLevel(Logger::getLogLevel(ServerConfig::instance().get<std::string>("LogLevel")));
     theLogger().setProfiling(ServerConfig::instance().get<bool>("Profiling"));
+    // Apply the changes of the log level without restarting
+    ServerConfig::instance().subscribe([]() {
+        theLogger().setLogLevel(Logger::getLogLevel(ServerConfig::instance().get<std::string>("LogLevel")));
+        theLogger().setProfiling(ServerConfig::instance().get<bool>("Profiling"));
+    }, {"LogLevel", "Profiling"});
+    if (ServerConfig::instance().get<bool>("LogAsync")) {
+        theLogger().setAsync(true, std::max(1, ServerConfig::instance().get<int>("LogAsyncBufferSize")));
+    }
 
     FTS3_COMMON_LOGGER_NEWLOG(INFO)<< "Starting server..." << commit;
 
@@ -181,6 +191,17 @@ static void runEnvironmentChecks()
     checkPath(monDir + "/status", R_OK | W_OK, fs::directory_file);
     checkPath(monDir + "/stalled", R_OK | W_OK, fs::directory_file);
     checkPath(monDir + "/logs", R_OK | W_OK, fs::directory_file);
+
+    // Create, enable or disable the shared memory rings in front of the queues the server consumes
+    std::string transport = ServerConfig::instance().get<std::string>("MessagingTransport");
+    if (transport != "dirq" && transport != "shm") {
+        throw SystemError("Unknown messaging transport " + transport);
+    }
+    bool useRings = (transport == "shm");
+    ShmRing::configure(monDir + "/monitoring.ring", useRings);
+    ShmRing::configure(monDir + "/status.ring", useRings);
+    ShmRing::configure(monDir + "/stalled.ring", useRings);
+    ShmRing::configure(monDir + "/logs.ring", useRings);
 }
 
 
@@ -18,6 +18,11 @@
  * limitations under the License.
  */
 
+#include <atomic>
+#include <exception>
+#include <boost/functional/hash.hpp>
+#include <boost/thread.hpp>
+
 #include "config/ServerConfig.h"
 #include "Optimizer.h"
 #include "OptimizerConstants.h"
@@ -36,7 +41,7 @@ Optimizer::Optimizer(OptimizerDataSource *ds, OptimizerCallbacks *callbacks):
     optimizerSteadyInterval(boost::posix_time::seconds(60)), maxNumberOfStreams(10),
     maxSuccessRate(100), lowSuccessRate(97), baseSuccessRate(96),
     decreaseStepSize(1), increaseStepSize(1), increaseAggressiveStepSize(2),
-    emaAlpha(EMA_ALPHA)
+    emaAlpha(EMA_ALPHA), workers(1)
 {
 }
 
@@ -90,6 +95,66 @@ void Optimizer::setEmaAlpha(double alpha)
 }
 
 
+void Optimizer::setWorkers(unsigned newValue)
+{
+    workers = std::max(newValue, 1u);
+}
+
+
+PairStateStore::Shard &PairStateStore::getShard(const Pair &pair)
+{
+    size_t hash = 0;
+    boost::hash_combine(hash, pair.source);
+    boost::hash_combine(hash, pair.destination);
+    return shards[hash % N_SHARDS];
+}
+
+
+bool PairStateStore::get(const Pair &pair, PairState *state)
+{
+    Shard &shard = getShard(pair);
+    boost::mutex::scoped_lock lock(shard.mutex);
+
+    auto i = shard.states.find(pair);
+    if (i == shard.states.end()) {
+        return false;
+    }
+    *state = i->second;
+    return true;
+}
+
+
+void PairStateStore::set(const Pair &pair, const PairState &state)
+{
+    Shard &shard = getShard(pair);
+    boost::mutex::scoped_lock lock(shard.mutex);
+    shard.states[pair] = state;
+}
+
+
+/// Make sure prefetched values do not outlive the optimizer run
+class PrefetchGuard {
+public:
+    PrefetchGuard(OptimizerDataSource *dataSource, const std::list<Pair> &pairs): dataSource(dataSource)
+    {
+        std::vector<boost::posix_time::time_duration> timeFrames = {
+            boost::posix_time::seconds(SHORT_TIME_FRAME),
+            boost::posix_time::seconds(MEDIUM_TIME_FRAME),
+            boost::posix_time::seconds(LONG_TIME_FRAME)
+        };
+        dataSource->prefetch(pairs, timeFrames, true);
+    }
+
+    ~PrefetchGuard()
+    {
+        dataSource->clearPrefetched();
+    }
+
+private:
+    OptimizerDataSource *dataSource;
+};
+
+
 void Optimizer::run(void)
 {
     FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Optimizer run" << commit;
@@ -99,8 +164,65 @@ void Optimizer::run(void)
         // See FTS-1094
         pairs.sort();
 
-        for (auto i = pairs.begin(); i != pairs.end(); ++i) {
-            runOptimizerForPair(*i);
+        // Get the metrics of all pairs with a few bulk queries, instead of several queries per pair
+        PrefetchGuard prefetched(dataSource, pairs);
+
+        // Evaluate the pairs concurrently, each worker picking the next pair in order
+        std::vector<PairDecision> decisions(pairs.begin(), pairs.end());
+        std::vector<std::exception_ptr> errors(decisions.size());
+        std::atomic<size_t> next(0);
+        std::atomic<bool> failed(false);
+
+        auto worker = [&]() {
+            for (size_t i = next++; i < decisions.size() && !failed; i = next++) {
+                try {
+                    evaluatePair(&decisions[i]);
+                }
+                catch (const boost::thread_interrupted&) {
+                    throw;
+                }
+                catch (...) {
+                    errors[i] = std::current_exception();
+                    failed = true;
+                }
+            }
+        };
+
+        unsigned nThreads = std::min<size_t>(workers, decisions.size());
+        if (nThreads <= 1) {
+            worker();
+        }
+        else {
+            boost::thread_group group;
+            try {
+                for (unsigned i = 0; i < nThreads; ++i) {
+                    group.create_thread(worker);
+                }
+                group.join_all();
+            }
+            catch (...) {
+                group.interrupt_all();
+                group.join_all();
+                throw;
+            }
+        }
+
+        // Commit in order, so the decisions are stored the same way regardless of the number of workers.
+        // Pairs evaluated before an error are still committed, so the data source and inMemoryStore agree.
+        std::exception_ptr firstError;
+        for (size_t i = 0; i < decisions.size(); ++i) {
+            if (errors[i]) {
+                if (!firstError) {
+                    firstError = errors[i];
+                }
+                continue;
+            }
+            commitDecision(decisions[i]);
+        }
+        dataSource->flushDecisions();
+
+        if (firstError) {
+            std::rethrow_exception(firstError);
         }
     }
     catch (std::exception &e) {
@@ -114,11 +236,44 @@ void Optimizer::run(void)
 
 void Optimizer::runOptimizerForPair(const Pair &pair)
 {
-    OptimizerMode optMode = dataSource->getOptimizerMode(pair.source, pair.destination);
-    if(optimizeConnectionsForPair(optMode, pair)) {
-        // Optimize streams only if optimizeConnectionsForPair did store something
-        optimizeStreamsForPair(optMode, pair);
+    PairDecision decision(pair);
+    evaluatePair(&decision);
+    commitDecision(decision);
+    dataSource->flushDecisions();
+}
+
+
+void Optimizer::evaluatePair(PairDecision *result)
+{
+    const Pair &pair = result->pair;
+    result->mode = dataSource->getOptimizerMode(pair.source, pair.destination);
+    result->store = optimizeConnectionsForPair(result->mode, pair, result);
+}
+
+
+void Optimizer::commitDecision(const PairDecision &decision)
+{
+    if (!decision.store) {
+        return;
     }
+
+    FTS3_COMMON_LOGGER_NEWLOG(INFO)
+        << "Optimizer: Active for " << decision.pair << " set to " << decision.decision
+        << ", running " << decision.current.activeCount
+        << " (" << decision.elapsed.wall << "ns)" << commit;
+    FTS3_COMMON_LOGGER_NEWLOG(INFO)
+        << decision.rationale << commit;
+
+    dataSource->storeOptimizerDecision(decision.pair, decision.decision, decision.current,
+        decision.diff, decision.rationale);
+
+    if (callbacks) {
+        callbacks->notifyDecision(decision.pair, decision.decision, decision.current,
+            decision.diff, decision.rationale);
+    }
+
+    // Optimize streams only if optimizeConnectionsForPair did store something
+    optimizeStreamsForPair(decision.mode, decision.pair);
 }
 
 }
@@ -21,11 +21,14 @@
 #ifndef FTS3_OPTIMIZER_H
 #define FTS3_OPTIMIZER_H
 
+#include <functional>
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include <boost/noncopyable.hpp>
+#include <boost/thread/mutex.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/timer/timer.hpp>
 #include <db/generic/LinkConfig.h>
@@ -33,6 +36,7 @@
 #include <msg-bus/producer.h>
 
 #include "common/Uri.h"
+#include "WindowStatistics.h"
 
 
 namespace fts3 {
@@ -82,6 +86,9 @@ struct PairState {
 };
 
 // To decouple the optimizer core logic from the data storage/representation
+// When the optimizer runs with more than one worker, the methods used to evaluate a pair
+// (from getOptimizerMode to getThroughputAsDestination) are called concurrently, so they
+// must be thread safe. The rest are always called from the thread that calls Optimizer::run.
 class OptimizerDataSource {
 public:
     virtual ~OptimizerDataSource()
@@ -90,6 +97,18 @@ public:
     // Return a list of pairs with active or submitted transfers
     virtual std::list<Pair> getActivePairs(void) = 0;
 
+    // Load in bulk what the methods below need for the given pairs and time frames.
+    // Until clearPrefetched is called, implementations may answer for those pairs from memory.
+    // If withTerminal is false, the caller does not need the statistics of the terminal transfers.
+    // By default, nothing is prefetched.
+    virtual void prefetch(const std::list<Pair> &, const std::vector<boost::posix_time::time_duration> &,
+        bool /*withTerminal*/)
+    {}
+
+    // Forget the prefetched values
+    virtual void clearPrefetched(void)
+    {}
+
     // Return the optimizer configuration value
     virtual OptimizerMode getOptimizerMode(const std::string &source, const std::string &dest) = 0;
 
@@ -108,6 +127,15 @@ public:
     // Get the success rate for the pair
     virtual double getSuccessRateForPair(const Pair&, const boost::posix_time::time_duration&, int *retryCount) = 0;
 
+    // Add to stats the bytes moved within the time frame by the transfers still running
+    virtual void getActiveStatistics(const Pair&, const boost::posix_time::time_duration&, WindowStatistics*)
+    {}
+
+    // Call callback for each transfer that reached a terminal state within the time frame
+    virtual void getTerminalTransfers(const boost::posix_time::time_duration&,
+        const std::function<void(const Pair&, const TerminalTransfer&)>&)
+    {}
+
     // Get the number of transfers in the given state
     virtual int getActive(const Pair&) = 0;
     virtual int getSubmitted(const Pair&) = 0;
@@ -122,6 +150,11 @@ public:
 
     // Permanently register the number of streams per active
     virtual void storeOptimizerStreams(const Pair &pair, int streams) = 0;
+
+    // Called once all the decisions of a run are stored.
+    // Implementations may buffer the two methods above until then.
+    virtual void flushDecisions(void)
+    {}
 };
 
 // Used by the optimizer to notify decisions
@@ -131,10 +164,47 @@ public:
         int diff, const std::string &rationale) = 0;
 };
 
+// Last known state of each pair, split in shards so workers evaluating
+// different pairs do not contend for the same lock
+class PairStateStore: public boost::noncopyable {
+public:
+    // Returns false if there is no state stored for the pair
+    bool get(const Pair &pair, PairState *state);
+    void set(const Pair &pair, const PairState &state);
+
+private:
+    static const size_t N_SHARDS = 16;
+
+    struct Shard {
+        boost::mutex mutex;
+        std::map<Pair, PairState> states;
+    };
+    Shard shards[N_SHARDS];
+
+    Shard &getShard(const Pair &pair);
+};
+
+// Outcome of the evaluation of a pair, kept until it is committed
+struct PairDecision {
+    Pair pair;
+    OptimizerMode mode;
+    // Set to true if there is a decision to store
+    bool store;
+    int decision;
+    PairState current;
+    int diff;
+    std::string rationale;
+    boost::timer::cpu_times elapsed;
+
+    PairDecision(const Pair &pair): pair(pair), mode(kOptimizerDisabled), store(false), decision(0), diff(0) {
+        elapsed.clear();
+    }
+};
+
 // Optimizer implementation
 class Optimizer: public boost::noncopyable {
 protected:
-    std::map<Pair, PairState> inMemoryStore;
+    PairStateStore inMemoryStore;
     OptimizerDataSource *dataSource;
     OptimizerCallbacks *callbacks;
     boost::posix_time::time_duration optimizerSteadyInterval;
@@ -146,10 +216,11 @@ protected:
     int decreaseStepSize;
     int increaseStepSize, increaseAggressiveStepSize;
     double emaAlpha;
+    unsigned workers;
 
     // Run the optimization algorithm for the number of connections.
-    // Returns true if a decision is stored
-    bool optimizeConnectionsForPair(OptimizerMode optMode, const Pair &);
+    // Returns true if there is a decision to store in result
+    bool optimizeConnectionsForPair(OptimizerMode optMode, const Pair &, PairDecision *result);
 
     // Run the optimization algorithm for the number of streams.
     void optimizeStreamsForPair(OptimizerMode optMode, const Pair &);
@@ -157,9 +228,16 @@ protected:
     // Stores into rangeActiveMin and rangeActiveMax the working range for the optimizer
     void getOptimizerWorkingRange(const Pair &pair, Range *range, StorageLimits *limits);
 
-    // Updates decision
+    // Updates the in memory state, and keeps the decision in result until it is committed
     void setOptimizerDecision(const Pair &pair, int decision, const PairState &current,
-        int diff, const std::string &rationale, boost::timer::cpu_times elapsed);
+        int diff, const std::string &rationale, boost::timer::cpu_times elapsed, PairDecision *result);
+
+    // Evaluate result->pair without storing anything into the data source
+    // Can be called concurrently for different pairs
+    void evaluatePair(PairDecision *result);
+
+    // Store the decision into the data source, and optimize the streams
+    void commitDecision(const PairDecision &decision);
 
 public:
     Optimizer(OptimizerDataSource *ds, OptimizerCallbacks *callbacks);
@@ -172,6 +250,7 @@ public:
     void setBaseSuccessRate(int);
     void setStepSize(int increase, int increaseAggressive, int decrease);
     void setEmaAlpha(double);
+    void setWorkers(unsigned);
     void run(void);
     void runOptimizerForPair(const Pair&);
 };
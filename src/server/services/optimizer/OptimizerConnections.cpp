@@ -43,13 +43,13 @@ static inline double exponentialMovingAverage(double sample, double alpha, doubl
 static boost::posix_time::time_duration calculateTimeFrame(time_t avgDuration)
 {
     if(avgDuration > 0 && avgDuration < 30) {
-        return boost::posix_time::minutes(5);
+        return boost::posix_time::seconds(SHORT_TIME_FRAME);
     }
     else if(avgDuration > 30 && avgDuration < 900) {
-        return boost::posix_time::minutes(15);
+        return boost::posix_time::seconds(MEDIUM_TIME_FRAME);
     }
     else {
-        return boost::posix_time::minutes(30);
+        return boost::posix_time::seconds(LONG_TIME_FRAME);
     }
 }
 
@@ -157,7 +157,7 @@ static int optimizeGoodSuccessRate(const PairState &current, const PairState &pr
 // the total number of connections between storages.
 // If the success rate is good, and the throughput improves, it will increase the number
 // of connections.
-bool Optimizer::optimizeConnectionsForPair(OptimizerMode optMode, const Pair &pair)
+bool Optimizer::optimizeConnectionsForPair(OptimizerMode optMode, const Pair &pair, PairDecision *result)
 {
     int decision = 0;
     std::stringstream rationale;
@@ -178,7 +178,7 @@ bool Optimizer::optimizeConnectionsForPair(OptimizerMode optMode, const Pair &pa
     // Initialize current state
     PairState current;
     current.timestamp = time(NULL);
-    current.avgDuration = dataSource->getAverageDuration(pair, boost::posix_time::minutes(30));
+    current.avgDuration = dataSource->getAverageDuration(pair, boost::posix_time::seconds(LONG_TIME_FRAME));
 
     boost::posix_time::time_duration timeFrame = calculateTimeFrame(current.avgDuration);
 
@@ -198,30 +198,29 @@ bool Optimizer::optimizeConnectionsForPair(OptimizerMode optMode, const Pair &pa
             rationale << "No information. Start halfway.";
         }
 
-        setOptimizerDecision(pair, decision, current, decision, rationale.str(), timer.elapsed());
+        setOptimizerDecision(pair, decision, current, decision, rationale.str(), timer.elapsed(), result);
 
         current.ema = current.throughput;
-        inMemoryStore[pair] = current;
+        inMemoryStore.set(pair, current);
 
         return true;
     }
 
     // There is information, but it is the first time seen since the restart
-    if (inMemoryStore.find(pair) == inMemoryStore.end()) {
+    PairState previous;
+    if (!inMemoryStore.get(pair, &previous)) {
         current.ema = current.throughput;
-        inMemoryStore[pair] = current;
+        inMemoryStore.set(pair, current);
         FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Store first feedback from " << pair << commit;
         return false;
     }
 
-    const PairState previous = inMemoryStore[pair];
-
     // Calculate new Exponential Moving Average
     current.ema = exponentialMovingAverage(current.throughput, emaAlpha, previous.ema);
 
     // If we have no range, leave it here
     if (range.min == range.max) {
-        setOptimizerDecision(pair, range.min, current, 0, "Range fixed", timer.elapsed());
+        setOptimizerDecision(pair, range.min, current, 0, "Range fixed", timer.elapsed(), result);
         return true;
     }
 
@@ -231,7 +230,7 @@ bool Optimizer::optimizeConnectionsForPair(OptimizerMode optMode, const Pair &pa
         if (throughput > limits.throughputSource) {
             decision = previousValue - decreaseStepSize;
             rationale << "Source throughput limitation reached (" << limits.throughputSource << ")";
-            setOptimizerDecision(pair, decision, current, 0, rationale.str(), timer.elapsed());
+            setOptimizerDecision(pair, decision, current, 0, rationale.str(), timer.elapsed(), result);
             return true;
         }
     }
@@ -240,7 +239,7 @@ bool Optimizer::optimizeConnectionsForPair(OptimizerMode optMode, const Pair &pa
         if (throughput > limits.throughputDestination) {
             decision = previousValue - decreaseStepSize;
             rationale << "Destination throughput limitation reached (" << limits.throughputDestination << ")";
-            setOptimizerDecision(pair, decision, current, 0, rationale.str(), timer.elapsed());
+            setOptimizerDecision(pair, decision, current, 0, rationale.str(), timer.elapsed(), result);
             return true;
         }
     }
@@ -321,27 +320,24 @@ bool Optimizer::optimizeConnectionsForPair(OptimizerMode optMode, const Pair &pa
     BOOST_ASSERT(decision > 0);
     BOOST_ASSERT(!rationale.str().empty());
 
-    setOptimizerDecision(pair, decision, current, decision - previousValue, rationale.str(), timer.elapsed());
+    setOptimizerDecision(pair, decision, current, decision - previousValue, rationale.str(),
+        timer.elapsed(), result);
     return true;
 }
 
 
 void Optimizer::setOptimizerDecision(const Pair &pair, int decision, const PairState &current,
-    int diff, const std::string &rationale, boost::timer::cpu_times elapsed)
+    int diff, const std::string &rationale, boost::timer::cpu_times elapsed, PairDecision *result)
 {
-    FTS3_COMMON_LOGGER_NEWLOG(INFO)
-        << "Optimizer: Active for " << pair << " set to " << decision << ", running " << current.activeCount
-        << " (" << elapsed.wall << "ns)" << commit;
-    FTS3_COMMON_LOGGER_NEWLOG(INFO)
-        << rationale << commit;
-
-    inMemoryStore[pair] = current;
-    inMemoryStore[pair].connections = decision;
-    dataSource->storeOptimizerDecision(pair, decision, current, diff, rationale);
-
-    if (callbacks) {
-        callbacks->notifyDecision(pair, decision, current, diff, rationale);
-    }
+    PairState newState(current);
+    newState.connections = decision;
+    inMemoryStore.set(pair, newState);
+
+    result->decision = decision;
+    result->current = current;
+    result->diff = diff;
+    result->rationale = rationale;
+    result->elapsed = elapsed;
 }
 
 }
@@ -35,6 +35,11 @@ namespace optimizer {
 
     const int DEFAULT_MIN_ACTIVE = 2;
     const int DEFAULT_LAN_ACTIVE = 10;
+
+    // Time frames, in seconds, used to evaluate a pair depending on the average duration of its transfers
+    const int SHORT_TIME_FRAME = 5 * 60;
+    const int MEDIUM_TIME_FRAME = 15 * 60;
+    const int LONG_TIME_FRAME = 30 * 60;
 }
 }
 
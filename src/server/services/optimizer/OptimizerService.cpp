@@ -22,6 +22,7 @@
 #include <monitoring/msg-ifce.h>
 #include "OptimizerService.h"
 #include "Optimizer.h"
+#include "OptimizerStatistics.h"
 
 #include "db/generic/SingleDbInstance.h"
 
@@ -31,6 +32,8 @@ namespace server {
 
 using optimizer::Optimizer;
 using optimizer::OptimizerCallbacks;
+using optimizer::OptimizerDataSource;
+using optimizer::OptimizerStatistics;
 using optimizer::PairState;
 
 
@@ -97,16 +100,30 @@ void OptimizerService::runService()
     auto increaseStep = config::ServerConfig::instance().get<int>("OptimizerIncreaseStep");
     auto increaseAggressiveStep = config::ServerConfig::instance().get<int>("OptimizerAggressiveIncreaseStep");
     auto decreaseStep = config::ServerConfig::instance().get<int>("OptimizerDecreaseStep");
+    auto workers = std::max(1, config::ServerConfig::instance().get<int>("OptimizerWorkers"));
 
     OptimizerNotifier optimizerCallbacks(
         config::ServerConfig::instance().get<bool>("MonitoringMessaging"),
         config::ServerConfig::instance().get<std::string>("MessagingDirectory")
     );
 
-    Optimizer optimizer(
-        db::DBSingleton::instance().getDBObjectInstance()->getOptimizerDataSource(),
-        &optimizerCallbacks
-    );
+    OptimizerDataSource *dataSource = db::DBSingleton::instance().getDBObjectInstance()->getOptimizerDataSource();
+    std::unique_ptr<OptimizerDataSource> streamingDataSource;
+
+    if (config::ServerConfig::instance().get<bool>("OptimizerStreamingStatistics")) {
+        try {
+            OptimizerStatistics::instance().rebuild(dataSource);
+        }
+        catch (std::exception &e) {
+            FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Could not rebuild the optimizer statistics, "
+                "they will be queried from the database: " << e.what() << fts3::common::commit;
+        }
+        streamingDataSource.reset(
+            new optimizer::StreamingOptimizerDataSource(dataSource, &OptimizerStatistics::instance()));
+        dataSource = streamingDataSource.get();
+    }
+
+    Optimizer optimizer(dataSource, &optimizerCallbacks);
     optimizer.setSteadyInterval(optimizerSteadyInterval);
     optimizer.setMaxNumberOfStreams(maxNumberOfStreams);
     optimizer.setMaxSuccessRate(maxSuccessRate);
@@ -114,6 +131,7 @@ void OptimizerService::runService()
     optimizer.setBaseSuccessRate(baseSuccessRate);
     optimizer.setEmaAlpha(emaAlpha);
     optimizer.setStepSize(increaseStep, increaseAggressiveStep, decreaseStep);
+    optimizer.setWorkers(workers);
 
     while (!boost::this_thread::interruption_requested()) {
         try {
@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "OptimizerStatistics.h"
+#include "common/Logger.h"
+
+using namespace fts3::common;
+
+
+namespace fts3 {
+namespace optimizer {
+
+
+OptimizerStatistics::OptimizerStatistics(time_t maxWindow): maxWindow(maxWindow),
+    maxBuckets(maxWindow / BUCKET_WIDTH + 1), ready(false)
+{
+}
+
+
+WindowStatistics *OptimizerStatistics::getBucket(PairBuckets &pairBuckets, long index)
+{
+    std::deque<WindowStatistics> &buckets = pairBuckets.buckets;
+
+    // Nothing stored is within the window anymore
+    if (buckets.empty() || index - pairBuckets.first >= long(buckets.size()) + maxBuckets) {
+        buckets.clear();
+        pairBuckets.first = index;
+    }
+
+    if (index < pairBuckets.first) {
+        long last = pairBuckets.first + buckets.size() - 1;
+        if (last - index >= maxBuckets) {
+            return NULL;
+        }
+        buckets.insert(buckets.begin(), pairBuckets.first - index, WindowStatistics());
+        pairBuckets.first = index;
+    }
+
+    while (index >= pairBuckets.first + long(buckets.size())) {
+        buckets.emplace_back();
+    }
+    while (long(buckets.size()) > maxBuckets) {
+        buckets.pop_front();
+        ++pairBuckets.first;
+    }
+
+    return &buckets[index - pairBuckets.first];
+}
+
+
+void OptimizerStatistics::record(const Pair &pair, const TerminalTransfer &transfer)
+{
+    if (transfer.end <= 0) {
+        return;
+    }
+
+    boost::mutex::scoped_lock lock(mutex);
+    PairBuckets &pairBuckets = pairs[pair];
+
+    // Spread the bytes over the buckets the transfer was running, at its average rate
+    if (transfer.isFinished()) {
+        time_t duration = transfer.end - transfer.start;
+        if (duration <= 0) {
+            WindowStatistics *bucket = getBucket(pairBuckets, transfer.end / BUCKET_WIDTH);
+            if (bucket) {
+                bucket->bytes += transfer.filesize;
+            }
+        }
+        else if (transfer.filesize > 0) {
+            double rate = double(transfer.filesize / duration);
+            time_t from = std::max(transfer.start, transfer.end - maxWindow);
+            for (long index = from / BUCKET_WIDTH; index <= transfer.end / BUCKET_WIDTH; ++index) {
+                time_t overlap = std::min(transfer.end, (index + 1) * BUCKET_WIDTH) -
+                    std::max(from, index * BUCKET_WIDTH);
+                WindowStatistics *bucket = getBucket(pairBuckets, index);
+                if (bucket && overlap > 0) {
+                    bucket->bytes += rate * overlap;
+                }
+            }
+        }
+    }
+
+    // Everything else goes into the bucket where the transfer ended
+    WindowStatistics *bucket = getBucket(pairBuckets, transfer.end / BUCKET_WIDTH);
+    if (bucket) {
+        bucket->addOutcome(transfer);
+    }
+}
+
+
+void OptimizerStatistics::record(const fts3::events::Message &msg)
+{
+    if (msg.transfer_status() != "FINISHED" && msg.transfer_status() != "FAILED") {
+        return;
+    }
+    record(msg, msg.transfer_status(), 0);
+}
+
+
+void OptimizerStatistics::recordRetry(const fts3::events::Message &msg, int retry)
+{
+    record(msg, "SUBMITTED", retry);
+}
+
+
+void OptimizerStatistics::record(const fts3::events::Message &msg, const std::string &state, int retry)
+{
+    if (!isReady()) {
+        return;
+    }
+
+    TerminalTransfer transfer;
+    transfer.state = state;
+    transfer.end = msg.timestamp() / 1000;
+    transfer.duration = msg.time_in_secs();
+    transfer.start = transfer.end - time_t(transfer.duration);
+    transfer.filesize = msg.filesize();
+    transfer.recoverable = msg.retry();
+    transfer.retry = retry;
+
+    record(Pair(msg.source_se(), msg.dest_se()), transfer);
+}
+
+
+void OptimizerStatistics::get(const Pair &pair, const boost::posix_time::time_duration &timeFrame, time_t now,
+    WindowStatistics *stats)
+{
+    time_t windowStart = now - timeFrame.total_seconds();
+
+    boost::mutex::scoped_lock lock(mutex);
+
+    auto pairBuckets = pairs.find(pair);
+    if (pairBuckets == pairs.end()) {
+        return;
+    }
+
+    long index = pairBuckets->second.first;
+    for (auto i = pairBuckets->second.buckets.begin(); i != pairBuckets->second.buckets.end(); ++i, ++index) {
+        time_t bucketStart = index * BUCKET_WIDTH;
+        time_t bucketEnd = bucketStart + BUCKET_WIDTH;
+        if (bucketEnd <= windowStart) {
+            continue;
+        }
+        if (bucketStart < windowStart) {
+            WindowStatistics partial(*i);
+            partial.bytes = i->bytes * (bucketEnd - windowStart) / BUCKET_WIDTH;
+            stats->merge(partial);
+        }
+        else {
+            stats->merge(*i);
+        }
+    }
+}
+
+
+void OptimizerStatistics::expire(time_t now)
+{
+    long oldest = (now - maxWindow) / BUCKET_WIDTH;
+
+    boost::mutex::scoped_lock lock(mutex);
+
+    for (auto i = pairs.begin(); i != pairs.end();) {
+        PairBuckets &pairBuckets = i->second;
+        while (!pairBuckets.buckets.empty() && pairBuckets.first < oldest) {
+            pairBuckets.buckets.pop_front();
+            ++pairBuckets.first;
+        }
+        if (pairBuckets.buckets.empty()) {
+            i = pairs.erase(i);
+        }
+        else {
+            ++i;
+        }
+    }
+}
+
+
+void OptimizerStatistics::rebuild(OptimizerDataSource *dataSource)
+{
+    ready = false;
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        pairs.clear();
+    }
+
+    // Completions processed while this runs are lost, but only for the first time frame
+    int count = 0;
+    dataSource->getTerminalTransfers(boost::posix_time::seconds(maxWindow),
+        [this, &count](const Pair &pair, const TerminalTransfer &transfer) {
+            record(pair, transfer);
+            ++count;
+        }
+    );
+
+    ready = true;
+
+    FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Optimizer statistics rebuilt from " << count << " terminal transfers"
+        << commit;
+}
+
+
+bool OptimizerStatistics::isReady() const
+{
+    return ready;
+}
+
+
+StreamingOptimizerDataSource::StreamingOptimizerDataSource(OptimizerDataSource *inner,
+    OptimizerStatistics *statistics): inner(inner), statistics(statistics)
+{
+}
+
+
+std::list<Pair> StreamingOptimizerDataSource::getActivePairs(void)
+{
+    return inner->getActivePairs();
+}
+
+
+void StreamingOptimizerDataSource::prefetch(const std::list<Pair> &pairs,
+    const std::vector<boost::posix_time::time_duration> &timeFrames, bool withTerminal)
+{
+    statistics->expire(time(NULL));
+    inner->prefetch(pairs, timeFrames, withTerminal && !statistics->isReady());
+}
+
+
+void StreamingOptimizerDataSource::clearPrefetched(void)
+{
+    inner->clearPrefetched();
+}
+
+
+OptimizerMode StreamingOptimizerDataSource::getOptimizerMode(const std::string &source, const std::string &dest)
+{
+    return inner->getOptimizerMode(source, dest);
+}
+
+
+void StreamingOptimizerDataSource::getPairLimits(const Pair &pair, Range *range, StorageLimits *limits)
+{
+    inner->getPairLimits(pair, range, limits);
+}
+
+
+int StreamingOptimizerDataSource::getOptimizerValue(const Pair &pair)
+{
+    return inner->getOptimizerValue(pair);
+}
+
+
+void StreamingOptimizerDataSource::getThroughputInfo(const Pair &pair,
+    const boost::posix_time::time_duration &timeFrame,
+    double *throughput, double *filesizeAvg, double *filesizeStdDev)
+{
+    if (!statistics->isReady()) {
+        inner->getThroughputInfo(pair, timeFrame, throughput, filesizeAvg, filesizeStdDev);
+        return;
+    }
+
+    WindowStatistics stats;
+    statistics->get(pair, timeFrame, time(NULL), &stats);
+    inner->getActiveStatistics(pair, timeFrame, &stats);
+
+    *throughput = stats.bytes / timeFrame.total_seconds();
+    *filesizeAvg = stats.filesizeMean;
+    *filesizeStdDev = stats.getFilesizeStdDev();
+}
+
+
+time_t StreamingOptimizerDataSource::getAverageDuration(const Pair &pair,
+    const boost::posix_time::time_duration &timeFrame)
+{
+    if (!statistics->isReady()) {
+        return inner->getAverageDuration(pair, timeFrame);
+    }
+
+    WindowStatistics stats;
+    statistics->get(pair, timeFrame, time(NULL), &stats);
+    return stats.getAverageDuration();
+}
+
+
+double StreamingOptimizerDataSource::getSuccessRateForPair(const Pair &pair,
+    const boost::posix_time::time_duration &timeFrame, int *retryCount)
+{
+    if (!statistics->isReady()) {
+        return inner->getSuccessRateForPair(pair, timeFrame, retryCount);
+    }
+
+    WindowStatistics stats;
+    statistics->get(pair, timeFrame, time(NULL), &stats);
+    *retryCount = stats.retryCount;
+    return stats.getSuccessRate();
+}
+
+
+void StreamingOptimizerDataSource::getActiveStatistics(const Pair &pair,
+    const boost::posix_time::time_duration &timeFrame, WindowStatistics *stats)
+{
+    inner->getActiveStatistics(pair, timeFrame, stats);
+}
+
+
+void StreamingOptimizerDataSource::getTerminalTransfers(const boost::posix_time::time_duration &timeFrame,
+    const std::function<void(const Pair&, const TerminalTransfer&)> &callback)
+{
+    inner->getTerminalTransfers(timeFrame, callback);
+}
+
+
+int StreamingOptimizerDataSource::getActive(const Pair &pair)
+{
+    return inner->getActive(pair);
+}
+
+
+int StreamingOptimizerDataSource::getSubmitted(const Pair &pair)
+{
+    return inner->getSubmitted(pair);
+}
+
+
+double StreamingOptimizerDataSource::getThroughputAsSource(const std::string &storage)
+{
+    return inner->getThroughputAsSource(storage);
+}
+
+
+double StreamingOptimizerDataSource::getThroughputAsDestination(const std::string &storage)
+{
+    return inner->getThroughputAsDestination(storage);
+}
+
+
+void StreamingOptimizerDataSource::storeOptimizerDecision(const Pair &pair, int activeDecision,
+    const PairState &newState, int diff, const std::string &rationale)
+{
+    inner->storeOptimizerDecision(pair, activeDecision, newState, diff, rationale);
+}
+
+
+void StreamingOptimizerDataSource::storeOptimizerStreams(const Pair &pair, int streams)
+{
+    inner->storeOptimizerStreams(pair, streams);
+}
+
+
+void StreamingOptimizerDataSource::flushDecisions(void)
+{
+    inner->flushDecisions();
+}
+
+}
+}
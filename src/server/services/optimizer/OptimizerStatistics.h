@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef FTS3_OPTIMIZERSTATISTICS_H
+#define FTS3_OPTIMIZERSTATISTICS_H
+
+#include <atomic>
+#include <deque>
+#include <map>
+
+#include <boost/thread/mutex.hpp>
+
+#include "common/Singleton.h"
+#include "Optimizer.h"
+#include "OptimizerConstants.h"
+
+
+namespace fts3 {
+namespace optimizer {
+
+
+// Sliding window statistics of the terminal transfers, fed by the completion messages,
+// so the optimizer does not need to scan t_file on each run.
+// Each pair keeps a ring of fixed width time buckets covering the longest time frame.
+class OptimizerStatistics: public fts3::common::Singleton<OptimizerStatistics> {
+public:
+    // Width, in seconds, of each time bucket
+    static const time_t BUCKET_WIDTH = 10;
+
+    OptimizerStatistics(time_t maxWindow = LONG_TIME_FRAME);
+
+    // Account a transfer that reached a terminal state
+    void record(const Pair &pair, const TerminalTransfer &transfer);
+
+    // Account a completion message coming from fts_url_copy
+    // Ignored until the statistics are rebuilt from the database
+    void record(const fts3::events::Message &msg);
+
+    // Account a FAILED completion message whose file is going to be retried.
+    // It is counted as the database sees the file: SUBMITTED, with its new retry count.
+    void recordRetry(const fts3::events::Message &msg, int retry);
+
+    // Add to stats the metrics of the transfers that reached a terminal state within
+    // the time frame ending at now.
+    // Buckets partially within the time frame are fully counted, but their bytes, which are prorated.
+    void get(const Pair &pair, const boost::posix_time::time_duration &timeFrame, time_t now,
+        WindowStatistics *stats);
+
+    // Drop the buckets that are out of the longest time frame
+    void expire(time_t now);
+
+    // Load the terminal transfers within the longest time frame from the data source
+    void rebuild(OptimizerDataSource *dataSource);
+
+    // True once rebuilt
+    bool isReady() const;
+
+private:
+    struct PairBuckets {
+        // Index of the first bucket (timestamp / BUCKET_WIDTH)
+        long first;
+        std::deque<WindowStatistics> buckets;
+
+        PairBuckets(): first(0) {}
+    };
+
+    time_t maxWindow;
+    long maxBuckets;
+    std::atomic<bool> ready;
+
+    boost::mutex mutex;
+    std::map<Pair, PairBuckets> pairs;
+
+    // Account a completion message as a transfer in the given state
+    void record(const fts3::events::Message &msg, const std::string &state, int retry);
+
+    // Returns NULL if the bucket is too old to be kept
+    WindowStatistics *getBucket(PairBuckets &pairBuckets, long index);
+};
+
+
+// Data source that answers the statistics of the terminal transfers from OptimizerStatistics,
+// and everything else from the wrapped data source
+class StreamingOptimizerDataSource: public OptimizerDataSource {
+public:
+    StreamingOptimizerDataSource(OptimizerDataSource *inner, OptimizerStatistics *statistics);
+
+    std::list<Pair> getActivePairs(void);
+
+    void prefetch(const std::list<Pair> &pairs, const std::vector<boost::posix_time::time_duration> &timeFrames,
+        bool withTerminal);
+    void clearPrefetched(void);
+
+    OptimizerMode getOptimizerMode(const std::string &source, const std::string &dest);
+    void getPairLimits(const Pair &pair, Range *range, StorageLimits *limits);
+    int getOptimizerValue(const Pair &pair);
+
+    void getThroughputInfo(const Pair &pair, const boost::posix_time::time_duration &timeFrame,
+        double *throughput, double *filesizeAvg, double *filesizeStdDev);
+    time_t getAverageDuration(const Pair &pair, const boost::posix_time::time_duration &timeFrame);
+    double getSuccessRateForPair(const Pair &pair, const boost::posix_time::time_duration &timeFrame,
+        int *retryCount);
+
+    void getActiveStatistics(const Pair &pair, const boost::posix_time::time_duration &timeFrame,
+        WindowStatistics *stats);
+    void getTerminalTransfers(const boost::posix_time::time_duration &timeFrame,
+        const std::function<void(const Pair&, const TerminalTransfer&)> &callback);
+
+    int getActive(const Pair &pair);
+    int getSubmitted(const Pair &pair);
+
+    double getThroughputAsSource(const std::string &storage);
+    double getThroughputAsDestination(const std::string &storage);
+
+    void storeOptimizerDecision(const Pair &pair, int activeDecision,
+        const PairState &newState, int diff, const std::string &rationale);
+    void storeOptimizerStreams(const Pair &pair, int streams);
+    void flushDecisions(void);
+
+private:
+    OptimizerDataSource *inner;
+    OptimizerStatistics *statistics;
+};
+
+}
+}
+
+#endif // FTS3_OPTIMIZERSTATISTICS_H
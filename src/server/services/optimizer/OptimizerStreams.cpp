@@ -41,7 +41,8 @@ void Optimizer::optimizeStreamsForPair(OptimizerMode optMode, const Pair &pair)
         return;
     }
 
-    auto state = inMemoryStore[pair];
+    PairState state;
+    inMemoryStore.get(pair, &state);
 
     int connectionsAvailable = state.connections;
     int availableTransfers = state.activeCount + state.queueSize;
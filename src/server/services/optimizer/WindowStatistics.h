@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef FTS3_WINDOWSTATISTICS_H
+#define FTS3_WINDOWSTATISTICS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <ctime>
+#include <string>
+
+
+namespace fts3 {
+namespace optimizer {
+
+
+// Bytes transferred inside the window [windowStart, now] by a transfer
+// If end is 0, the transfer is considered still running, and transferred is what it moved so far
+inline double getBytesInWindow(time_t now, time_t windowStart, time_t start, time_t end,
+    int64_t transferred, int64_t filesize)
+{
+    time_t periodInWindow = 0;
+    double bytesInWindow = 0;
+
+    // Not finish information
+    if (end <= 0) {
+        periodInWindow = now - std::max(start, windowStart);
+        long duration = now - start;
+        if (duration > 0) {
+            bytesInWindow = double(transferred / duration) * periodInWindow;
+        }
+    }
+    // Finished
+    else {
+        periodInWindow = end - std::max(start, windowStart);
+        long duration = end - start;
+        if (duration > 0 && filesize > 0) {
+            bytesInWindow = double(filesize / duration) * periodInWindow;
+        }
+        else if (duration <= 0) {
+            bytesInWindow = filesize;
+        }
+    }
+
+    return bytesInWindow;
+}
+
+
+// A transfer that reached a terminal state, as the optimizer sees it
+struct TerminalTransfer {
+    // FINISHED, ARCHIVING, FAILED, or SUBMITTED if it is waiting for a retry
+    std::string state;
+    time_t start, end;
+    int64_t filesize;
+    double duration;
+    bool recoverable;
+    int retry;
+
+    TerminalTransfer(): start(0), end(0), filesize(0), duration(0), recoverable(false), retry(0) {}
+
+    bool isFinished() const {
+        return state == "FINISHED" || state == "ARCHIVING";
+    }
+};
+
+
+// Metrics of the transfers of a pair within a time window
+struct WindowStatistics {
+    // Bytes transferred within the window
+    double bytes;
+    // File sizes (Welford)
+    uint64_t nFiles;
+    double filesizeMean, filesizeM2;
+    // Durations of the finished transfers
+    double durationSum;
+    uint64_t nDurations;
+    // Terminal states. Non-recoverable failures are not counted.
+    int nFinished, nFailed, retryCount;
+
+    WindowStatistics(): bytes(0), nFiles(0), filesizeMean(0), filesizeM2(0),
+        durationSum(0), nDurations(0), nFinished(0), nFailed(0), retryCount(0)
+    {}
+
+    void addFilesize(double filesize) {
+        ++nFiles;
+        double delta = filesize - filesizeMean;
+        filesizeMean += delta / nFiles;
+        filesizeM2 += delta * (filesize - filesizeMean);
+    }
+
+    // Count the outcome of a terminal transfer. Everything but the bytes.
+    void addOutcome(const TerminalTransfer &transfer) {
+        if (transfer.isFinished()) {
+            if (transfer.filesize > 0) {
+                addFilesize(transfer.filesize);
+            }
+            if (transfer.duration > 0) {
+                durationSum += transfer.duration;
+                ++nDurations;
+            }
+            ++nFinished;
+        }
+        else if (transfer.state == "FAILED" && transfer.recoverable) {
+            ++nFailed;
+        }
+        else if (transfer.state == "SUBMITTED" && transfer.retry) {
+            ++nFailed;
+            retryCount += transfer.retry;
+        }
+    }
+
+    // Account a terminal transfer in the window [windowStart, now] the same way the
+    // optimizer queries do on the database
+    void addTerminal(const TerminalTransfer &transfer, time_t windowStart, time_t now) {
+        if (transfer.isFinished() && transfer.end >= windowStart) {
+            bytes += getBytesInWindow(now, windowStart, transfer.start, transfer.end, 0, transfer.filesize);
+        }
+        if (transfer.end > windowStart) {
+            addOutcome(transfer);
+        }
+        else if (transfer.end == windowStart && transfer.isFinished() && transfer.filesize > 0) {
+            addFilesize(transfer.filesize);
+        }
+    }
+
+    // Combine with the metrics of another set of transfers
+    void merge(const WindowStatistics &other) {
+        bytes += other.bytes;
+
+        if (other.nFiles > 0) {
+            uint64_t n = nFiles + other.nFiles;
+            double delta = other.filesizeMean - filesizeMean;
+            filesizeMean += delta * other.nFiles / n;
+            filesizeM2 += other.filesizeM2 + delta * delta * nFiles * other.nFiles / n;
+            nFiles = n;
+        }
+
+        durationSum += other.durationSum;
+        nDurations += other.nDurations;
+        nFinished += other.nFinished;
+        nFailed += other.nFailed;
+        retryCount += other.retryCount;
+    }
+
+    double getFilesizeStdDev() const {
+        if (nFiles == 0) {
+            return 0;
+        }
+        return sqrt(filesizeM2 / nFiles);
+    }
+
+    time_t getAverageDuration() const {
+        if (nDurations == 0) {
+            return 0;
+        }
+        return durationSum / nDurations;
+    }
+
+    // Round up efficiency
+    // If there are no terminal, use 100% success rate rather than 0 to avoid
+    // the optimizer stepping back
+    double getSuccessRate() const {
+        int nTotal = nFinished + nFailed;
+        if (nTotal > 0) {
+            return ceil((nFinished * 100.0) / nTotal);
+        }
+        return 100.0;
+    }
+};
+
+}
+}
+
+#endif // FTS3_WINDOWSTATISTICS_H
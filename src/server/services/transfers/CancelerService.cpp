@@ -29,6 +29,8 @@
 #include "server/DrainMode.h"
 #include "SingleTrStateInstance.h"
 #include "ThreadSafeList.h"
+#include "UrlCopyRegistry.h"
+#include "UrlCopyWorkerPool.h"
 
 
 using namespace fts3::common;
@@ -79,7 +81,7 @@ void CancelerService::markAsStalled()
 
         for (auto i = messages.begin(); i != messages.end(); ++i) {
             // Make sure we don't kill ourselves
-            if (i->process_id()) {
+            if (i->process_id() && !UrlCopyWorkerPool::instance().killTransfer(i->process_id(), i->file_id())) {
                 kill(i->process_id(), SIGKILL);
             }
             boost::tuple<bool, std::string> updated = db->updateTransferStatus(i->job_id(), i->file_id(), 0,
@@ -102,7 +104,7 @@ void CancelerService::markAsStalled()
 
 void CancelerService::killCanceledByUser()
 {
-    std::vector<int> requestIDs;
+    std::vector<std::pair<int, uint64_t>> requestIDs;
     DBSingleton::instance().getDBObjectInstance()->getCancelJob(requestIDs);
     if (!requestIDs.empty())
     {
@@ -143,7 +145,9 @@ void CancelerService::applyActiveTimeouts()
             FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Killing pid:" << i->pid
                 << ", jobid:" << i->jobId << ", fileid:" << i->fileId
                 << " because it was stalled" << commit;
-            kill(i->pid, SIGKILL);
+            if (!UrlCopyWorkerPool::instance().killTransfer(i->pid, i->fileId)) {
+                kill(i->pid, SIGKILL);
+            }
         }
         else {
             FTS3_COMMON_LOGGER_NEWLOG(WARNING)
@@ -199,6 +203,9 @@ void CancelerService::runService()
         stallRecords = time(0);
         try
         {
+            // Keep track of the url copy processes that exited
+            UrlCopyRegistry::instance().maintain();
+
             //if we drain a host, no need to check if url_copy are reporting being alive
             if (DrainMode::instance())
             {
@@ -270,22 +277,30 @@ void CancelerService::runService()
 }
 
 
-void CancelerService::killRunningJob(const std::vector<int>& pids)
+void CancelerService::killRunningJob(const std::vector<std::pair<int, uint64_t>>& transfers)
 {
     int sigKillDelay = ServerConfig::instance().get<int>("SigKillDelay");
+    UrlCopyWorkerPool &pool = UrlCopyWorkerPool::instance();
 
-    for (auto iter = pids.begin(); iter != pids.end(); ++iter)
+    for (auto iter = transfers.begin(); iter != transfers.end(); ++iter)
     {
-        int pid = *iter;
+        int pid = iter->first;
         FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Canceling and killing running processes: " << pid << commit;
-        kill(pid, SIGTERM);
+        // Url copy workers outlive the transfer, so they are asked to cancel it instead
+        if (!pool.cancelTransfer(pid, iter->second)) {
+            kill(pid, SIGTERM);
+        }
     }
 
     FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Giving " << sigKillDelay << " ms for graceful termination" << commit;
     boost::this_thread::sleep(boost::posix_time::milliseconds(sigKillDelay));
 
-    for (auto iter = pids.begin(); iter != pids.end(); ++iter) {
-        int pid = *iter;
+    for (auto iter = transfers.begin(); iter != transfers.end(); ++iter) {
+        int pid = iter->first;
+        // A worker is only stopped if it is still running the canceled transfer
+        if (pool.killTransfer(pid, iter->second)) {
+            continue;
+        }
         if (kill(pid, 0) == 0) {
             FTS3_COMMON_LOGGER_NEWLOG(INFO) << "SIGKILL pid: " << pid << commit;
             kill(pid, SIGKILL);
@@ -22,6 +22,8 @@
 #ifndef CANCELERSERVICE_H_
 #define CANCELERSERVICE_H_
 
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "../BaseService.h"
@@ -43,7 +45,7 @@ public:
     virtual void runService();
 
 private:
-    void killRunningJob(const std::vector<int>& pids);
+    void killRunningJob(const std::vector<std::pair<int, uint64_t>>& transfers);
     void markAsStalled();
     void killCanceledByUser();
     void applyQueueTimeouts();
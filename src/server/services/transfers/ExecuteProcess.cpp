@@ -28,6 +28,7 @@
 #include <cstddef>
 #include <cstdlib>
 #include <cstdio>
+#include <limits>
 #include <vector>
 #include <string>
 #include <fstream>
@@ -45,25 +46,30 @@
 #include <fstream>
 #include <dirent.h>
 #include <sys/socket.h>
+#include <sys/syscall.h>
+#include <spawn.h>
 
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
 
-#include "db/generic/SingleDbInstance.h"
 #include "common/Logger.h"
 #include "ExecuteProcess.h"
 #include "common/Exceptions.h"
 
 
 using namespace fts3::common;
-using namespace db;
 
 
 ExecuteProcess::ExecuteProcess(const std::string &app, const std::string &arguments)
-    : pid(0), m_app(app), m_arguments(arguments)
+    : pid(0), inheritedFd(-1), m_app(app), m_arguments(arguments)
 {
 }
 
+void ExecuteProcess::setInheritedFd(int fd)
+{
+    inheritedFd = fd;
+}
+
 int ExecuteProcess::executeProcessShell(std::string &forkMessage)
 {
     return execProcessShell(forkMessage);
@@ -90,17 +96,160 @@ void ExecuteProcess::getArgv(std::list<std::string> &argsHolder, size_t *argc, c
     (*argv)[i] = NULL;
 }
 
-static void closeAllFilesExcept(int exception)
+// Close [first, last], returns false if close_range is not supported by the kernel
+static bool closeRange(int first, int last)
+{
+#ifdef SYS_close_range
+    if (first > last) {
+        return true;
+    }
+    return syscall(SYS_close_range, first, last, 0) == 0;
+#else
+    return false;
+#endif
+}
+
+// Must be async-signal-safe, since it runs in the child of a multithreaded process
+static void closeAllFilesExcept(int exception, int otherException)
 {
+    if (exception > otherException) {
+        std::swap(exception, otherException);
+    }
+
+    // One syscall for all of them (Linux >= 5.9)
+    const int maxFd = std::numeric_limits<int>::max();
+    if (exception < 3 && otherException < 3) {
+        if (closeRange(3, maxFd)) {
+            return;
+        }
+    }
+    else if (exception < 3) {
+        if (closeRange(3, otherException - 1) && closeRange(otherException + 1, maxFd)) {
+            return;
+        }
+    }
+    else if (closeRange(3, exception - 1) && closeRange(exception + 1, otherException - 1) &&
+             closeRange(otherException + 1, maxFd)) {
+        return;
+    }
+
+    // Only look at the descriptors that are actually open.
+    // Start over after closing, since the listing changes under our feet.
+    int dirFd = open("/proc/self/fd", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dirFd >= 0) {
+        char buffer[4096];
+        bool closed = true;
+        while (closed) {
+            closed = false;
+            lseek(dirFd, 0, SEEK_SET);
+
+            long size;
+            while ((size = syscall(SYS_getdents64, dirFd, buffer, sizeof(buffer))) > 0) {
+                for (long offset = 0; offset < size;) {
+                    struct dirent64 *entry = reinterpret_cast<struct dirent64*>(buffer + offset);
+                    offset += entry->d_reclen;
+
+                    int fd = 0;
+                    const char *c = entry->d_name;
+                    if (*c < '0' || *c > '9') {
+                        continue;
+                    }
+                    for (; *c >= '0' && *c <= '9'; ++c) {
+                        fd = fd * 10 + (*c - '0');
+                    }
+
+                    if (fd >= 3 && fd != dirFd && fd != exception && fd != otherException) {
+                        close(fd);
+                        closed = true;
+                    }
+                }
+            }
+        }
+        close(dirFd);
+        return;
+    }
+
+    // No /proc, try them all
     long maxfd = sysconf(_SC_OPEN_MAX);
 
     for (int fdAll = 3; fdAll < maxfd; fdAll++) {
-        if (fdAll != exception)
+        if (fdAll != exception && fdAll != otherException)
             close(fdAll);
     }
 }
 
 int ExecuteProcess::execProcessShell(std::string &forkMessage)
+{
+    signal(SIGCLD, SIG_IGN);
+    signal(SIGPIPE, SIG_IGN);
+
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 34)
+    return spawnProcessShell(forkMessage);
+#else
+    return forkProcessShell(forkMessage);
+#endif
+}
+
+int ExecuteProcess::spawnProcessShell(std::string &forkMessage)
+{
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 34)
+    posix_spawnattr_t attr;
+    posix_spawn_file_actions_t actions;
+
+    posix_spawnattr_init(&attr);
+    posix_spawn_file_actions_init(&actions);
+
+    // Detach from parent
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSID);
+
+    // Close all open file descriptors, except stdin, stdout, stderr and the inherited one.
+    // glibc uses close_range, or walks /proc/self/fd if not available.
+    int firstToClose = 3;
+    if (inheritedFd >= 0) {
+        posix_spawn_file_actions_adddup2(&actions, inheritedFd, INHERITED_FD);
+        firstToClose = INHERITED_FD + 1;
+    }
+    posix_spawn_file_actions_addclosefrom_np(&actions, firstToClose);
+
+    // Set working directory. posix_spawn fails if chdir does, while a failed chdir
+    // after fork is only reported, so check beforehand and keep the working directory if it would fail
+    if (access(_PATH_TMP, X_OK) == 0) {
+        posix_spawn_file_actions_addchdir_np(&actions, _PATH_TMP);
+    }
+    else {
+        FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Failed to chdir into " << _PATH_TMP << ": "
+            << strerror(errno) << commit;
+    }
+
+    std::list<std::string> argsHolder;
+    size_t argc;
+    char **argv;
+    getArgv(argsHolder, &argc, &argv);
+
+    // Errors on exec are reported back by posix_spawn
+    pid_t childPid = 0;
+    int err = posix_spawnp(&childPid, m_app.c_str(), &actions, &attr, argv, environ);
+
+    delete [] argv;
+    posix_spawn_file_actions_destroy(&actions);
+    posix_spawnattr_destroy(&attr);
+
+    if (err != 0) {
+        pid = 0;
+        forkMessage = "Child process failed to execute: " + std::string(strerror(err));
+        FTS3_COMMON_LOGGER_NEWLOG(ERR) << forkMessage << commit;
+        return -1;
+    }
+
+    pid = childPid;
+    return 0;
+#else
+    forkMessage = "posix_spawn with setsid, closefrom and chdir is not supported";
+    return -1;
+#endif
+}
+
+int ExecuteProcess::forkProcessShell(std::string &forkMessage)
 {
     // Open pipe
     int pipefds[2] = {0, 0};
@@ -118,14 +267,18 @@ int ExecuteProcess::execProcessShell(std::string &forkMessage)
         return -1;
     }
 
-    signal(SIGCLD, SIG_IGN);
-    signal(SIGPIPE, SIG_IGN);
+    // Prepare the parameter array before forking, so the child does not allocate
+    std::list<std::string> argsHolder;
+    size_t argc;
+    char **argv;
+    getArgv(argsHolder, &argc, &argv);
 
     pid = fork();
     // Error
     if (pid == -1) {
         close(pipefds[0]);
         close(pipefds[1]);
+        delete [] argv;
 
         forkMessage = "Failed to fork " + std::string(strerror(errno));
         FTS3_COMMON_LOGGER_NEWLOG(ERR) << forkMessage << commit;
@@ -137,28 +290,45 @@ int ExecuteProcess::execProcessShell(std::string &forkMessage)
         setsid();
 
         // Set working directory
-        if (chdir(_PATH_TMP) != 0)
-            FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Failed to chdir" << commit;
+        if (chdir(_PATH_TMP) != 0) {
+            const char msg[] = "Failed to chdir\n";
+            if (write(STDERR_FILENO, msg, sizeof(msg) - 1) < 0) {
+                // pass
+            }
+        }
+
+        // Move the inherited descriptor into place, out of the way of the pipe
+        int keepFd = -1;
+        if (inheritedFd >= 0) {
+            if (pipefds[1] == INHERITED_FD) {
+                pipefds[1] = fcntl(pipefds[1], F_DUPFD_CLOEXEC, INHERITED_FD + 1);
+            }
+            if (inheritedFd == INHERITED_FD) {
+                fcntl(INHERITED_FD, F_SETFD, fcntl(INHERITED_FD, F_GETFD) & ~FD_CLOEXEC);
+            }
+            else {
+                dup2(inheritedFd, INHERITED_FD);
+            }
+            keepFd = INHERITED_FD;
+        }
 
         // Close all open file descriptors _except_ the write-end of the pipe
-        // (and stdin, stdout and stderr)
-        closeAllFilesExcept(pipefds[1]);
+        // (and stdin, stdout and stderr, and the inherited one if any)
+        closeAllFilesExcept(pipefds[1], keepFd);
 
         // Redirect stderr (points to the log)
         //stderr = freopen("/dev/null", "a", stderr);
 
-        // Get parameter array
-        std::list<std::string> argsHolder;
-        size_t argc;
-        char **argv;
-        getArgv(argsHolder, &argc, &argv);
-
         // Execute the new binary
         execvp(m_app.c_str(), argv);
 
         // If we are here, execvp failed, so write the errno to the pipe
-        if (write(pipefds[1], &errno, sizeof(int)) < 0) {
-            fprintf(stderr, "Failed to write to the pipe!");
+        int err = errno;
+        if (write(pipefds[1], &err, sizeof(int)) < 0) {
+            const char msg[] = "Failed to write to the pipe!\n";
+            if (write(STDERR_FILENO, msg, sizeof(msg) - 1) < 0) {
+                // pass
+            }
         }
         _exit(EXIT_FAILURE);
     }
@@ -166,6 +336,7 @@ int ExecuteProcess::execProcessShell(std::string &forkMessage)
     // Parent process
     // Close writing end of the pipe, and wait and see if we got an error from
     // the child
+    delete [] argv;
     close(pipefds[1]);
 
     ssize_t count = 0;
@@ -173,14 +344,15 @@ int ExecuteProcess::execProcessShell(std::string &forkMessage)
     while ((count = read(pipefds[0], &err, sizeof(err))) == -1) {
         if (errno != EAGAIN && errno != EINTR) break;
     }
+
+    // Close reading end
+    close(pipefds[0]);
+
     if (count) {
-        forkMessage = "Child process failed to execute: " + std::string(strerror(errno));
+        forkMessage = "Child process failed to execute: " + std::string(strerror(err));
         FTS3_COMMON_LOGGER_NEWLOG(ERR) << forkMessage << commit;
         return -1;
     }
 
-    // Close reading end
-    close(pipefds[0]);
-
     return 0;
 }
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <list>
 #include <string>
 #include <map>
 
@@ -27,9 +28,15 @@
 class ExecuteProcess
 {
 public:
+    /// The fd set with setInheritedFd is found under this number in the child
+    static const int INHERITED_FD = 3;
+
     ExecuteProcess(const std::string& app, const std::string& arguments);
     int executeProcessShell(std::string& forkMessage);
 
+    /// Pass fd to the child as INHERITED_FD, even if it is flagged FD_CLOEXEC
+    void setInheritedFd(int fd);
+
     inline int getPid()
     {
         return pid;
@@ -39,8 +46,16 @@ protected:
     int execProcessShell(std::string& forkMessage);
     void getArgv(std::list<std::string>& argsHolder, size_t* argc, char*** argv);
 
+    /// Launch with posix_spawn, which uses vfork semantics, so the cost does not depend
+    /// on the size of the server. Only available with glibc >= 2.34
+    int spawnProcessShell(std::string& forkMessage);
+
+    /// Launch with fork and exec
+    int forkProcessShell(std::string& forkMessage);
+
 private:
     int pid;
+    int inheritedFd;
     std::string m_app;
     std::string m_arguments;
 };
@@ -28,6 +28,8 @@
 #include "CloudStorageConfig.h"
 #include "ThreadSafeList.h"
 #include "UrlCopyCmd.h"
+#include "UrlCopyRegistry.h"
+#include "UrlCopyWorkerPool.h"
 #include <iostream>
 
 #define BOOST_SPIRIT_THREADSAFE
@@ -45,7 +47,8 @@ namespace server
 
 FileTransferExecutor::FileTransferExecutor(TransferFile &tf,
     bool monitoringMsg, std::string infosys,
-    std::string ftsHostName, std::string proxy, std::string logDir, std::string msgDir) :
+    std::string ftsHostName, std::string proxy, std::string logDir, std::string msgDir,
+    LinkConfigCache &configCache) :
     tf(tf),
     monitoringMsg(monitoringMsg),
     infosys(infosys),
@@ -53,7 +56,8 @@ FileTransferExecutor::FileTransferExecutor(TransferFile &tf,
     proxy(proxy),
     logsDir(logDir),
     msgDir(msgDir),
-    db(DBSingleton::instance().getDBObjectInstance())
+    db(DBSingleton::instance().getDBObjectInstance()),
+    configCache(configCache)
 {
 }
 
@@ -108,25 +112,27 @@ void FileTransferExecutor::run(boost::any & ctx)
         {
             UrlCopyCmd cmdBuilder;
 
-            int secPerMB = db->getSecPerMb(tf.voName);
-            if (secPerMB > 0) {
-                cmdBuilder.setSecondsPerMB(secPerMB);
+            const LinkConfigCache::LinkEntry linkConfig = configCache.getLink(tf.sourceSe, tf.destSe);
+            const LinkConfigCache::VoEntry voConfig = configCache.getVo(tf.voName);
+
+            if (voConfig.secPerMb > 0) {
+                cmdBuilder.setSecondsPerMB(voConfig.secPerMb);
             }
 
             TransferFile::ProtocolParameters protocolParams = tf.getProtocolParameters();
 
             if (tf.internalFileParams.empty()) {
-                protocolParams.nostreams = db->getStreamsOptimization(tf.sourceSe, tf.destSe);
-                protocolParams.timeout = db->getGlobalTimeout(tf.voName);
-                protocolParams.ipv6 = db->isProtocolIPv6(tf.sourceSe, tf.destSe);
-                protocolParams.udt = db->isProtocolUDT(tf.sourceSe, tf.destSe);
+                protocolParams.nostreams = configCache.getStreamsOptimization(tf.sourceSe, tf.destSe);
+                protocolParams.timeout = voConfig.globalTimeout;
+                protocolParams.ipv6 = linkConfig.ipv6;
+                protocolParams.udt = linkConfig.udt;
                 //protocolParams.buffersize
             }
 
             cmdBuilder.setFromProtocol(protocolParams);
 
             // Update from the transfer
-            cmdBuilder.setFromTransfer(tf, false, db->publishUserDn(tf.voName), msgDir);
+            cmdBuilder.setFromTransfer(tf, false, voConfig.publishUserDn, msgDir);
 
             // OAuth credentials
             std::string cloudConfigFile;
@@ -147,19 +153,18 @@ void FileTransferExecutor::run(boost::any & ctx)
             cmdBuilder.setRetrieveSEToken(fts3::config::ServerConfig::instance().get<bool>("RetrieveSEToken"));
 
             // Debug level
-            cmdBuilder.setDebugLevel(db->getDebugLevel(tf.sourceSe, tf.destSe));
+            cmdBuilder.setDebugLevel(linkConfig.debugLevel);
 
             // Disable delegation (according to link config)
-            cmdBuilder.setDisableDelegation(db->getDisableDelegationFlag(tf.sourceSe, tf.destSe));
+            cmdBuilder.setDisableDelegation(linkConfig.disableDelegation);
 
             // Get SRM 3rd party TURL (according to link config)
-            auto thirdPartyTURL = db->getThirdPartyTURL(tf.sourceSe, tf.destSe);
-            if (!thirdPartyTURL.empty()) {
-                cmdBuilder.setThirdPartyTURL(thirdPartyTURL);
+            if (!linkConfig.thirdPartyTURL.empty()) {
+                cmdBuilder.setThirdPartyTURL(linkConfig.thirdPartyTURL);
             }
 
             // Disable streaming via local transfers (according to global config)
-            cmdBuilder.setDisableStreaming(db->getDisableStreamingFlag(tf.voName));
+            cmdBuilder.setDisableStreaming(voConfig.disableStreaming);
 
             // Enable monitoring
             cmdBuilder.setMonitoring(monitoringMsg, msgDir);
@@ -178,13 +183,13 @@ void FileTransferExecutor::run(boost::any & ctx)
             }
 
             // UDT and IPv6
-            cmdBuilder.setUDT(db->isProtocolUDT(tf.sourceSe, tf.destSe));
+            cmdBuilder.setUDT(linkConfig.udt);
             if (!cmdBuilder.isIPv6Explicit()) {
-                cmdBuilder.setIPv6(db->isProtocolIPv6(tf.sourceSe, tf.destSe));
+                cmdBuilder.setIPv6(linkConfig.ipv6);
             }
 
             // Enable source file eviction from disk buffer (according to SE config)
-            cmdBuilder.setEvict(db->getEvictionFlag(tf.sourceSe));
+            cmdBuilder.setEvict(configCache.getEvictionFlag(tf.sourceSe));
 
             // FTS3 host name
             cmdBuilder.setFTSName(ftsHostName);
@@ -205,7 +210,7 @@ void FileTransferExecutor::run(boost::any & ctx)
                 cmdBuilder.setOverwrite(true);
             }
 
-            int retry_max = db->getRetry(tf.jobId);
+            int retry_max = configCache.getRetry(tf.jobId);
             cmdBuilder.setMaxNumberOfRetries(retry_max < 0 ? 0 : retry_max);
 
             // Log directory
@@ -247,15 +252,22 @@ void FileTransferExecutor::run(boost::any & ctx)
             protoMsg.set_timeout(cmdBuilder.getTimeout());
             db->updateProtocol(std::vector<events::Message>{protoMsg});
 
-            // Spawn the fts_url_copy
+            // Hand the transfer to an idle url copy worker, or spawn the fts_url_copy
             bool failed = false;
             std::string forkMessage;
-            if (-1 == pr.executeProcessShell(forkMessage)) {
+            int pid = UrlCopyWorkerPool::instance().dispatch(params, tf.fileId);
+            const bool dispatched = (pid > 0);
+            if (dispatched) {
+                FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Transfer " << tf.jobId << " " << tf.fileId
+                    << " handed over to url copy worker " << pid << commit;
+            }
+            else if (-1 == pr.executeProcessShell(forkMessage)) {
                 failed = true;
+                pid = pr.getPid();
                 db->updateTransferStatus(
                     tf.jobId, tf.fileId, 0.0, "FAILED",
                     "Transfer failed to fork, check fts3server.log for more details",
-                    (int) pr.getPid(), 0, 0, false
+                    pid, 0, 0, false
                 );
                 db->updateJobStatus(tf.jobId, "FAILED");
 
@@ -269,9 +281,14 @@ void FileTransferExecutor::run(boost::any & ctx)
                 }
             }
             else {
+                pid = pr.getPid();
+                UrlCopyRegistry::instance().add(pid);
+            }
+
+            if (!failed) {
                 db->updateTransferStatus(
                     tf.jobId, tf.fileId, 0.0, "READY", "",
-                    pr.getPid(), 0.0, 0.0, false
+                    pid, 0.0, 0.0, false
                 );
             }
 
@@ -280,11 +297,15 @@ void FileTransferExecutor::run(boost::any & ctx)
             fts3::events::MessageUpdater msg;
             msg.set_job_id(tf.jobId);
             msg.set_file_id(tf.fileId);
-            msg.set_process_id(pr.getPid());
+            msg.set_process_id(pid);
             msg.set_timestamp(millisecondsSinceEpoch());
 
             // Only set watcher when the file has started
             if(!failed) {
+                // The pid of a worker is shared with the transfers it ran before
+                if (dispatched) {
+                    ThreadSafeList::get_instance().unbindPid(pid);
+                }
                 ThreadSafeList::get_instance().push_back(msg);
             }
         }
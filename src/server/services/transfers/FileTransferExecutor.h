@@ -27,6 +27,7 @@
 #include "db/generic/SingleDbInstance.h"
 
 #include "TransferFileHandler.h"
+#include "LinkConfigCache.h"
 
 #include <set>
 #include <string>
@@ -61,10 +62,11 @@ public:
      * @param monitoringMsg - is true if monitoring messages are in use
      * @param infosys - information system host
      * @param ftsHostName - hostname of the machine hosting FTS3
+     * @param configCache - link, storage and VO configuration shared by all the executors of the cycle
      */
     FileTransferExecutor(TransferFile& tf,
         bool monitoringMsg, std::string infosys, std::string ftsHostName, std::string proxy,
-        std::string logDir, std::string msgDir);
+        std::string logDir, std::string msgDir, LinkConfigCache &configCache);
 
     /**
      * Destructor.
@@ -95,6 +97,9 @@ private:
     // DB interface
     GenericDbIfce* db;
 
+    // Configuration shared by all the executors
+    LinkConfigCache &configCache;
+
     // method to retrieve auth method used
     std::string getAuthMethod(const std::string& jobMetadata);
 };
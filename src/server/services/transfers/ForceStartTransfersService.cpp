@@ -16,7 +16,6 @@
 
 #include "common/Logger.h"
 #include "common/ThreadPool.h"
-#include "common/DaemonTools.h"
 
 #include "config/ServerConfig.h"
 #include "cred/DelegCred.h"
@@ -28,6 +27,8 @@
 
 #include "ForceStartTransfersService.h"
 #include "FileTransferExecutor.h"
+#include "UrlCopyRegistry.h"
+#include "UrlCopyWorkerPool.h"
 
 using namespace fts3::config;
 using namespace fts3::common;
@@ -50,7 +51,8 @@ void ForceStartTransfersService::forceRunJobs() {
 
     // Bail out as soon as possible if there are too many fts_url_copy processes
     int maxUrlCopy = config::ServerConfig::instance().get<int>("MaxUrlCopyProcesses");
-    int urlCopyCount = countProcessesWithName("fts_url_copy");
+    // Idle workers are not running any transfer
+    int urlCopyCount = UrlCopyRegistry::instance().count() - UrlCopyWorkerPool::instance().getIdleCount();
     int availableUrlCopySlots = maxUrlCopy - urlCopyCount;
 
     if (availableUrlCopySlots <= 0) {
@@ -68,6 +70,8 @@ void ForceStartTransfersService::forceRunJobs() {
             return;
         }
 
+        linkConfigCache.newCycle(db::DBSingleton::instance().getDBObjectInstance());
+
         std::map<std::pair<std::string, std::string>, std::string> proxies;
 
         for (auto& tf: tfs) {
@@ -87,7 +91,7 @@ void ForceStartTransfersService::forceRunJobs() {
             }
 
             FileTransferExecutor *exec = new FileTransferExecutor(tf, monitoringMessages, infosys, ftsHostName,
-                                                                  proxies[proxy_key], logDir, msgDir);
+                                                                  proxies[proxy_key], logDir, msgDir, linkConfigCache);
             execPool.start(exec);
 
             if (--availableUrlCopySlots <= 0) {
@@ -18,6 +18,7 @@
 
 #include "services/BaseService.h"
 #include "services/heartbeat/HeartBeat.h"
+#include "LinkConfigCache.h"
 
 namespace fts3 {
 namespace server {
@@ -36,6 +37,7 @@ protected:
     std::string logDir;
     std::string msgDir;
     boost::posix_time::time_duration pollInterval;
+    LinkConfigCache linkConfigCache;
 
     HeartBeat *beat;
     void forceRunJobs();
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LinkConfigCache.h"
+#include "common/Logger.h"
+
+using namespace fts3::common;
+
+
+namespace fts3 {
+namespace server {
+
+
+LinkConfigCache::LinkConfigCache(int versionCheckInterval): db(NULL),
+    versionCheckInterval(boost::posix_time::seconds(versionCheckInterval))
+{
+}
+
+
+void LinkConfigCache::newCycle(GenericDbIfce *db)
+{
+    const boost::posix_time::ptime now = boost::posix_time::microsec_clock::universal_time();
+    const bool checkVersion = lastVersionCheck.is_not_a_date_time() ||
+        now - lastVersionCheck >= versionCheckInterval;
+
+    std::string newVersion;
+    if (checkVersion) {
+        newVersion = db->getConfigurationVersion();
+    }
+
+    boost::unique_lock<boost::shared_mutex> lock(mutex);
+
+    this->db = db;
+    if (checkVersion) {
+        lastVersionCheck = now;
+    }
+    if (checkVersion && newVersion != version) {
+        FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Configuration version changed, dropping link configuration cache"
+            << commit;
+        links.clear();
+        vos.clear();
+        eviction.clear();
+        version = newVersion;
+    }
+    streams.clear();
+    retries.clear();
+}
+
+
+template <typename K, typename V, typename F>
+V LinkConfigCache::lookup(std::map<K, V> &container, const K &key, F fetch)
+{
+    {
+        boost::shared_lock<boost::shared_mutex> lock(mutex);
+        auto i = container.find(key);
+        if (i != container.end()) {
+            return i->second;
+        }
+    }
+
+    // Query without holding the lock, so other workers are not blocked on the database.
+    // Two workers may race to fill the same entry, but they will get the same value.
+    V value = fetch();
+
+    boost::unique_lock<boost::shared_mutex> lock(mutex);
+    container.insert(std::make_pair(key, value));
+    return value;
+}
+
+
+LinkConfigCache::LinkEntry LinkConfigCache::getLink(const std::string &sourceSe, const std::string &destSe)
+{
+    return lookup(links, LinkKey(sourceSe, destSe), [&]() {
+        LinkEntry entry;
+        entry.ipv6 = db->isProtocolIPv6(sourceSe, destSe);
+        entry.udt = db->isProtocolUDT(sourceSe, destSe);
+        entry.debugLevel = db->getDebugLevel(sourceSe, destSe);
+        entry.disableDelegation = db->getDisableDelegationFlag(sourceSe, destSe);
+        entry.thirdPartyTURL = db->getThirdPartyTURL(sourceSe, destSe);
+        return entry;
+    });
+}
+
+
+LinkConfigCache::VoEntry LinkConfigCache::getVo(const std::string &voName)
+{
+    return lookup(vos, voName, [&]() {
+        VoEntry entry;
+        entry.secPerMb = db->getSecPerMb(voName);
+        entry.globalTimeout = db->getGlobalTimeout(voName);
+        entry.disableStreaming = db->getDisableStreamingFlag(voName);
+        entry.publishUserDn = db->publishUserDn(voName);
+        return entry;
+    });
+}
+
+
+boost::tribool LinkConfigCache::getEvictionFlag(const std::string &storage)
+{
+    return lookup(eviction, storage, [&]() {
+        return db->getEvictionFlag(storage);
+    });
+}
+
+
+int LinkConfigCache::getStreamsOptimization(const std::string &sourceSe, const std::string &destSe)
+{
+    return lookup(streams, LinkKey(sourceSe, destSe), [&]() {
+        return db->getStreamsOptimization(sourceSe, destSe);
+    });
+}
+
+
+int LinkConfigCache::getRetry(const std::string &jobId)
+{
+    return lookup(retries, jobId, [&]() {
+        return db->getRetry(jobId);
+    });
+}
+
+} // end namespace server
+} // end namespace fts3
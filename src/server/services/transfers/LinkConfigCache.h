@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef LINKCONFIGCACHE_H_
+#define LINKCONFIGCACHE_H_
+
+#include <map>
+#include <string>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/logic/tribool.hpp>
+#include <boost/thread.hpp>
+
+#include "db/generic/GenericDbIfce.h"
+
+
+namespace fts3 {
+namespace server {
+
+/// Read-mostly cache of the link, storage and VO configuration needed to launch transfers.
+/// It is refreshed once per scheduling cycle and shared by all the FileTransferExecutor workers,
+/// so the same configuration is not queried once per launched transfer.
+/// Entries are filled lazily, and dropped when the configuration version stored in the
+/// database (t_link_config, t_se and t_server_config) changes. Computing that version means
+/// checksumming the tables, so it is checked at most once every versionCheckInterval seconds.
+class LinkConfigCache
+{
+public:
+    /// Configuration that depends only on the link
+    struct LinkEntry {
+        LinkEntry(): debugLevel(0), disableDelegation(false) {}
+
+        boost::tribool ipv6;
+        boost::tribool udt;
+        unsigned debugLevel;
+        bool disableDelegation;
+        std::string thirdPartyTURL;
+    };
+
+    /// Configuration that depends only on the VO
+    struct VoEntry {
+        VoEntry(): secPerMb(0), globalTimeout(0), disableStreaming(false), publishUserDn(false) {}
+
+        int secPerMb;
+        int globalTimeout;
+        bool disableStreaming;
+        bool publishUserDn;
+    };
+
+    /// Default number of seconds between two configuration version checks
+    static const int VERSION_CHECK_INTERVAL = 30;
+
+    explicit LinkConfigCache(int versionCheckInterval = VERSION_CHECK_INTERVAL);
+
+    /// Start a new scheduling cycle
+    /// Everything is dropped if the configuration version changed. The version is
+    /// only queried if versionCheckInterval elapsed since the previous check. Values that
+    /// change independently of the configuration (optimizer streams, job retries) are always dropped.
+    void newCycle(GenericDbIfce *db);
+
+    /// Configuration for the given link
+    LinkEntry getLink(const std::string &sourceSe, const std::string &destSe);
+
+    /// Configuration for the given VO
+    VoEntry getVo(const std::string &voName);
+
+    /// Eviction flag for the given storage
+    boost::tribool getEvictionFlag(const std::string &storage);
+
+    /// Number of streams for the given link. Valid only for the current cycle.
+    int getStreamsOptimization(const std::string &sourceSe, const std::string &destSe);
+
+    /// Number of retries configured for the given job. Valid only for the current cycle.
+    int getRetry(const std::string &jobId);
+
+private:
+    typedef std::pair<std::string, std::string> LinkKey;
+
+    GenericDbIfce *db;
+    std::string version;
+    boost::posix_time::time_duration versionCheckInterval;
+    boost::posix_time::ptime lastVersionCheck;
+
+    boost::shared_mutex mutex;
+    std::map<LinkKey, LinkEntry> links;
+    std::map<std::string, VoEntry> vos;
+    std::map<std::string, boost::tribool> eviction;
+    std::map<LinkKey, int> streams;
+    std::map<std::string, int> retries;
+
+    /// Look for key in the container, and call fetch to populate it on a miss
+    template <typename K, typename V, typename F>
+    V lookup(std::map<K, V> &container, const K &key, F fetch);
+};
+
+} // end namespace server
+} // end namespace fts3
+
+#endif // LINKCONFIGCACHE_H_
@@ -20,6 +20,7 @@
 
 #include "MessageProcessingService.h"
 
+#include <set>
 #include <glib.h>
 #include <boost/filesystem.hpp>
 
@@ -28,7 +29,9 @@
 #include "common/Logger.h"
 #include "db/generic/SingleDbInstance.h"
 #include "SingleTrStateInstance.h"
+#include "StatusMessageBatch.h"
 #include "ThreadSafeList.h"
+#include "../optimizer/OptimizerStatistics.h"
 
 
 using namespace fts3::common;
@@ -40,10 +43,16 @@ namespace server {
 
 extern time_t updateRecords;
 
+/// How long to let messages accumulate once there is work, so they are applied in bulk
+static const boost::posix_time::milliseconds MESSAGE_BATCH_WINDOW(50);
+
 
 MessageProcessingService::MessageProcessingService(): BaseService("MessageProcessingService"),
     consumer(ServerConfig::instance().get<std::string>("MessagingDirectory")),
-    producer(ServerConfig::instance().get<std::string>("MessagingDirectory"))
+    producer(ServerConfig::instance().get<std::string>("MessagingDirectory"), false),
+    wakeup(ServerConfig::instance().get<std::string>("MessagingDirectory") + "/consumer.wakeup"),
+    requeued(0),
+    lastLatencyReport(time(NULL))
 {
     messages.reserve(600);
 }
@@ -60,9 +69,13 @@ void MessageProcessingService::runService()
 
     auto msgCheckInterval = config::ServerConfig::instance().get<boost::posix_time::time_duration>("MessagingConsumeInterval");
 
+    // after a failure, wait the full interval before trying again
+    bool backoff = false;
+
     while (!boost::this_thread::interruption_requested())
     {
         updateRecords = time(0);
+        bool busy = false;
 
         try
         {
@@ -92,8 +105,13 @@ void MessageProcessingService::runService()
 
             if (!messages.empty())
             {
+                requeued = 0;
                 handleOtherMessages(messages);
                 handleUpdateMessages(messages);
+                // If nothing could be applied, the database is likely unavailable.
+                // Do not pick up again right away what was just put back.
+                busy = (requeued < messages.size());
+                backoff = !busy;
                 messages.clear();
             }
 
@@ -106,6 +124,7 @@ void MessageProcessingService::runService()
             }
 
             if (!messagesLog.empty()) {
+                busy = true;
                 db::DBSingleton::instance().getDBObjectInstance()->transferLogFileVector(messagesLog);
                 messagesLog.clear();
             }
@@ -120,6 +139,7 @@ void MessageProcessingService::runService()
 
             if (!messagesUpdater.empty())
             {
+                busy = true;
                 std::vector<fts3::events::MessageUpdater>::iterator iterUpdater;
                 for (iterUpdater = messagesUpdater.begin(); iterUpdater != messagesUpdater.end(); ++iterUpdater)
                 {
@@ -142,13 +162,35 @@ void MessageProcessingService::runService()
         catch (const std::exception& e) {
             FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Message queue thrown exception: " << e.what() << commit;
             dumpMessages();
+            busy = false;
+            backoff = true;
         }
         catch (...) {
             FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Message queue thrown unhandled exception" << commit;
             dumpMessages();
+            busy = false;
+            backoff = true;
         }
 
-        boost::this_thread::sleep(msgCheckInterval);
+        if (statusLatency.getCount() > 0 && time(NULL) - lastLatencyReport >= 60) {
+            FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Status message latency: " << statusLatency.summary() << commit;
+            statusLatency.reset();
+            lastLatencyReport = time(NULL);
+        }
+
+        // While messages keep coming, do not wait for the interval: each pass picks up in bulk whatever
+        // arrived while the previous one was busy with the database.
+        // Otherwise, sleep until a producer signals new messages, or the interval expires.
+        // Either way, give a short window for a burst of messages to accumulate, so they are applied together.
+        // After a failure, sleep the whole interval even if producers keep signaling.
+        if (backoff) {
+            boost::this_thread::sleep(msgCheckInterval);
+            backoff = false;
+        }
+        else if (!busy) {
+            wakeup.wait(msgCheckInterval.total_milliseconds());
+        }
+        boost::this_thread::sleep(MESSAGE_BATCH_WINDOW);
     }
 }
 
@@ -186,23 +228,23 @@ void MessageProcessingService::performUpdateMessageDbChange(const fts3::events::
             return;
         }
 
-        producer.runProducerStatus(msg);
+        requeueMessage(msg);
     }
     catch (...)
     {
         FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Message queue performUpdateMessageDbChange thrown exception" << commit;
-        producer.runProducerStatus(msg);
+        requeueMessage(msg);
     }
 }
 
 
-void MessageProcessingService::performOtherMessageDbChange(const fts3::events::Message& msg)
+bool MessageProcessingService::prepareOtherMessageDbChange(const fts3::events::Message& msg)
 {
     try
     {
         // do not process UPDATE messages
         if (msg.transfer_status().compare("UPDATE") == 0)
-            return;
+            return false;
 
         FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Job id: " << msg.job_id()
                                         << "\nFile id: " << msg.file_id()
@@ -248,7 +290,9 @@ void MessageProcessingService::performOtherMessageDbChange(const fts3::events::M
                     {
                         db::DBSingleton::instance().getDBObjectInstance()->setRetryTransfer(
                             msg.job_id(), msg.file_id(), retryTimes+1, msg.transfer_message(), msg.errcode());
-                        return;
+                        // Still a failure for the optimizer, as it was when it queried t_file
+                        optimizer::OptimizerStatistics::instance().recordRetry(msg, retryTimes + 1);
+                        return false;
                     }
                 }
             }
@@ -269,48 +313,113 @@ void MessageProcessingService::performOtherMessageDbChange(const fts3::events::M
                 msg.job_id(), msg.process_id(), msg.transfer_message());
         }
 
-        // update file and job state
-        boost::tuple<bool, std::string> updated = db::DBSingleton::instance()
-            .getDBObjectInstance()->updateTransferStatus(
-                msg.job_id(), msg.file_id(), msg.throughput(), msg.transfer_status(),
-                msg.transfer_message(), msg.process_id(), msg.filesize(), msg.time_in_secs(), msg.retry(),
-                msg.file_metadata());
-
-        db::DBSingleton::instance().getDBObjectInstance()->updateJobStatus(
-            msg.job_id(), msg.transfer_status());
-
-        if (!updated.get<0>() && msg.transfer_status() != "CANCELED") {
-            FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Entry in the database not updated for "
-                << msg.job_id() << " " << msg.file_id()
-                << ". Probably already in a different terminal state. Tried to set "
-                << msg.transfer_status() << " over " << updated.get<1>() << commit;
-        }
-        else if (!msg.job_id().empty() && msg.file_id() > 0) {
-            SingleTrStateInstance::instance().sendStateMessage(msg.job_id(), msg.file_id());
-        }
+        return true;
     }
     catch (const std::exception& e)
     {
-        FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Message queue performOtherMessageDbChange throw exception " << e.what() << commit;
-
-        // Encountered unexpected DB error. Terminate all files of a given job
-        if (isUnrecoverableErrorMessage(e.what())) {
-            FTS3_COMMON_LOGGER_NEWLOG(CRIT) << "Attempted database change with invalid values: " << e.what() << commit;
-            db::DBSingleton::instance().getDBObjectInstance()->terminateReuseProcess(
-                    msg.job_id(), msg.process_id(), "Database change failed due to invalid values", true);
-            return;
-        }
-
-        producer.runProducerStatus(msg);
+        handleOtherMessageDbError(msg, e.what());
     }
     catch (...)
     {
         FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Message queue performOtherMessageDbChange throw exception" << commit;
-        producer.runProducerStatus(msg);
+        requeueMessage(msg);
+    }
+    return false;
+}
+
+
+void MessageProcessingService::performOtherMessageDbChanges(const std::vector<fts3::events::Message>& statusMessages)
+{
+    if (statusMessages.empty()) {
+        return;
+    }
+
+    auto db = db::DBSingleton::instance().getDBObjectInstance();
+
+    // update file states
+    std::vector<TransferStatusOutcome> outcomes;
+    try
+    {
+        outcomes = db->updateTransferStatusBulk(statusMessages);
+    }
+    catch (const std::exception& e)
+    {
+        FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Message queue performOtherMessageDbChanges throw exception " << e.what() << commit;
+        for (auto iter = statusMessages.begin(); iter != statusMessages.end(); ++iter) {
+            requeueMessage(*iter);
+        }
+        return;
+    }
+
+    // update job states
+    // Several messages of the same job moving into the same state only need to
+    // trigger the job state evaluation once, since all the file states are already there
+    std::set<std::pair<std::string, std::string>> jobsUpdated;
+
+    for (size_t i = 0; i < statusMessages.size(); ++i)
+    {
+        const fts3::events::Message& msg = statusMessages[i];
+        const TransferStatusOutcome& outcome = outcomes[i];
+
+        try
+        {
+            if (outcome.failed) {
+                handleOtherMessageDbError(msg, outcome.error);
+                continue;
+            }
+
+            statusLatency.record(static_cast<int64_t>(millisecondsSinceEpoch()) - static_cast<int64_t>(msg.timestamp()));
+
+            auto jobUpdate = std::make_pair(msg.job_id(), msg.transfer_status());
+            if (jobsUpdated.find(jobUpdate) == jobsUpdated.end()) {
+                db->updateJobStatus(msg.job_id(), msg.transfer_status());
+                jobsUpdated.insert(jobUpdate);
+            }
+
+            if (!outcome.updated && msg.transfer_status() != "CANCELED") {
+                FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Entry in the database not updated for "
+                    << msg.job_id() << " " << msg.file_id()
+                    << ". Probably already in a different terminal state. Tried to set "
+                    << msg.transfer_status() << " over " << outcome.storedState << commit;
+            }
+            else {
+                if (!msg.job_id().empty() && msg.file_id() > 0) {
+                    SingleTrStateInstance::instance().sendStateMessage(msg.job_id(), msg.file_id());
+                }
+                if (outcome.updated) {
+                    optimizer::OptimizerStatistics::instance().record(msg);
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            handleOtherMessageDbError(msg, e.what());
+        }
+        catch (...)
+        {
+            FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Message queue performOtherMessageDbChanges throw exception" << commit;
+            requeueMessage(msg);
+        }
     }
 }
 
 
+void MessageProcessingService::handleOtherMessageDbError(const fts3::events::Message& msg, const std::string& error)
+{
+    FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Message queue performOtherMessageDbChange throw exception " << error << commit;
+
+    // Encountered unexpected DB error. Terminate all files of a given job
+    if (isUnrecoverableErrorMessage(error)) {
+        FTS3_COMMON_LOGGER_NEWLOG(CRIT) << "Attempted database change with invalid values: " << error << commit;
+        db::DBSingleton::instance().getDBObjectInstance()->terminateReuseProcess(
+                msg.job_id(), msg.process_id(), "Database change failed due to invalid values", true);
+        return;
+    }
+
+    requeueMessage(msg);
+}
+
+
 void MessageProcessingService::handleUpdateMessages(const std::vector<fts3::events::Message>& messages)
 {
     for (auto iter = messages.begin(); iter != messages.end(); ++iter)
@@ -347,6 +456,14 @@ void MessageProcessingService::handleUpdateMessages(const std::vector<fts3::even
 void MessageProcessingService::handleOtherMessages(const std::vector<fts3::events::Message>& messages)
 {
     fts3::events::MessageUpdater msgUpdater;
+    StatusMessageBatch statusMessages;
+
+    auto prepare = [this](const fts3::events::Message& msg) {
+        return prepareOtherMessageDbChange(msg);
+    };
+    auto apply = [this](const std::vector<fts3::events::Message>& batch) {
+        performOtherMessageDbChanges(batch);
+    };
 
     for (auto iter = messages.begin(); iter != messages.end(); ++iter)
     {
@@ -367,10 +484,7 @@ void MessageProcessingService::handleOtherMessages(const std::vector<fts3::event
             msgUpdater.set_transferred(0);
             ThreadSafeList::get_instance().updateMsg(msgUpdater);
 
-            if ((*iter).transfer_status().compare("UPDATE") != 0)
-            {
-                performOtherMessageDbChange(*iter);
-            }
+            statusMessages.process(*iter, prepare, apply);
         }
         catch (const boost::filesystem::filesystem_error& e)
         {
@@ -385,6 +499,15 @@ void MessageProcessingService::handleOtherMessages(const std::vector<fts3::event
             FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Caught exception " << commit;
         }
     }
+
+    statusMessages.flush(apply);
+}
+
+
+void MessageProcessingService::requeueMessage(const fts3::events::Message& msg)
+{
+    ++requeued;
+    producer.runProducerStatus(msg);
 }
 
 
@@ -24,8 +24,10 @@
 
 #include <vector>
 
+#include "common/LatencyHistogram.h"
 #include "msg-bus/consumer.h"
 #include "msg-bus/producer.h"
+#include "msg-bus/Wakeup.h"
 #include "../BaseService.h"
 
 namespace fts3 {
@@ -41,6 +43,14 @@ private:
 
     Consumer consumer;
     Producer producer;
+    WakeupListener wakeup;
+
+    /// Status messages put back in the queue during the current pass
+    size_t requeued;
+
+    /// Time between url-copy sending a status message and its state being committed
+    fts3::common::LatencyHistogram statusLatency;
+    time_t lastLatencyReport;
 
 public:
 
@@ -63,8 +73,19 @@ private:
 
     /// Perform the database change associated with an UPDATE type message
     void performUpdateMessageDbChange(const fts3::events::Message& msg);
-    /// Perform the database change associated with a non-UPDATE type message
-    void performOtherMessageDbChange(const fts3::events::Message& msg);
+    /// Perform the per message steps associated with a non-UPDATE type message (retries, reuse termination)
+    /// @return true if the file and job state must be updated, false otherwise
+    bool prepareOtherMessageDbChange(const fts3::events::Message& msg);
+
+    /// Update the file and job states for a set of non-UPDATE messages in bulk
+    /// Messages that could not be applied are put back in the queue
+    void performOtherMessageDbChanges(const std::vector<fts3::events::Message>& statusMessages);
+
+    /// Put back the message in the queue, or terminate the job if the error is not recoverable
+    void handleOtherMessageDbError(const fts3::events::Message& msg, const std::string& error);
+
+    /// Put back a status message in the queue, so it is applied on a later pass
+    void requeueMessage(const fts3::events::Message& msg);
 
     /// Dump the messages and messages logs onto disk
     void dumpMessages();
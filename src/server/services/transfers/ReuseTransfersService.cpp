@@ -22,7 +22,6 @@
 
 #include <fstream>
 
-#include "common/DaemonTools.h"
 #include "config/ServerConfig.h"
 #include "cred/DelegCred.h"
 #include "ExecuteProcess.h"
@@ -32,6 +31,8 @@
 #include "CloudStorageConfig.h"
 #include "ThreadSafeList.h"
 #include "VoShares.h"
+#include "UrlCopyRegistry.h"
+#include "UrlCopyWorkerPool.h"
 
 
 using namespace fts3::common;
@@ -334,6 +335,7 @@ void ReuseTransfersService::startUrlCopy(std::string const & job_id, std::list<T
     }
     else
     {
+        UrlCopyRegistry::instance().add(pr.getPid());
         db->setPidForJob(job_id, pr.getPid());
     }
 
@@ -403,7 +405,8 @@ void ReuseTransfersService::executeUrlcopy()
 {
     // Bail out as soon as possible if there are too many url-copy processes
     int maxUrlCopy = config::ServerConfig::instance().get<int>("MaxUrlCopyProcesses");
-    int urlCopyCount = countProcessesWithName("fts_url_copy");
+    // Idle workers are not running any transfer
+    int urlCopyCount = UrlCopyRegistry::instance().count() - UrlCopyWorkerPool::instance().getIdleCount();
     int availableUrlCopySlots = maxUrlCopy - urlCopyCount;
 
     if (availableUrlCopySlots <= 0) {
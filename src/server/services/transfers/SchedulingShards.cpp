@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "SchedulingShards.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+
+
+using fts3::common::Symbol;
+using fts3::common::SymbolTable;
+
+
+namespace fts3 {
+namespace server {
+
+
+/// Decrement the counter, unless it is already exhausted
+static bool take(std::atomic<int> &counter)
+{
+    int current = counter.load(std::memory_order_relaxed);
+    while (current > 0) {
+        if (counter.compare_exchange_weak(current, current - 1, std::memory_order_acq_rel)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+SlotTable::SlotTable(int urlCopySlots): urlCopySlots(urlCopySlots)
+{
+}
+
+
+SlotTable::Counters *SlotTable::find(Symbol storage)
+{
+    boost::shared_lock<boost::shared_mutex> lock(mutex);
+    if (storage >= storages.size()) {
+        return NULL;
+    }
+    return storages[storage].get();
+}
+
+
+SlotTable::Counters *SlotTable::find(const std::string &storage)
+{
+    Symbol symbol;
+    if (!SymbolTable::storages().find(storage, symbol)) {
+        return NULL;
+    }
+    return find(symbol);
+}
+
+
+bool SlotTable::hasStorage(const std::string &storage)
+{
+    return find(storage) != NULL;
+}
+
+
+void SlotTable::addStorage(const std::string &storage, int inboundMaxActive, int outboundMaxActive)
+{
+    Symbol symbol = SymbolTable::storages().intern(storage);
+
+    boost::unique_lock<boost::shared_mutex> lock(mutex);
+    if (symbol >= storages.size()) {
+        storages.resize(symbol + 1);
+    }
+    if (!storages[symbol]) {
+        storages[symbol].reset(new Counters(inboundMaxActive, outboundMaxActive));
+    }
+}
+
+
+void SlotTable::addActive(const std::string &source, const std::string &dest, int count)
+{
+    Counters *sourceCounters = find(source);
+    Counters *destCounters = find(dest);
+    if (sourceCounters) {
+        sourceCounters->outbound -= count;
+    }
+    if (destCounters) {
+        destCounters->inbound -= count;
+    }
+}
+
+
+SlotTable::Result SlotTable::acquire(const std::string &source, const std::string &dest)
+{
+    return acquire(SymbolTable::storages().intern(source), SymbolTable::storages().intern(dest));
+}
+
+
+SlotTable::Result SlotTable::acquire(Symbol source, Symbol dest)
+{
+    // Unknown storages have no slots
+    Counters *sourceCounters = find(source);
+    Counters *destCounters = find(dest);
+
+    if (!take(urlCopySlots)) {
+        return URLCOPY_FULL;
+    }
+    if (!destCounters || !take(destCounters->inbound)) {
+        ++urlCopySlots;
+        return DESTINATION_FULL;
+    }
+    if (!sourceCounters || !take(sourceCounters->outbound)) {
+        ++destCounters->inbound;
+        ++urlCopySlots;
+        return SOURCE_FULL;
+    }
+    return ACQUIRED;
+}
+
+
+int SlotTable::getUrlCopySlots() const
+{
+    return urlCopySlots.load(std::memory_order_relaxed);
+}
+
+
+int SlotTable::getSourceSlots(const std::string &storage)
+{
+    Counters *counters = find(storage);
+    return counters ? counters->outbound.load() : 0;
+}
+
+
+int SlotTable::getDestinationSlots(const std::string &storage)
+{
+    Counters *counters = find(storage);
+    return counters ? counters->inbound.load() : 0;
+}
+
+
+std::vector<std::vector<QueueId>> partitionQueues(const std::vector<QueueId> &queues, unsigned nShards)
+{
+    if (nShards < 1) {
+        nShards = 1;
+    }
+
+    std::vector<std::vector<QueueId>> shards(nShards);
+    std::hash<std::string> hasher;
+    for (auto i = queues.begin(); i != queues.end(); ++i) {
+        size_t index = hasher(i->sourceSe + " " + i->destSe) % nShards;
+        shards[index].push_back(*i);
+    }
+
+    // Drop empty shards, so no thread is started for nothing
+    std::vector<std::vector<QueueId>> result;
+    for (auto i = shards.begin(); i != shards.end(); ++i) {
+        if (!i->empty()) {
+            result.push_back(std::move(*i));
+        }
+    }
+    return result;
+}
+
+
+std::vector<int> splitSlots(int slots, const std::vector<int> &ready)
+{
+    std::vector<int> quotas(ready.size(), 0);
+
+    int64_t total = 0;
+    for (auto i = ready.begin(); i != ready.end(); ++i) {
+        total += std::max(0, *i);
+    }
+    if (slots <= 0 || total == 0) {
+        return quotas;
+    }
+
+    // Enough for everyone
+    if (slots >= total) {
+        for (size_t i = 0; i < ready.size(); ++i) {
+            quotas[i] = std::max(0, ready[i]);
+        }
+        return quotas;
+    }
+
+    int given = 0;
+    std::vector<std::pair<int64_t, size_t>> remainders;
+    for (size_t i = 0; i < ready.size(); ++i) {
+        int64_t share = static_cast<int64_t>(slots) * std::max(0, ready[i]);
+        quotas[i] = static_cast<int>(share / total);
+        given += quotas[i];
+        remainders.emplace_back(share % total, i);
+    }
+
+    std::stable_sort(remainders.begin(), remainders.end(),
+        [](const std::pair<int64_t, size_t> &a, const std::pair<int64_t, size_t> &b) {
+            return a.first > b.first;
+        });
+    for (auto i = remainders.begin(); given < slots && i != remainders.end(); ++i) {
+        ++quotas[i->second];
+        ++given;
+    }
+
+    return quotas;
+}
+
+} // end namespace server
+} // end namespace fts3
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef SCHEDULINGSHARDS_H
+#define SCHEDULINGSHARDS_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <boost/thread.hpp>
+
+#include "common/Logger.h"
+#include "common/SymbolTable.h"
+#include "db/generic/QueueId.h"
+
+
+namespace fts3 {
+namespace server {
+
+/// Slots left for each storage, as source and as destination, plus the url copy slots left on this host.
+/// Counters are atomic, so several scheduling shards can draw from the same budget without a lock.
+/// Storages are registered while preparing the cycle, and they are only read afterwards.
+class SlotTable
+{
+public:
+    enum Result {
+        ACQUIRED,
+        URLCOPY_FULL,
+        DESTINATION_FULL,
+        SOURCE_FULL
+    };
+
+    /// Constructor
+    /// @param urlCopySlots How many url copy processes can still be started
+    explicit SlotTable(int urlCopySlots);
+
+    /// True if the limits of this storage are already known
+    bool hasStorage(const std::string &storage);
+
+    /// Set the limits of a storage, unless it is already registered
+    void addStorage(const std::string &storage, int inboundMaxActive, int outboundMaxActive);
+
+    /// Discount transfers already running between source and destination
+    void addActive(const std::string &source, const std::string &dest, int count);
+
+    /// Take one slot for a transfer from source to destination.
+    /// Either the three counters are decremented, or none is.
+    Result acquire(const std::string &source, const std::string &dest);
+
+    /// Same as above, with the storages given as symbols of SymbolTable::storages()
+    Result acquire(fts3::common::Symbol source, fts3::common::Symbol dest);
+
+    /// Url copy slots left
+    int getUrlCopySlots() const;
+
+    /// Slots left for the storage as source
+    int getSourceSlots(const std::string &storage);
+
+    /// Slots left for the storage as destination
+    int getDestinationSlots(const std::string &storage);
+
+private:
+    struct Counters {
+        std::atomic<int> inbound;
+        std::atomic<int> outbound;
+
+        Counters(int inbound, int outbound): inbound(inbound), outbound(outbound) {}
+    };
+
+    boost::shared_mutex mutex;
+    // Indexed by storage symbol
+    std::vector<std::unique_ptr<Counters>> storages;
+    std::atomic<int> urlCopySlots;
+
+    Counters *find(fts3::common::Symbol storage);
+    Counters *find(const std::string &storage);
+};
+
+/// Split the queues in at most nShards groups.
+/// All the queues of a link go to the same shard, and the relative order of the queues is kept.
+/// Storages shared between shards are arbitrated by the SlotTable.
+std::vector<std::vector<QueueId>> partitionQueues(const std::vector<QueueId> &queues, unsigned nShards);
+
+/// Split the url copy slots between the shards, proportionally to the transfers each one has ready,
+/// and never more than that. Shards only start transfers within their quota, so the first one
+/// to plan does not take the slots of the others. The remainder goes to the largest fractions.
+std::vector<int> splitSlots(int slots, const std::vector<int> &ready);
+
+/// Call func for each shard, each one on its own thread.
+/// With a single shard, func runs on the calling thread.
+/// Errors are logged, and do not affect the other shards.
+template <typename SHARD, typename FUNC>
+void runShards(std::vector<SHARD> &shards, FUNC func)
+{
+    auto guarded = [&func](SHARD &shard) {
+        try {
+            func(shard);
+        }
+        catch (const boost::thread_interrupted&) {
+            throw;
+        }
+        catch (const std::exception &e) {
+            FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Exception in scheduling shard: " << e.what() << fts3::common::commit;
+        }
+        catch (...) {
+            FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Exception in scheduling shard!" << fts3::common::commit;
+        }
+    };
+
+    if (shards.size() == 1) {
+        guarded(shards.front());
+        return;
+    }
+
+    boost::thread_group group;
+    try {
+        for (auto i = shards.begin(); i != shards.end(); ++i) {
+            SHARD *shard = &(*i);
+            group.create_thread([&guarded, shard]() { guarded(*shard); });
+        }
+        group.join_all();
+    }
+    catch (...) {
+        group.interrupt_all();
+        group.join_all();
+        throw;
+    }
+}
+
+} // end namespace server
+} // end namespace fts3
+
+#endif // SCHEDULINGSHARDS_H
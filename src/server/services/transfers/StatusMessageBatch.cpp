@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "StatusMessageBatch.h"
+
+
+namespace fts3 {
+namespace server {
+
+
+void StatusMessageBatch::process(const fts3::events::Message& msg, const PrepareFunc& prepare, const ApplyFunc& apply)
+{
+    if (msg.transfer_status() == "UPDATE") {
+        return;
+    }
+
+    // A retry resets the file right away, so what is pending for it must land first
+    if (mustFlushBefore(msg)) {
+        apply(take());
+    }
+
+    if (prepare(msg)) {
+        push(msg);
+    }
+}
+
+
+void StatusMessageBatch::flush(const ApplyFunc& apply)
+{
+    if (!empty()) {
+        apply(take());
+    }
+}
+
+
+bool StatusMessageBatch::mustFlushBefore(const fts3::events::Message& msg) const
+{
+    // Only a FAILED message may be retried, and only its own file is reset
+    return msg.transfer_status() == "FAILED" && pendingFiles.count(msg.file_id()) > 0;
+}
+
+
+void StatusMessageBatch::push(const fts3::events::Message& msg)
+{
+    pending.push_back(msg);
+    pendingFiles.insert(msg.file_id());
+}
+
+
+std::vector<fts3::events::Message> StatusMessageBatch::take()
+{
+    std::vector<fts3::events::Message> batch;
+    batch.swap(pending);
+    pendingFiles.clear();
+    return batch;
+}
+
+
+bool StatusMessageBatch::empty() const
+{
+    return pending.empty();
+}
+
+} // end namespace server
+} // end namespace fts3
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef STATUSMESSAGEBATCH_H
+#define STATUSMESSAGEBATCH_H
+
+#include <functional>
+#include <set>
+#include <vector>
+
+#include "msg-bus/events.h"
+
+
+namespace fts3 {
+namespace server {
+
+/// Status messages waiting to be applied with a single bulk update.
+/// The per message steps run before a message joins the batch, and a retry writes the file
+/// state straight away. If an earlier message for the same file were still waiting, the bulk update
+/// would apply it over the retry, so the batch must be applied first to keep the order url-copy sent them in.
+class StatusMessageBatch
+{
+public:
+    /// Runs the per message steps. Returns false if the message must not join the batch.
+    typedef std::function<bool (const fts3::events::Message&)> PrepareFunc;
+    /// Applies a batch of messages with a single bulk update
+    typedef std::function<void (const std::vector<fts3::events::Message>&)> ApplyFunc;
+
+    /// Run the per message steps of msg, and add it to the batch if they say so.
+    /// If msg may change the state of a file with pending messages, these are applied first.
+    /// UPDATE messages are ignored.
+    void process(const fts3::events::Message& msg, const PrepareFunc& prepare, const ApplyFunc& apply);
+
+    /// Apply the pending messages, if any
+    void flush(const ApplyFunc& apply);
+
+    /// True if the pending messages must be applied before running the per message steps of msg
+    bool mustFlushBefore(const fts3::events::Message& msg) const;
+
+    /// Add a message to the batch
+    void push(const fts3::events::Message& msg);
+
+    /// Return the pending messages, in arrival order, and empty the batch
+    std::vector<fts3::events::Message> take();
+
+    /// True if there are no pending messages
+    bool empty() const;
+
+private:
+    std::vector<fts3::events::Message> pending;
+    std::set<uint64_t> pendingFiles;
+};
+
+} // end namespace server
+} // end namespace fts3
+
+#endif // STATUSMESSAGEBATCH_H
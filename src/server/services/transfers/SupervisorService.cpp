@@ -26,9 +26,14 @@ using namespace fts3::common;
 namespace fts3 {
 namespace server {
 
+/// How long to keep gathering pings once the first one arrives
+static const boost::posix_time::milliseconds PING_BATCH_WINDOW(100);
+/// Commit the progress once this many pings are gathered, even if the window did not expire
+static const size_t PING_MAX_BATCH = 5000;
+
 
 SupervisorService::SupervisorService(): BaseService("SupervisorService"),
-    zmqContext(1), zmqPingSocket(zmqContext, ZMQ_SUB)
+    zmqContext(1), zmqPingSocket(zmqContext, ZMQ_SUB), lastLatencyReport(time(NULL))
 {
     std::string messagingDirectory = config::ServerConfig::instance().get<std::string>("MessagingDirectory");
     std::string address = std::string("ipc://") + messagingDirectory + "/url_copy-ping.ipc";
@@ -45,9 +50,26 @@ void SupervisorService::runService()
         zmq::message_t message;
 
         try {
-            boost::this_thread::sleep(boost::posix_time::seconds(1));
+            // Wake up as soon as a ping arrives, then keep gathering for a short window,
+            // so a steady stream of pings is still committed in batches
+            zmq::pollitem_t pollItem = {static_cast<void*>(zmqPingSocket), 0, ZMQ_POLLIN, 0};
+            zmq::poll(&pollItem, 1, 1000);
+            boost::this_thread::interruption_point();
+
+            auto deadline = boost::posix_time::microsec_clock::universal_time() + PING_BATCH_WINDOW;
+            while (events.size() < PING_MAX_BATCH) {
+                if (!zmqPingSocket.recv(&message, ZMQ_NOBLOCK)) {
+                    if (events.empty()) {
+                        break;
+                    }
+                    auto remaining = deadline - boost::posix_time::microsec_clock::universal_time();
+                    if (remaining.is_negative() ||
+                        zmq::poll(&pollItem, 1, static_cast<long>(remaining.total_milliseconds())) <= 0) {
+                        break;
+                    }
+                    continue;
+                }
 
-            while (zmqPingSocket.recv(&message, ZMQ_NOBLOCK)) {
                 fts3::events::MessageUpdater event;
                 if (!event.ParseFromArray(message.data(), message.size())) {
                     continue;
@@ -68,8 +90,8 @@ void SupervisorService::runService()
                                                 << " timestamp=" << event.gfal_perf_timestamp() / 1000
                                                 << " inst_throughput=" << event.instantaneous_throughput()
                                                 << " dif_transferred=" << event.transferred_since_last_ping()
-                                                << " source_se=" << Uri::parse(event.source_surl()).getSeName()
-                                                << " dest_se=" << Uri::parse(event.dest_surl()).getSeName()
+                                                << " source_se=" << UriView::parse(event.source_surl()).getSeName()
+                                                << " dest_se=" << UriView::parse(event.dest_surl()).getSeName()
                                                 << commit;
 
                 ThreadSafeList::get_instance().updateMsg(event);
@@ -77,8 +99,19 @@ void SupervisorService::runService()
 
             if (!events.empty()) {
                 db::DBSingleton::instance().getDBObjectInstance()->updateFileTransferProgressVector(events);
+
+                int64_t now = static_cast<int64_t>(millisecondsSinceEpoch());
+                for (auto i = events.begin(); i != events.end(); ++i) {
+                    pingLatency.record(now - static_cast<int64_t>(i->timestamp()));
+                }
                 events.clear();
             }
+
+            if (pingLatency.getCount() > 0 && time(NULL) - lastLatencyReport >= 60) {
+                FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Ping message latency: " << pingLatency.summary() << commit;
+                pingLatency.reset();
+                lastLatencyReport = time(NULL);
+            }
         }
         catch (const boost::thread_interrupted&) {
             FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Thread interruption requested" << commit;
@@ -18,6 +18,7 @@
 #define FTS3_SUPERVISORSERVICE_H
 
 #include "../BaseService.h"
+#include "common/LatencyHistogram.h"
 #include <zmq.hpp>
 
 namespace fts3 {
@@ -33,6 +34,10 @@ protected:
     zmq::context_t zmqContext;
     zmq::socket_t zmqPingSocket;
 
+    /// Time between url-copy sending a ping and its progress being committed
+    fts3::common::LatencyHistogram pingLatency;
+    time_t lastLatencyReport;
+
 public:
     /// Constructor
     SupervisorService();
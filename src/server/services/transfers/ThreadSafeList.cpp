@@ -29,6 +29,14 @@
 using fts3::common::SystemError;
 
 
+/// Lock the shard, giving up after 10 seconds
+#define LOCK_SHARD(shard) \
+    if (!(shard).mutex.timed_lock(boost::posix_time::seconds(10))) { \
+        throw SystemError(std::string(__func__) + ": Mutex timeout expired"); \
+    } \
+    boost::lock_guard<boost::timed_mutex> shardGuard((shard).mutex, boost::adopt_lock)
+
+
 ThreadSafeList::ThreadSafeList()
 {
 }
@@ -39,23 +47,109 @@ ThreadSafeList::~ThreadSafeList()
 }
 
 
+ThreadSafeList::Shard &ThreadSafeList::getShard(uint64_t fileId)
+{
+    return shards[fileId % N_SHARDS];
+}
+
+
+unsigned ThreadSafeList::getShardIndex(const Shard &shard) const
+{
+    return &shard - shards;
+}
+
+
+uint64_t ThreadSafeList::getPidStartTime(int pid)
+{
+    {
+        boost::lock_guard<boost::mutex> lock(pidsMutex);
+        auto i = pids.find(pid);
+        if (i != pids.end() && i->second.startTime > 0) {
+            return i->second.startTime;
+        }
+    }
+
+    uint64_t startTime = fts3::common::getPidStartime(pid);
+    // Do not remember processes that could not be found, or that are not tracked anymore
+    if (startTime > 0) {
+        boost::lock_guard<boost::mutex> lock(pidsMutex);
+        auto i = pids.find(pid);
+        if (i != pids.end()) {
+            i->second.startTime = startTime;
+        }
+    }
+    return startTime;
+}
+
+
+void ThreadSafeList::remove(Shard &shard, const Key &key)
+{
+    auto entry = shard.entries.find(key);
+    if (entry == shard.entries.end()) {
+        return;
+    }
+
+    int pid = entry->second.msg.process_id();
+    auto pidIndex = shard.byPid.find(pid);
+    if (pidIndex != shard.byPid.end()) {
+        pidIndex->second.erase(key);
+        if (pidIndex->second.empty()) {
+            shard.byPid.erase(pidIndex);
+
+            boost::lock_guard<boost::mutex> lock(pidsMutex);
+            auto info = pids.find(pid);
+            if (info != pids.end()) {
+                info->second.shardMask &= ~(1u << getShardIndex(shard));
+                if (info->second.shardMask == 0) {
+                    pids.erase(info);
+                }
+            }
+        }
+    }
+
+    // The heap node is left behind, and discarded when it reaches the top
+    shard.entries.erase(entry);
+}
+
+
 void ThreadSafeList::push_back(fts3::events::MessageUpdater &msg)
 {
-    if (!_mutex.timed_lock(boost::posix_time::seconds(10))) {
-        throw SystemError(std::string(__func__) + ": Mutex timeout expired");
+    Key key(msg.job_id(), msg.file_id());
+    Shard &shard = getShard(msg.file_id());
+    LOCK_SHARD(shard);
+
+    remove(shard, key);
+
+    Entry &entry = shard.entries[key];
+    entry.msg = msg;
+    entry.generation = ++shard.generation;
+    shard.byPid[msg.process_id()].insert(key);
+
+    {
+        boost::lock_guard<boost::mutex> lock(pidsMutex);
+        PidInfo &info = pids[msg.process_id()];
+        info.shardMask |= (1u << getShardIndex(shard));
+        // A new process may be reusing the pid of a previous one
+        info.startTime = 0;
     }
-    m_list.push_back(msg);
-    _mutex.unlock();
+
+    HeapNode node = {msg.timestamp(), entry.generation, key};
+    shard.expiry.push(node);
 }
 
 
 void ThreadSafeList::clear()
 {
-    if (!_mutex.timed_lock(boost::posix_time::seconds(10))) {
-        throw SystemError(std::string(__func__) + ": Mutex timeout expired");
+    for (unsigned i = 0; i < N_SHARDS; ++i) {
+        Shard &shard = shards[i];
+        LOCK_SHARD(shard);
+        shard.entries.clear();
+        shard.byPid.clear();
+        shard.expiry = decltype(shard.expiry)();
     }
-    m_list.clear();
-    _mutex.unlock();
+
+    boost::lock_guard<boost::mutex> lock(pidsMutex);
+    pids.clear();
 }
 
 
@@ -64,110 +158,145 @@ void ThreadSafeList::checkExpiredMsg(std::vector<fts3::events::MessageUpdater> &
 {
     static const boost::posix_time::ptime epoch(boost::gregorian::date(1970, 1, 1));
 
-    if (!_mutex.timed_lock(boost::posix_time::seconds(10))) {
-        throw SystemError(std::string(__func__) + ": Mutex timeout expired");
-    }
+    auto nowTime = boost::posix_time::microsec_clock::universal_time();
+    auto cutoff = nowTime - timeout - epoch;
+    // Anything last seen before this is expired
+    int64_t cutoffMs = cutoff.total_milliseconds();
+
+    for (unsigned i = 0; i < N_SHARDS; ++i) {
+        Shard &shard = shards[i];
+        LOCK_SHARD(shard);
 
-    try {
-        for (auto iter = m_list.begin(); iter != m_list.end(); ++iter) {
-            auto nowTime = boost::posix_time::microsec_clock::universal_time();
-            auto lastMsgTime = epoch + boost::posix_time::milliseconds(iter->timestamp());
+        std::vector<HeapNode> stillExpired;
 
-            auto age = nowTime - lastMsgTime;
+        while (!shard.expiry.empty() && static_cast<int64_t>(shard.expiry.top().timestamp) < cutoffMs) {
+            HeapNode node = shard.expiry.top();
+            shard.expiry.pop();
 
-            if (age > timeout) {
-                messages.push_back(*iter);
+            auto entry = shard.entries.find(node.key);
+            if (entry == shard.entries.end() || entry->second.generation != node.generation) {
+                continue;
             }
+
+            // Heard of since this node was queued, so reschedule
+            uint64_t lastSeen = entry->second.msg.timestamp();
+            if (static_cast<int64_t>(lastSeen) >= cutoffMs) {
+                node.timestamp = lastSeen;
+                shard.expiry.push(node);
+                continue;
+            }
+
+            messages.push_back(entry->second.msg);
+            // Until it is removed, it must be reported again on the next check
+            stillExpired.push_back(node);
+        }
+
+        for (auto node = stillExpired.begin(); node != stillExpired.end(); ++node) {
+            shard.expiry.push(*node);
         }
     }
-    catch (...) {
-        _mutex.unlock();
-        throw;
-    }
-    _mutex.unlock();
 }
 
 
 void ThreadSafeList::updateMsg(fts3::events::MessageUpdater &msg)
 {
-    if (!_mutex.timed_lock(boost::posix_time::seconds(10))) {
-        throw SystemError(std::string(__func__) + ": Mutex timeout expired");
+    int pid = msg.process_id();
+    uint32_t shardMask = 0;
+    {
+        boost::lock_guard<boost::mutex> lock(pidsMutex);
+        auto info = pids.find(pid);
+        if (info != pids.end()) {
+            shardMask = info->second.shardMask;
+        }
+    }
+    if (shardMask == 0) {
+        return;
     }
 
-    try {
-        std::list<fts3::events::MessageUpdater>::iterator iter;
-        uint64_t pidStartTime = fts3::common::getPidStartime(msg.process_id());
-        for (iter = m_list.begin(); iter != m_list.end(); ++iter) {
+    uint64_t pidStartTime = getPidStartTime(pid);
 
-            if (msg.process_id() == iter->process_id()) {
-                if (pidStartTime > 0 && msg.timestamp() >= pidStartTime) {
-                    iter->set_timestamp(msg.timestamp());
-                }
-                else if (pidStartTime > 0) {
-                    FTS3_COMMON_LOGGER_NEWLOG(WARNING)
-                        << "Found a matching pid, but start time is more recent than last known message"
-                        << "(" << pidStartTime << " vs " << msg.timestamp() << " for " << msg.process_id() << ")"
-                        << fts3::common::commit;
-                }
+    // A session reuse process runs several transfers, so all of them must be refreshed.
+    // Only the shards that hold them are locked.
+    for (unsigned i = 0; i < N_SHARDS; ++i) {
+        if (!(shardMask & (1u << i))) {
+            continue;
+        }
+
+        Shard &shard = shards[i];
+        LOCK_SHARD(shard);
+
+        auto pidIndex = shard.byPid.find(pid);
+        if (pidIndex == shard.byPid.end()) {
+            continue;
+        }
+
+        for (auto key = pidIndex->second.begin(); key != pidIndex->second.end(); ++key) {
+            auto entry = shard.entries.find(*key);
+            if (entry == shard.entries.end()) {
+                continue;
+            }
+
+            if (pidStartTime > 0 && msg.timestamp() >= pidStartTime) {
+                // The heap is not touched: the stale node is rescheduled when it reaches the top
+                entry->second.msg.set_timestamp(msg.timestamp());
+            }
+            else if (pidStartTime > 0) {
+                FTS3_COMMON_LOGGER_NEWLOG(WARNING)
+                    << "Found a matching pid, but start time is more recent than last known message"
+                    << "(" << pidStartTime << " vs " << msg.timestamp() << " for " << msg.process_id() << ")"
+                    << fts3::common::commit;
             }
         }
     }
-    catch (...) {
-        _mutex.unlock();
-        throw;
-    }
-    _mutex.unlock();
 }
 
 
-void ThreadSafeList::deleteMsg(std::vector<fts3::events::MessageUpdater> &messages)
+void ThreadSafeList::unbindPid(int pid)
 {
-    if (!_mutex.timed_lock(boost::posix_time::seconds(10))) {
-        throw SystemError(std::string(__func__) + ": Mutex timeout expired");
+    uint32_t shardMask = 0;
+    {
+        boost::lock_guard<boost::mutex> lock(pidsMutex);
+        auto info = pids.find(pid);
+        if (info == pids.end()) {
+            return;
+        }
+        shardMask = info->second.shardMask;
+        pids.erase(info);
     }
 
-    try {
-        std::list<fts3::events::MessageUpdater>::iterator i = m_list.begin();
-        for (auto iter = messages.begin(); iter != messages.end(); ++iter) {
-            i = m_list.begin();
-            while (i != m_list.end()) {
-                if ((*iter).file_id() == i->file_id() && (*iter).job_id().compare(i->job_id()) == 0) {
-                    m_list.erase(i++);
-                }
-                else {
-                    ++i;
-                }
-            }
+    for (unsigned i = 0; i < N_SHARDS; ++i) {
+        if (shardMask & (1u << i)) {
+            Shard &shard = shards[i];
+            LOCK_SHARD(shard);
+            shard.byPid.erase(pid);
         }
     }
-    catch (...) {
-        _mutex.unlock();
-        throw;
+}
+
+
+void ThreadSafeList::deleteMsg(std::vector<fts3::events::MessageUpdater> &messages)
+{
+    for (auto iter = messages.begin(); iter != messages.end(); ++iter) {
+        removeFinishedTr(iter->job_id(), iter->file_id());
     }
-    _mutex.unlock();
 }
 
 
 void ThreadSafeList::removeFinishedTr(std::string job_id, uint64_t file_id)
 {
-    if (!_mutex.timed_lock(boost::posix_time::seconds(10))) {
-        throw SystemError(std::string(__func__) + ": Mutex timeout expired");
-    }
+    Shard &shard = getShard(file_id);
+    LOCK_SHARD(shard);
+    remove(shard, Key(job_id, file_id));
+}
 
-    try {
-        std::list<fts3::events::MessageUpdater>::iterator i = m_list.begin();
-        while (i != m_list.end()) {
-            if (file_id == i->file_id() && job_id == i->job_id()) {
-                m_list.erase(i++);
-            }
-            else {
-                ++i;
-            }
-        }
-    }
-    catch (...) {
-        _mutex.unlock();
-        throw;
+
+size_t ThreadSafeList::size()
+{
+    size_t total = 0;
+    for (unsigned i = 0; i < N_SHARDS; ++i) {
+        Shard &shard = shards[i];
+        LOCK_SHARD(shard);
+        total += shard.entries.size();
     }
-    _mutex.unlock();
+    return total;
 }
@@ -21,13 +21,23 @@
 #ifndef THREADSAFELIST_H_
 #define THREADSAFELIST_H_
 
-#include <list>
+#include <functional>
+#include <queue>
+#include <set>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include <boost/thread.hpp>
 #include "msg-bus/events.h"
 
 
+/// Keeps track of the running url-copy processes, and when they were last heard of,
+/// so the stalled ones can be found.
+/// Entries are spread over shards by file id. Within a shard they are indexed by (job id, file id)
+/// and by pid, so updates cost the same regardless of how many transfers are running.
+/// A pid index tells which shards hold the transfers of a process, so a ping only locks those.
+/// Expiration candidates are kept in a min-heap by last seen timestamp, so finding
+/// the stalled transfers only touches the entries that did expire.
 class ThreadSafeList
 {
 public:
@@ -48,9 +58,67 @@ public:
     void deleteMsg(std::vector<fts3::events::MessageUpdater>& messages);
     void removeFinishedTr(std::string job_id, uint64_t file_id);
 
+    /// Stop refreshing the transfers already tracked for pid when it pings.
+    /// An url copy worker runs one transfer after the other under the same pid, so the ones
+    /// it ran before must expire on their own if they are still here.
+    void unbindPid(int pid);
+
+    /// Number of tracked transfers
+    size_t size();
+
 private:
-    std::list<fts3::events::MessageUpdater> m_list;
-    mutable boost::recursive_timed_mutex _mutex;
+    static const unsigned N_SHARDS = 16;
+
+    typedef std::pair<std::string, uint64_t> Key;
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const {
+            return std::hash<std::string>()(key.first) ^ std::hash<uint64_t>()(key.second);
+        }
+    };
+
+    struct Entry {
+        fts3::events::MessageUpdater msg;
+        /// Bumped on each push_back, so heap nodes from a previous incarnation can be told apart
+        uint64_t generation;
+    };
+
+    struct HeapNode {
+        uint64_t timestamp;
+        uint64_t generation;
+        Key key;
+
+        bool operator > (const HeapNode &other) const {
+            return timestamp > other.timestamp;
+        }
+    };
+
+    struct Shard {
+        boost::timed_mutex mutex;
+        std::unordered_map<Key, Entry, KeyHash> entries;
+        std::unordered_map<int, std::set<Key>> byPid;
+        std::priority_queue<HeapNode, std::vector<HeapNode>, std::greater<HeapNode>> expiry;
+        uint64_t generation = 0;
+    };
+
+    struct PidInfo {
+        /// Bit i set if shards[i] has transfers of this process
+        uint32_t shardMask = 0;
+        /// Start time of the process, to avoid reading /proc on every ping. 0 if not known yet.
+        uint64_t startTime = 0;
+    };
+
+    static_assert(N_SHARDS <= 32, "The shard mask of a pid does not fit");
+
+    Shard shards[N_SHARDS];
+
+    boost::mutex pidsMutex;
+    std::unordered_map<int, PidInfo> pids;
+
+    Shard &getShard(uint64_t fileId);
+    unsigned getShardIndex(const Shard &shard) const;
+    uint64_t getPidStartTime(int pid);
+    void remove(Shard &shard, const Key &key);
 };
 
 #endif /*THREADSAFELIST_H_*/
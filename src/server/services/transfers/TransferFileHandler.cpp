@@ -20,131 +20,104 @@
 
 #include "TransferFileHandler.h"
 
+#include <algorithm>
+
 namespace fts3
 {
 namespace server
 {
 
-std::map< std::string, std::set<std::string> >& TransferFileHandler::getMapFromCache(std::map< std::string, std::list<TransferFile> >& files, GET_MAP_OPTS opt)
-{
-    if (init_cache.empty())
-        {
-            init_cache.resize(4); // there are four maps
-
-            std::map<std::string, std::list<TransferFile> >::iterator it_v;
+using fts3::common::SymbolTable;
 
-            std::map< std::string, std::set<FileIndex> > unique;
 
-            // iterate over all VOs
-            for (it_v = files.begin(); it_v != files.end(); ++it_v)
+TransferFileHandler::TransferFileHandler(std::map< std::string, std::list<TransferFile> >& files)
+{
+    // iterate over all VOs
+    for (auto it_v = files.begin(); it_v != files.end(); ++it_v)
+        {
+            // the vo symbol
+            Symbol vo = SymbolTable::vos().intern(it_v->first);
+            // ref to the list of files (for the given VO)
+            std::list<TransferFile>& tfs = it_v->second;
+            if (tfs.empty())
+                continue;
+
+            // iterate over all files in a given VO
+            for (auto it_tf = tfs.begin(); it_tf != tfs.end(); ++it_tf)
                 {
-                    // the vo name
-                    std::string vo = it_v->first;
-                    // unique vo names
-                    vos.insert(vo);
-                    // ref to the list of files (for the given VO)
-                    std::list<TransferFile>& tfs = it_v->second;
-                    std::list<TransferFile>::iterator it_tf;
-                    // iterate over all files in a given VO
-                    for (it_tf = tfs.begin(); it_tf != tfs.end(); ++it_tf)
+                    TransferFile& tmp = *it_tf;
+                    tmp.internSymbols();
+
+                    sourceToDestinations[tmp.sourceSeId].insert(tmp.destSeId);
+                    sourceToVos[tmp.sourceSeId].insert(tmp.voId);
+                    destinationToSources[tmp.destSeId].insert(tmp.sourceSeId);
+                    destinationToVos[tmp.destSeId].insert(tmp.voId);
+
+                    // create index (job ID + file index)
+                    FileIndex index(tmp.jobId, tmp.fileIndex);
+                    // file index to files mapping
+                    auto inserted = fileIndexToFiles.emplace(std::move(index), std::list<TransferFile>());
+                    // only the first replica of a file is queued
+                    if (inserted.second)
                         {
-
-                            TransferFile tmp = *it_tf;
-
-                            init_cache[SOURCE_TO_DESTINATIONS][tmp.sourceSe].insert(tmp.destSe);
-                            init_cache[SOURCE_TO_VOS][tmp.sourceSe].insert(tmp.voName);
-                            init_cache[DESTINATION_TO_SOURCES][tmp.destSe].insert(tmp.sourceSe);
-                            init_cache[DESTINATION_TO_VOS][tmp.destSe].insert(tmp.voName);
-
-                            // create index (job ID + file index)
-                            FileIndex index((*it_tf).jobId, tmp.fileIndex);
-                            // file index to files mapping
-                            fileIndexToFiles[index].push_back(tmp);
-                            // check if the mapping for the VO already exists
-                            if (!unique[vo].count(index))
-                                {
-                                    // if not creat it
-                                    unique[vo].insert(index);
-                                    voToFileIndexes[it_v->first][make_pair(tmp.sourceSe, tmp.destSe)].push_back(index);
-                                }
+                            voToFileIndexes[vo].pairs[SymbolPair(tmp.sourceSeId, tmp.destSeId)].push_back(inserted.first);
                         }
-
-                    nextPairForVo[it_v->first] = voToFileIndexes[it_v->first].begin();
+                    inserted.first->second.push_back(std::move(tmp));
                 }
         }
 
-    return init_cache[opt];
-}
-
-
-TransferFileHandler::TransferFileHandler(std::map< std::string, std::list<TransferFile> >& files) :
-    sourceToDestinations(getMapFromCache(files, SOURCE_TO_DESTINATIONS)),
-    sourceToVos(getMapFromCache(files, SOURCE_TO_VOS)),
-    destinationToSources(getMapFromCache(files, DESTINATION_TO_SOURCES)),
-    destinationToVos(getMapFromCache(files, DESTINATION_TO_VOS))
-{
-    init_cache.clear();
+    // unique vo names
+    for (auto it = voToFileIndexes.begin(); it != voToFileIndexes.end(); ++it)
+        {
+            vos.push_back(it->first);
+            it->second.next = it->second.pairs.begin();
+        }
+    // Keep the order by VO name
+    std::sort(vos.begin(), vos.end(), [](Symbol a, Symbol b) {
+        return SymbolTable::vos().name(a) < SymbolTable::vos().name(b);
+    });
 }
 
 TransferFileHandler::~TransferFileHandler()
 {
-    std::map< FileIndex, std::list<TransferFile> >::iterator it;
-    for (it = fileIndexToFiles.begin(); it != fileIndexToFiles.end(); ++it)
-        {
-            freeList(it->second);
-        }
 }
 
-boost::optional<TransferFile> TransferFileHandler::get(std::string vo)
+boost::optional<TransferFile> TransferFileHandler::get(Symbol vo)
 {
     // get the index of the next File in turn for the VO
-    boost::optional<FileIndex> index = getIndex(vo);
+    boost::optional<FileMap::iterator> index = getIndex(vo);
     // if the index exists return the file
     if (index) return getFile(*index);
 
     return boost::optional<TransferFile>();
 }
 
-boost::optional< std::pair<std::string, std::string> > TransferFileHandler::getNextPair(std::string vo)
-{
-    // if there are no pairs for the given VO ...
-    if (voToFileIndexes[vo].empty()) return boost::optional< std::pair<std::string, std::string> >();
-
-    // if it is the end wrap around
-    if (nextPairForVo[vo] == voToFileIndexes[vo].end()) nextPairForVo[vo] = voToFileIndexes[vo].begin();
-
-    // get the iterator
-    std::map< std::pair<std::string, std::string>, std::list<FileIndex> >::iterator ret = nextPairForVo[vo];
-
-    // set the next pair
-    nextPairForVo[vo]++;
-
-    return ret->first;
-}
-
-boost::optional<FileIndex> TransferFileHandler::getIndex(std::string vo)
+boost::optional<TransferFileHandler::FileMap::iterator> TransferFileHandler::getIndex(Symbol vo)
 {
     // find the item
-    std::map<std::string, std::map< std::pair<std::string, std::string>, std::list<FileIndex> > >::iterator it =
-        voToFileIndexes.find(vo);
+    auto it = voToFileIndexes.find(vo);
 
     // if the VO has no mapping or no files are assigned to the VO ...
-    if (it == voToFileIndexes.end() || it->second.empty()) return boost::optional<FileIndex>();
+    if (it == voToFileIndexes.end() || it->second.pairs.empty()) return boost::optional<FileMap::iterator>();
+
+    VoQueue& queue = it->second;
 
-    boost::optional< std::pair<std::string, std::string> > src_dst = getNextPair(vo);
+    // if it is the end wrap around
+    if (queue.next == queue.pairs.end()) queue.next = queue.pairs.begin();
 
-    if (!src_dst.is_initialized()) return boost::optional<FileIndex>();
+    // get the pair in turn, and set the next one
+    auto src_dst = queue.next++;
 
     // get the index value
-    FileIndex index = it->second[*src_dst].front();
-    it->second[*src_dst].pop_front();
+    FileMap::iterator index = src_dst->second.front();
+    src_dst->second.pop_front();
 
     // if there are no more values assigned to either VO or pair remove it from respective mapping
-    if (it->second[*src_dst].empty())
+    if (src_dst->second.empty())
         {
-            it->second.erase(*src_dst);
+            queue.pairs.erase(src_dst);
 
-            if (it->second.empty())
+            if (queue.pairs.empty())
                 {
                     voToFileIndexes.erase(it);
                 }
@@ -153,35 +126,27 @@ boost::optional<FileIndex> TransferFileHandler::getIndex(std::string vo)
     return index;
 }
 
-boost::optional<TransferFile> TransferFileHandler::getFile(FileIndex index)
+boost::optional<TransferFile> TransferFileHandler::getFile(FileMap::iterator index)
 {
     boost::optional<TransferFile> ret;
 
-    // if there's no mapping for this index ..
-    if (fileIndexToFiles.find(index) == fileIndexToFiles.end()) return ret;
-
-    if (!fileIndexToFiles[index].empty())
+    if (!index->second.empty())
         {
             // get the first in the list
-            ret = fileIndexToFiles[index].front();
+            ret = std::move(index->second.front());
             // remove it from the list
-            fileIndexToFiles[index].pop_front();
+            index->second.pop_front();
         }
 
     return ret;
 }
 
-void TransferFileHandler::freeList(std::list<TransferFile>& l)
-{
-    l.clear();
-}
-
-std::set<std::string>::iterator TransferFileHandler::begin()
+std::vector<Symbol>::const_iterator TransferFileHandler::begin() const
 {
     return vos.begin();
 }
 
-std::set<std::string>::iterator TransferFileHandler::end()
+std::vector<Symbol>::const_iterator TransferFileHandler::end() const
 {
     return vos.end();
 }
@@ -191,60 +156,54 @@ bool TransferFileHandler::empty()
     return voToFileIndexes.empty();
 }
 
-const std::set<std::string> TransferFileHandler::getSources(std::string se) const
+const std::set<std::string> TransferFileHandler::lookup(const SymbolRelation &relation,
+    const SymbolTable &values, const std::string &se)
 {
-    std::map< std::string, std::set<std::string> >::const_iterator it = destinationToSources.find(se);
-    if (it != destinationToSources.end())
+    std::set<std::string> ret;
+
+    Symbol symbol;
+    if (!SymbolTable::storages().find(se, symbol))
+        return ret;
+
+    auto it = relation.find(symbol);
+    if (it != relation.end())
         {
-            return it->second;
+            for (auto i = it->second.begin(); i != it->second.end(); ++i)
+                {
+                    ret.insert(values.name(*i));
+                }
         }
 
-    return std::set<std::string>();
+    return ret;
 }
 
-const std::set<std::string> TransferFileHandler::getDestinations(std::string se) const
+const std::set<std::string> TransferFileHandler::getSources(std::string se) const
 {
-    std::map< std::string, std::set<std::string> >::const_iterator it = sourceToDestinations.find(se);
-    if (it != sourceToDestinations.end())
-        {
-            return it->second;
-        }
+    return lookup(destinationToSources, SymbolTable::storages(), se);
+}
 
-    return std::set<std::string>();
+const std::set<std::string> TransferFileHandler::getDestinations(std::string se) const
+{
+    return lookup(sourceToDestinations, SymbolTable::storages(), se);
 }
 
 
 const std::set<std::string> TransferFileHandler::getSourcesVos(std::string se) const
 {
-    std::map< std::string, std::set<std::string> >::const_iterator it = destinationToVos.find(se);
-    if (it != destinationToVos.end())
-        {
-            return it->second;
-        }
-
-    return std::set<std::string>();
+    return lookup(destinationToVos, SymbolTable::vos(), se);
 }
 
 const std::set<std::string> TransferFileHandler::getDestinationsVos(std::string se) const
 {
-    std::map< std::string, std::set<std::string> >::const_iterator it = sourceToVos.find(se);
-    if (it != sourceToVos.end())
-        {
-            return it->second;
-        }
-
-    return std::set<std::string>();
+    return lookup(sourceToVos, SymbolTable::vos(), se);
 }
 
 int TransferFileHandler::size()
 {
     int sum = 0;
 
-    std::map< std::string, std::map< std::pair<std::string, std::string>, std::list<FileIndex> > >::iterator iout;
-    std::map< std::pair<std::string, std::string>, std::list<FileIndex> >::iterator iin;
-
-    for (iout = voToFileIndexes.begin(); iout != voToFileIndexes.end(); iout++)
-        for (iin = iout->second.begin(); iin != iout->second.end(); iin++)
+    for (auto iout = voToFileIndexes.begin(); iout != voToFileIndexes.end(); iout++)
+        for (auto iin = iout->second.pairs.begin(); iin != iout->second.pairs.end(); iin++)
             sum += (unsigned int) iin->second.size();
 
     return sum;
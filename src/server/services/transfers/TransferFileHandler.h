@@ -23,11 +23,15 @@
 
 
 #include "db/generic/SingleDbInstance.h"
+#include "common/SymbolTable.h"
 
+#include <deque>
 #include <list>
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <boost/optional.hpp>
 
@@ -37,29 +41,29 @@ namespace server
 {
 
 using namespace db;
+using fts3::common::Symbol;
 
 typedef std::pair<std::string, int> FileIndex;
 
+/// Source and destination storage symbols
+typedef std::pair<Symbol, Symbol> SymbolPair;
+
+/// Storages and VOs are handled as symbols (see fts3::common::SymbolTable),
+/// so the queues are keyed and compared by integer
 class TransferFileHandler
 {
 
-    enum GET_MAP_OPTS
-    {
-        SOURCE_TO_DESTINATIONS,
-        SOURCE_TO_VOS,
-        DESTINATION_TO_SOURCES,
-        DESTINATION_TO_VOS
-    };
-
 public:
 
+    /// The files are moved out of the lists
     TransferFileHandler(std::map< std::string, std::list<TransferFile> >& files);
     virtual ~TransferFileHandler();
 
-    boost::optional<TransferFile> get(std::string vo);
+    boost::optional<TransferFile> get(Symbol vo);
 
-    std::set<std::string>::iterator begin();
-    std::set<std::string>::iterator end();
+    /// Iterate over the VOs with files
+    std::vector<Symbol>::const_iterator begin() const;
+    std::vector<Symbol>::const_iterator end() const;
 
     bool empty();
 
@@ -73,39 +77,38 @@ public:
 
 private:
 
-    boost::optional<TransferFile> getFile(FileIndex index);
-
-    boost::optional<FileIndex> getIndex(std::string vo);
-
-    boost::optional< std::pair<std::string, std::string> > getNextPair(std::string vo);
+    /// maps file indexes to file replicas
+    typedef std::map< FileIndex, std::list<TransferFile> > FileMap;
 
-    std::map< std::string, std::set<std::string> >& getMapFromCache(std::map< std::string, std::list<TransferFile> >& files, GET_MAP_OPTS opt);
-
-    // maps file indexes to file replicas
-    std::map< FileIndex, std::list<TransferFile> > fileIndexToFiles;
+    /// Files of a VO, organized by source-destination pair
+    struct VoQueue
+    {
+        std::map< SymbolPair, std::deque<FileMap::iterator> > pairs;
+        /// next pair in turn
+        std::map< SymbolPair, std::deque<FileMap::iterator> >::iterator next;
+    };
 
-    // maps VOs to file indexes
-    // file indexes are organized in map: source-destination pair is mapped to file indexes
-    std::map< std::string, std::map< std::pair<std::string, std::string>, std::list<FileIndex> > > voToFileIndexes;
+    typedef std::unordered_map< Symbol, std::set<Symbol> > SymbolRelation;
 
-    std::set<std::string> vos;
+    boost::optional<TransferFile> getFile(FileMap::iterator index);
 
-    void freeList(std::list<TransferFile>& l);
+    boost::optional<FileMap::iterator> getIndex(Symbol vo);
 
-    /// mutex that ensures thread safety
-    boost::mutex m;
+    FileMap fileIndexToFiles;
 
-    /// next pair in given VO queue
-    std::map< std::string, std::map< std::pair<std::string, std::string>, std::list<FileIndex> >::iterator > nextPairForVo;
+    // maps VOs to file indexes
+    std::unordered_map< Symbol, VoQueue > voToFileIndexes;
 
-    /// cache for the following maps
-    std::vector< std::map< std::string, std::set<std::string> > > init_cache;
+    std::vector<Symbol> vos;
 
     /// outgoing/incoming transfers/vo for a given SE
-    const std::map< std::string, std::set<std::string> > sourceToDestinations;
-    const std::map< std::string, std::set<std::string> > sourceToVos;
-    const std::map< std::string, std::set<std::string> > destinationToSources;
-    const std::map< std::string, std::set<std::string> > destinationToVos;
+    SymbolRelation sourceToDestinations;
+    SymbolRelation sourceToVos;
+    SymbolRelation destinationToSources;
+    SymbolRelation destinationToVos;
+
+    static const std::set<std::string> lookup(const SymbolRelation &relation,
+        const fts3::common::SymbolTable &values, const std::string &se);
 };
 
 } /* namespace cli */
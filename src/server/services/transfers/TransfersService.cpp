@@ -22,7 +22,6 @@
 #include "VoShares.h"
 
 #include "config/ServerConfig.h"
-#include "common/DaemonTools.h"
 #include "common/ThreadPool.h"
 
 #include "cred/DelegCred.h"
@@ -33,9 +32,12 @@
 
 #include "TransferFileHandler.h"
 #include "FileTransferExecutor.h"
+#include "UrlCopyRegistry.h"
+#include "UrlCopyWorkerPool.h"
 
 #include <msg-bus/producer.h>
 
+#include <algorithm>
 #include <ctime>
 
 using namespace fts3::common;
@@ -59,6 +61,7 @@ TransfersService::TransfersService(): BaseService("TransfersService")
 
     monitoringMessages = config::ServerConfig::instance().get<bool>("MonitoringMessaging");
     schedulingInterval = config::ServerConfig::instance().get<boost::posix_time::time_duration>("SchedulingInterval");
+    schedulingShards = std::max(1, config::ServerConfig::instance().get<int>("SchedulingShards"));
 }
 
 
@@ -103,127 +106,194 @@ void TransfersService::runService()
 }
 
 
-void TransfersService::getFiles(const std::vector<QueueId>& queues, int availableUrlCopySlots)
+void TransfersService::fetchShard(Shard &shard, SlotTable &slots)
 {
     auto db = DBSingleton::instance().getDBObjectInstance();
 
-    ThreadPool<FileTransferExecutor> execPool(execPoolSize);
-    std::map<std::string, int> slotsLeftForSource, slotsLeftForDestination;
-    for (auto i = queues.begin(); i != queues.end(); ++i) {
+    for (auto i = shard.queues.begin(); i != shard.queues.end(); ++i) {
         // To reduce queries, fill in one go limits as source and as destination
-        if (slotsLeftForDestination.count(i->destSe) == 0) {
+        if (!slots.hasStorage(i->destSe)) {
             StorageConfig seConfig = db->getStorageConfig(i->destSe);
-            slotsLeftForDestination[i->destSe] = seConfig.inboundMaxActive>0?seConfig.inboundMaxActive:60;
-            slotsLeftForSource[i->destSe] = seConfig.outboundMaxActive>0?seConfig.outboundMaxActive:60;
+            slots.addStorage(i->destSe,
+                seConfig.inboundMaxActive>0?seConfig.inboundMaxActive:60,
+                seConfig.outboundMaxActive>0?seConfig.outboundMaxActive:60);
         }
-        if (slotsLeftForSource.count(i->sourceSe) == 0) {
+        if (!slots.hasStorage(i->sourceSe)) {
             StorageConfig seConfig = db->getStorageConfig(i->sourceSe);
-            slotsLeftForDestination[i->sourceSe] = seConfig.inboundMaxActive>0?seConfig.inboundMaxActive:60;
-            slotsLeftForSource[i->sourceSe] = seConfig.outboundMaxActive>0?seConfig.outboundMaxActive:60;
+            slots.addStorage(i->sourceSe,
+                seConfig.inboundMaxActive>0?seConfig.inboundMaxActive:60,
+                seConfig.outboundMaxActive>0?seConfig.outboundMaxActive:60);
         }
         // Once it is filled, decrement
-        slotsLeftForDestination[i->destSe] -= i->activeCount;
-        slotsLeftForSource[i->sourceSe] -= i->activeCount;
+        slots.addActive(i->sourceSe, i->destSe, i->activeCount);
     }
 
-    try
-    {
-        if (queues.empty())
-            return;
-
-        // now get files to be scheduled
-        std::map<std::string, std::list<TransferFile> > voQueues;
-
-
-        time_t start = time(0);
-        db->getReadyTransfers(queues, voQueues);
-        time_t end =time(0);
-        FTS3_COMMON_LOGGER_NEWLOG(INFO) << "DBtime=\"TransfersService\" "
-                                        << "func=\"getFiles\" "
-                                        << "DBcall=\"getReadyTransfers\" " 
-                                        << "time=\"" << end - start << "\"" 
-                                        << commit;
-
-        if (voQueues.empty())
-            return;
+    db->getReadyTransfers(shard.queues, shard.voQueues);
+}
 
-        // Count of scheduled transfers for activity
-        std::map<std::string, int> scheduledByActivity;
 
-        // create transfer-file handler
-        TransferFileHandler tfh(voQueues);
+void TransfersService::planShard(Shard &shard, SlotTable &slots, ThreadPool<FileTransferExecutor> &execPool)
+{
+    // create transfer-file handler
+    TransferFileHandler tfh(shard.voQueues);
 
-        std::map<std::pair<std::string, std::string>, std::string> proxies;
+    std::map<std::pair<std::string, std::string>, std::string> proxies;
 
-        // loop until all files have been served
-        int initial_size = tfh.size();
+    // loop until all files have been served
+    shard.fetched = tfh.size();
 
-        std::set<std::string> warningPrintedSrc, warningPrintedDst;
-        while (!tfh.empty() && availableUrlCopySlots > 0)
+    while (!tfh.empty() && shard.quota > 0)
+    {
+        // iterate over all VOs
+        for (auto it_vo = tfh.begin(); it_vo != tfh.end() && shard.quota > 0; it_vo++)
         {
-            // iterate over all VOs
-            for (auto it_vo = tfh.begin(); it_vo != tfh.end() && availableUrlCopySlots > 0; it_vo++)
+            if (boost::this_thread::interruption_requested())
             {
-                if (boost::this_thread::interruption_requested())
-                {
-                    execPool.interrupt();
-                    return;
-                }
+                return;
+            }
 
-                boost::optional<TransferFile> opt_tf = tfh.get(*it_vo);
-                // if this VO has no more files to process just continue
-                if (!opt_tf)
-                    continue;
+            boost::optional<TransferFile> opt_tf = tfh.get(*it_vo);
+            // if this VO has no more files to process just continue
+            if (!opt_tf)
+                continue;
 
-                TransferFile & tf = *opt_tf;
+            TransferFile & tf = *opt_tf;
 
-                // just to be sure
-                if (tf.fileId == 0 || tf.userDn.empty() || tf.credId.empty())
-                    continue;
+            // just to be sure
+            if (tf.fileId == 0 || tf.userDn.empty() || tf.credId.empty())
+                continue;
 
-                if (!scheduledByActivity.count(tf.activity)) {
-                    scheduledByActivity[tf.activity] = 0;
-                }
+            if (!shard.scheduledByActivity.count(tf.activity)) {
+                shard.scheduledByActivity[tf.activity] = 0;
+            }
 
-                std::pair<std::string, std::string> proxy_key(tf.credId, tf.userDn);
+            std::pair<std::string, std::string> proxy_key(tf.credId, tf.userDn);
 
-                if (proxies.find(proxy_key) == proxies.end())
-                {
-                    proxies[proxy_key] = DelegCred::getProxyFile(tf.userDn, tf.credId);
-                }
+            if (proxies.find(proxy_key) == proxies.end())
+            {
+                proxies[proxy_key] = DelegCred::getProxyFile(tf.userDn, tf.credId);
+            }
 
-                if (slotsLeftForDestination[tf.destSe] <= 0) {
-                    if (warningPrintedDst.count(tf.destSe) == 0) {
+            switch (slots.acquire(tf.sourceSeId, tf.destSeId)) {
+                case SlotTable::DESTINATION_FULL:
+                    if (shard.warningPrintedDst.count(tf.destSe) == 0) {
                         FTS3_COMMON_LOGGER_NEWLOG(WARNING)
                             << "Reached limitation for destination " << tf.destSe
                             << commit;
-                        warningPrintedDst.insert(tf.destSe);
+                        shard.warningPrintedDst.insert(tf.destSe);
                     }
-                }
-                else if (slotsLeftForSource[tf.sourceSe] <= 0) {
-                    if (warningPrintedSrc.count(tf.sourceSe) == 0) {
+                    break;
+                case SlotTable::SOURCE_FULL:
+                    if (shard.warningPrintedSrc.count(tf.sourceSe) == 0) {
                         FTS3_COMMON_LOGGER_NEWLOG(WARNING)
                             << "Reached limitation for source " << tf.sourceSe
                             << commit;
-                        warningPrintedSrc.insert(tf.sourceSe);
+                        shard.warningPrintedSrc.insert(tf.sourceSe);
                     }
-                } else {
+                    break;
+                case SlotTable::URLCOPY_FULL:
+                    // Another shard took the last one
+                    shard.leftovers = true;
+                    return;
+                case SlotTable::ACQUIRED: {
+                    --shard.quota;
                     // Increment scheduled transfers by activity
-                    scheduledByActivity[tf.activity]++;
+                    shard.scheduledByActivity[tf.activity]++;
 
                     FileTransferExecutor *exec = new FileTransferExecutor(tf,
                         monitoringMessages, infosys, ftsHostName,
-                        proxies[proxy_key], logDir, msgDir);
+                        proxies[proxy_key], logDir, msgDir, linkConfigCache);
 
                     execPool.start(exec);
-                    --availableUrlCopySlots;
-                    --slotsLeftForDestination[tf.destSe];
-                    --slotsLeftForSource[tf.sourceSe];
+                    break;
                 }
             }
         }
+    }
+
+    shard.leftovers = !tfh.empty();
+}
+
+
+void TransfersService::getFiles(const std::vector<QueueId>& queues, int availableUrlCopySlots)
+{
+    auto db = DBSingleton::instance().getDBObjectInstance();
+
+    ThreadPool<FileTransferExecutor> execPool(execPoolSize);
+
+    try
+    {
+        if (queues.empty())
+            return;
+
+        // Storage limits and url copy slots are shared by all the shards
+        SlotTable slots(availableUrlCopySlots);
+
+        std::vector<Shard> shards;
+        std::vector<std::vector<QueueId>> partitions = partitionQueues(queues, schedulingShards);
+        for (auto i = partitions.begin(); i != partitions.end(); ++i) {
+            shards.emplace_back(*i);
+        }
+
+        // now get files to be scheduled
+        // All the shards must have discounted their active transfers before any of them starts planning
+        time_t start = time(0);
+        runShards(shards, [this, &slots](Shard &shard) {
+            fetchShard(shard, slots);
+        });
+        time_t end =time(0);
+        FTS3_COMMON_LOGGER_NEWLOG(INFO) << "DBtime=\"TransfersService\" "
+                                        << "func=\"getFiles\" "
+                                        << "DBcall=\"getReadyTransfers\" " 
+                                        << "time=\"" << end - start << "\"" 
+                                        << commit;
+
+        bool empty = true;
+        std::vector<int> ready;
+        for (auto i = shards.begin(); i != shards.end(); ++i) {
+            empty = empty && i->voQueues.empty();
+            int count = 0;
+            for (auto j = i->voQueues.begin(); j != i->voQueues.end(); ++j) {
+                count += j->second.size();
+            }
+            ready.push_back(count);
+        }
+        if (empty)
+            return;
+
+        // VOs are served round-robin within each shard, so the url copy slots
+        // are split beforehand for the shards not to race for them
+        std::vector<int> quotas = splitSlots(slots.getUrlCopySlots(), ready);
+        for (size_t i = 0; i < shards.size(); ++i) {
+            shards[i].quota = quotas[i];
+        }
+
+        // Configuration shared by all the executors of this cycle
+        linkConfigCache.newCycle(db);
+
+        runShards(shards, [this, &slots, &execPool](Shard &shard) {
+            planShard(shard, slots, execPool);
+        });
+
+        if (boost::this_thread::interruption_requested())
+        {
+            execPool.interrupt();
+            return;
+        }
+
+        // Count of scheduled transfers for activity
+        std::map<std::string, int> scheduledByActivity;
+        int initial_size = 0;
+        bool leftovers = false;
+        for (auto i = shards.begin(); i != shards.end(); ++i) {
+            initial_size += i->fetched;
+            leftovers = leftovers || i->leftovers;
+            for (auto j = i->scheduledByActivity.begin(); j != i->scheduledByActivity.end(); ++j) {
+                scheduledByActivity[j->first] += j->second;
+            }
+        }
 
-        if (availableUrlCopySlots <= 0 && !tfh.empty()) {
+        if (slots.getUrlCopySlots() <= 0 && leftovers) {
             FTS3_COMMON_LOGGER_NEWLOG(WARNING)
                 << "Reached limitation of MaxUrlCopyProcesses"
                 << commit;
@@ -303,7 +373,8 @@ void TransfersService::executeUrlcopy()
 
     // Bail out as soon as possible if there are too many url-copy processes
     int maxUrlCopy = config::ServerConfig::instance().get<int>("MaxUrlCopyProcesses");
-    int urlCopyCount = countProcessesWithName("fts_url_copy");
+    // Idle workers are not running any transfer
+    int urlCopyCount = UrlCopyRegistry::instance().count() - UrlCopyWorkerPool::instance().getIdleCount();
     int availableUrlCopySlots = maxUrlCopy - urlCopyCount;
 
     if (availableUrlCopySlots <= 0) {
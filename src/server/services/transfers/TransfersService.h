@@ -22,16 +22,25 @@
 #ifndef PROCESSSERVICE_H_
 #define PROCESSSERVICE_H_
 
+#include <list>
+#include <map>
+#include <set>
 #include <string>
 #include <vector>
 
+#include "common/ThreadPool.h"
 #include "db/generic/QueueId.h"
+#include "db/generic/TransferFile.h"
 #include "../BaseService.h"
+#include "LinkConfigCache.h"
+#include "SchedulingShards.h"
 
 
 namespace fts3 {
 namespace server {
 
+class FileTransferExecutor;
+
 
 class TransfersService: public BaseService
 {
@@ -53,6 +62,27 @@ protected:
     std::string logDir;
     std::string msgDir;
     boost::posix_time::time_duration schedulingInterval;
+    unsigned schedulingShards;
+    LinkConfigCache linkConfigCache;
+
+    /// Queues that are fetched and planned together
+    struct Shard {
+        std::vector<QueueId> queues;
+        std::map<std::string, std::list<TransferFile> > voQueues;
+        std::map<std::string, int> scheduledByActivity;
+        std::set<std::string> warningPrintedSrc, warningPrintedDst;
+        int fetched;
+        bool leftovers;
+        /// Url copy slots this shard can take
+        int quota;
+
+        Shard(const std::vector<QueueId> &queues): queues(queues), fetched(0), leftovers(false), quota(0) {}
+    };
+
+    /// Register the storage limits of the shard queues, and get their transfers
+    void fetchShard(Shard &shard, SlotTable &slots);
+    /// Start the transfers of the shard while there are slots left, within its quota
+    void planShard(Shard &shard, SlotTable &slots, fts3::common::ThreadPool<FileTransferExecutor> &execPool);
 
     void getFiles(const std::vector<QueueId>& queues, int availableUrlCopySlots);
     void executeUrlcopy();
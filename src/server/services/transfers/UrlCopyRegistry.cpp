@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "UrlCopyRegistry.h"
+
+#include <cerrno>
+#include <signal.h>
+
+#include "common/DaemonTools.h"
+#include "common/Logger.h"
+#include "UrlCopyCmd.h"
+
+using namespace fts3::common;
+
+
+namespace fts3 {
+namespace server {
+
+
+UrlCopyRegistry::UrlCopyRegistry(): lastSweep(0), lastReconcile(0)
+{
+    reconcile();
+}
+
+
+UrlCopyRegistry::~UrlCopyRegistry()
+{
+}
+
+
+void UrlCopyRegistry::add(pid_t pid)
+{
+    if (pid <= 0) {
+        return;
+    }
+    boost::lock_guard<boost::mutex> lock(mutex);
+    processes.insert(pid);
+}
+
+
+int UrlCopyRegistry::count()
+{
+    boost::lock_guard<boost::mutex> lock(mutex);
+    return processes.size();
+}
+
+
+void UrlCopyRegistry::sweep()
+{
+    std::set<pid_t> snapshot;
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        snapshot = processes;
+        lastSweep = time(NULL);
+    }
+
+    std::set<pid_t> gone;
+    for (auto pid = snapshot.begin(); pid != snapshot.end(); ++pid) {
+        if (kill(*pid, 0) < 0 && errno == ESRCH) {
+            gone.insert(*pid);
+        }
+    }
+
+    if (!gone.empty()) {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        for (auto pid = gone.begin(); pid != gone.end(); ++pid) {
+            processes.erase(*pid);
+        }
+    }
+}
+
+
+void UrlCopyRegistry::reconcile()
+{
+    std::set<pid_t> registered;
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        registered = processes;
+    }
+
+    std::set<pid_t> running;
+    try {
+        running = findProcessesWithName(UrlCopyCmd::Program);
+    }
+    catch (const std::exception &e) {
+        FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Could not reconcile the url copy processes: " << e.what() << commit;
+        boost::lock_guard<boost::mutex> lock(mutex);
+        lastReconcile = time(NULL);
+        return;
+    }
+
+    boost::lock_guard<boost::mutex> lock(mutex);
+
+    // Keep the processes registered while /proc was being scanned
+    for (auto pid = processes.begin(); pid != processes.end(); ++pid) {
+        if (registered.count(*pid) == 0) {
+            running.insert(*pid);
+        }
+    }
+
+    if (running != processes) {
+        FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Url copy registry had " << processes.size()
+            << " processes, " << running.size() << " are running" << commit;
+    }
+
+    processes.swap(running);
+    lastReconcile = time(NULL);
+}
+
+
+void UrlCopyRegistry::maintain()
+{
+    time_t now = time(NULL);
+    time_t sinceSweep, sinceReconcile;
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        sinceSweep = now - lastSweep;
+        sinceReconcile = now - lastReconcile;
+    }
+
+    if (sinceReconcile >= RECONCILE_INTERVAL) {
+        reconcile();
+    }
+    else if (sinceSweep >= SWEEP_INTERVAL) {
+        sweep();
+    }
+}
+
+} // end namespace server
+} // end namespace fts3
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef URLCOPYREGISTRY_H
+#define URLCOPYREGISTRY_H
+
+#include <ctime>
+#include <set>
+#include <sys/types.h>
+#include <boost/thread.hpp>
+
+#include "common/Singleton.h"
+
+
+namespace fts3 {
+namespace server {
+
+/// Url copy processes running on this host.
+/// The server registers the processes it spawns, so the scheduler can get how many there are
+/// without scanning /proc. Since children are reaped automatically (SIGCHLD is ignored), exited
+/// processes are noticed by a periodic liveness check, and the list is rebuilt from /proc once
+/// in a while, which also adopts the processes left behind by a previous instance of the server.
+class UrlCopyRegistry: public fts3::common::Singleton<UrlCopyRegistry>
+{
+    friend class fts3::common::Singleton<UrlCopyRegistry>;
+
+public:
+    /// Seconds between checks of the registered processes
+    static const time_t SWEEP_INTERVAL = 2;
+    /// Seconds between full scans of /proc
+    static const time_t RECONCILE_INTERVAL = 300;
+
+    virtual ~UrlCopyRegistry();
+
+    /// Register a new url copy process
+    void add(pid_t pid);
+
+    /// Number of url copy processes running
+    int count();
+
+    /// Forget the processes that are gone
+    void sweep();
+
+    /// Rebuild the list from /proc
+    void reconcile();
+
+    /// Sweep and reconcile when their intervals have passed.
+    /// Meant to be called regularly from a service loop.
+    void maintain();
+
+private:
+    boost::mutex mutex;
+    std::set<pid_t> processes;
+    time_t lastSweep;
+    time_t lastReconcile;
+
+    UrlCopyRegistry();
+};
+
+} // end namespace server
+} // end namespace fts3
+
+#endif // URLCOPYREGISTRY_H
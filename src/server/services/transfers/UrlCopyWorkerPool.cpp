@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "UrlCopyWorkerPool.h"
+
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "common/Logger.h"
+#include "ExecuteProcess.h"
+#include "UrlCopyCmd.h"
+#include "UrlCopyRegistry.h"
+
+using namespace fts3::common;
+
+
+namespace fts3 {
+namespace server {
+
+
+const char UrlCopyWorkerPool::CANCEL_MESSAGE[] = "CANCEL";
+
+
+/// True once pid has exited. SIGCHLD is ignored, so the kernel reaps it, and waitpid
+/// fails with ECHILD from then on, but reap it in case it is not.
+static bool hasExited(int pid)
+{
+    pid_t ret = waitpid(pid, NULL, WNOHANG);
+    return ret == pid || (ret < 0 && errno == ECHILD);
+}
+
+
+UrlCopyWorkerPool::UrlCopyWorkerPool(): lastGeneration(0)
+{
+}
+
+
+UrlCopyWorkerPool::~UrlCopyWorkerPool()
+{
+    for (auto i = workers.begin(); i != workers.end(); ++i) {
+        release(*i);
+    }
+}
+
+
+bool UrlCopyWorkerPool::spawn(Worker &worker)
+{
+    worker.started = time(NULL);
+    worker.generation = ++lastGeneration;
+    worker.busy = false;
+    worker.fileId = 0;
+
+    int sockets[2];
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sockets) < 0) {
+        FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Could not create the socket for an url copy worker: "
+            << strerror(errno) << commit;
+        return false;
+    }
+
+    ExecuteProcess process(UrlCopyCmd::Program, "--worker-fd " + std::to_string(ExecuteProcess::INHERITED_FD));
+    process.setInheritedFd(sockets[1]);
+
+    std::string forkMessage;
+    int ret = process.executeProcessShell(forkMessage);
+    close(sockets[1]);
+
+    if (ret < 0) {
+        close(sockets[0]);
+        FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Could not start an url copy worker: " << forkMessage << commit;
+        return false;
+    }
+
+    worker.fd = sockets[0];
+    worker.pid = process.getPid();
+    UrlCopyRegistry::instance().add(worker.pid);
+
+    FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Started url copy worker " << worker.pid << commit;
+    return true;
+}
+
+
+void UrlCopyWorkerPool::release(Worker &worker)
+{
+    if (worker.fd < 0) {
+        return;
+    }
+
+    // An idle worker exits as soon as it sees the socket closed, a busy one cancels its transfer
+    close(worker.fd);
+    worker.fd = -1;
+    worker.busy = false;
+    worker.fileId = 0;
+
+    // Do not signal a pid that may have been reused already
+    if (hasExited(worker.pid)) {
+        return;
+    }
+    kill(worker.pid, SIGTERM);
+
+    long waited = 0;
+    while (!hasExited(worker.pid)) {
+        if (waited >= TERMINATE_GRACE) {
+            FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Url copy worker " << worker.pid
+                << " did not exit after " << TERMINATE_GRACE << " ms, killing it" << commit;
+            kill(worker.pid, SIGKILL);
+            while (!hasExited(worker.pid)) {
+                usleep(10000);
+            }
+            break;
+        }
+        usleep(100000);
+        waited += 100;
+    }
+}
+
+
+UrlCopyWorkerPool::Worker *UrlCopyWorkerPool::findByPid(int pid)
+{
+    for (auto i = workers.begin(); i != workers.end(); ++i) {
+        if (i->pid == pid) {
+            return &(*i);
+        }
+    }
+    return NULL;
+}
+
+
+void UrlCopyWorkerPool::resize(unsigned size)
+{
+    boost::lock_guard<boost::mutex> lock(mutex);
+
+    unsigned active = 0;
+    for (auto i = workers.begin(); i != workers.end(); ++i) {
+        if (!i->retiring) {
+            ++active;
+        }
+    }
+
+    if (size == active) {
+        return;
+    }
+
+    FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Resizing the url copy worker pool from "
+        << active << " to " << size << commit;
+
+    // Stop the idle or dead workers first
+    for (auto i = workers.begin(); i != workers.end() && active > size;) {
+        if (!i->retiring && !i->busy) {
+            release(*i);
+            i = workers.erase(i);
+            --active;
+        }
+        else {
+            ++i;
+        }
+    }
+    // Then let busy workers finish their transfer, supervise stops them afterwards
+    for (auto i = workers.begin(); i != workers.end() && active > size; ++i) {
+        if (!i->retiring) {
+            i->retiring = true;
+            --active;
+        }
+    }
+
+    // Keep the retiring workers that are still alive before starting new ones
+    for (auto i = workers.begin(); i != workers.end() && active < size; ++i) {
+        if (i->retiring && i->fd >= 0) {
+            i->retiring = false;
+            ++active;
+        }
+    }
+    while (active < size) {
+        workers.push_back(Worker());
+        spawn(workers.back());
+        ++active;
+    }
+}
+
+
+int UrlCopyWorkerPool::dispatch(const std::string &params, uint64_t fileId)
+{
+    boost::lock_guard<boost::mutex> lock(mutex);
+
+    for (auto i = workers.begin(); i != workers.end(); ++i) {
+        if (i->fd < 0 || i->busy || i->retiring) {
+            continue;
+        }
+
+        if (send(i->fd, params.data(), params.size(), MSG_NOSIGNAL | MSG_DONTWAIT) < 0) {
+            // Too big for the socket, but the worker is fine
+            if (errno == EMSGSIZE) {
+                return -1;
+            }
+            FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Could not hand over the transfer to the url copy worker "
+                << i->pid << ": " << strerror(errno) << commit;
+            release(*i);
+            continue;
+        }
+
+        i->busy = true;
+        i->fileId = fileId;
+        return i->pid;
+    }
+
+    return -1;
+}
+
+
+bool UrlCopyWorkerPool::cancelTransfer(int pid, uint64_t fileId)
+{
+    boost::lock_guard<boost::mutex> lock(mutex);
+
+    Worker *worker = findByPid(pid);
+    if (!worker) {
+        return false;
+    }
+    if (worker->fd < 0 || !worker->busy || worker->fileId != fileId) {
+        FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Url copy worker " << pid << " is not running "
+            << fileId << " anymore, nothing to cancel" << commit;
+        return true;
+    }
+
+    FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Asking url copy worker " << pid << " to cancel " << fileId << commit;
+
+    const std::string message = std::string(CANCEL_MESSAGE) + " " + std::to_string(fileId);
+    if (send(worker->fd, message.data(), message.size(), MSG_NOSIGNAL | MSG_DONTWAIT) < 0) {
+        FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Could not send the cancel request to the url copy worker "
+            << pid << ": " << strerror(errno) << commit;
+        release(*worker);
+    }
+    return true;
+}
+
+
+bool UrlCopyWorkerPool::killTransfer(int pid, uint64_t fileId)
+{
+    boost::lock_guard<boost::mutex> lock(mutex);
+
+    Worker *worker = findByPid(pid);
+    if (!worker) {
+        return false;
+    }
+    if (worker->fd < 0 || !worker->busy || worker->fileId != fileId) {
+        FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Url copy worker " << pid << " is not running "
+            << fileId << " anymore, not killing it" << commit;
+        return true;
+    }
+
+    FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Stopping url copy worker " << pid
+        << " running " << fileId << ", it will be restarted" << commit;
+    release(*worker);
+    return true;
+}
+
+
+void UrlCopyWorkerPool::supervise(const boost::posix_time::time_duration &timeout)
+{
+    std::vector<pollfd> fds;
+    std::vector<uint64_t> generations;
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+
+        // Restart dead workers, but not in a tight loop if they die right away
+        time_t now = time(NULL);
+        for (auto i = workers.begin(); i != workers.end();) {
+            if (i->fd >= 0) {
+                ++i;
+            }
+            else if (i->retiring) {
+                i = workers.erase(i);
+            }
+            else {
+                if (now - i->started >= RESTART_DELAY) {
+                    spawn(*i);
+                }
+                ++i;
+            }
+        }
+
+        for (auto i = workers.begin(); i != workers.end(); ++i) {
+            if (i->fd >= 0) {
+                pollfd pfd = {i->fd, POLLIN, 0};
+                fds.push_back(pfd);
+                generations.push_back(i->generation);
+            }
+        }
+    }
+
+    if (fds.empty()) {
+        boost::this_thread::sleep(timeout);
+        return;
+    }
+
+    if (poll(fds.data(), fds.size(), timeout.total_milliseconds()) <= 0) {
+        return;
+    }
+
+    boost::lock_guard<boost::mutex> lock(mutex);
+
+    for (size_t index = 0; index < fds.size(); ++index) {
+        if (!fds[index].revents) {
+            continue;
+        }
+
+        // The worker may have been released, and its fd reused, in the meantime
+        auto worker = workers.begin();
+        while (worker != workers.end() && worker->generation != generations[index]) {
+            ++worker;
+        }
+        if (worker == workers.end() || worker->fd < 0) {
+            continue;
+        }
+
+        char buffer[16];
+        ssize_t received = recv(worker->fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (received > 0) {
+            worker->busy = false;
+            worker->fileId = 0;
+            if (worker->retiring) {
+                release(*worker);
+            }
+        }
+        else if (received == 0 || (errno != EAGAIN && errno != EINTR)) {
+            FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Url copy worker " << worker->pid
+                << " exited, it will be restarted" << commit;
+            release(*worker);
+        }
+    }
+}
+
+
+unsigned UrlCopyWorkerPool::getIdleCount()
+{
+    boost::lock_guard<boost::mutex> lock(mutex);
+
+    unsigned count = 0;
+    for (auto i = workers.begin(); i != workers.end(); ++i) {
+        if (i->fd >= 0 && !i->busy && !i->retiring) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+} // end namespace server
+} // end namespace fts3
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef URLCOPYWORKERPOOL_H
+#define URLCOPYWORKERPOOL_H
+
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/thread.hpp>
+
+#include "common/Singleton.h"
+
+
+namespace fts3 {
+namespace server {
+
+/// Pool of long lived fts_url_copy processes, started with --worker-fd.
+/// Each one is connected to the server by a unix socket, and receives the command line
+/// of one transfer at a time, saving the fork, exec, and gfal2 initialization per transfer.
+/// Transfers that find no idle worker are forked as usual.
+///
+/// The pid stored for a transfer is the one of the worker, which outlives it, so transfers
+/// must be canceled or killed through cancelTransfer and killTransfer, and never signaled directly.
+class UrlCopyWorkerPool: public fts3::common::Singleton<UrlCopyWorkerPool>
+{
+    friend class fts3::common::Singleton<UrlCopyWorkerPool>;
+
+public:
+    /// Do not restart a worker more often than this, in seconds
+    static const time_t RESTART_DELAY = 5;
+    /// Time given to a released worker to exit before it is killed, in milliseconds
+    static const long TERMINATE_GRACE = 2000;
+    /// Sent to a worker, followed by a space and the file id, to cancel its transfer
+    static const char CANCEL_MESSAGE[];
+
+    virtual ~UrlCopyWorkerPool();
+
+    /// Start or stop workers until there are size of them. 0 disables the pool.
+    /// Idle workers are stopped first. Busy workers finish their current transfer before exiting.
+    void resize(unsigned size);
+
+    /// Hand over a transfer to an idle worker
+    /// @param params   Command line parameters for fts_url_copy, as generated by UrlCopyCmd
+    /// @param fileId   Transfer being handed over
+    /// @return         The pid of the worker, or -1 if none is idle, and the transfer must be forked
+    int dispatch(const std::string &params, uint64_t fileId);
+
+    /// Ask the worker pid to cancel the transfer fileId, if it is still running it
+    /// @return false if pid is not a worker, and must be signaled as a regular process
+    bool cancelTransfer(int pid, uint64_t fileId);
+
+    /// Stop the worker pid if it is still running the transfer fileId. It will be restarted.
+    /// @return false if pid is not a worker, and must be signaled as a regular process
+    bool killTransfer(int pid, uint64_t fileId);
+
+    /// Wait up to timeout for workers to finish their transfer or die, and restart the dead ones
+    void supervise(const boost::posix_time::time_duration &timeout);
+
+    /// Number of workers waiting for a transfer
+    unsigned getIdleCount();
+
+private:
+    struct Worker {
+        int fd;
+        int pid;
+        /// Unique per spawned process, so a reused fd or pid is never mistaken for this one
+        uint64_t generation;
+        /// Transfer being run, if busy
+        uint64_t fileId;
+        bool busy;
+        /// Removed by a resize, exits once the current transfer is done
+        bool retiring;
+        time_t started;
+
+        Worker(): fd(-1), pid(0), generation(0), fileId(0), busy(false), retiring(false), started(0) {}
+    };
+
+    boost::mutex mutex;
+    std::vector<Worker> workers;
+    uint64_t lastGeneration;
+
+    UrlCopyWorkerPool();
+
+    /// Start the process for worker
+    bool spawn(Worker &worker);
+
+    /// Close the socket of worker, and terminate and reap its process
+    void release(Worker &worker);
+
+    /// Worker with the given pid, or NULL
+    Worker *findByPid(int pid);
+};
+
+} // end namespace server
+} // end namespace fts3
+
+#endif // URLCOPYWORKERPOOL_H
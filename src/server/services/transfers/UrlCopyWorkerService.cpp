@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "UrlCopyWorkerService.h"
+#include "UrlCopyWorkerPool.h"
+#include "config/ServerConfig.h"
+
+using namespace fts3::common;
+
+
+namespace fts3 {
+namespace server {
+
+
+UrlCopyWorkerService::UrlCopyWorkerService(): BaseService("UrlCopyWorkerService")
+{
+}
+
+
+void UrlCopyWorkerService::runService()
+{
+    UrlCopyWorkerPool &pool = UrlCopyWorkerPool::instance();
+
+    try {
+        while (!boost::this_thread::interruption_requested()) {
+            int size = config::ServerConfig::instance().get<int>("UrlCopyWorkers");
+            pool.resize(size > 0 ? size : 0);
+            pool.supervise(boost::posix_time::seconds(1));
+        }
+    }
+    catch (const boost::thread_interrupted&) {
+        // Let the workers go away once they are done
+        pool.resize(0);
+        throw;
+    }
+    pool.resize(0);
+}
+
+} // end namespace server
+} // end namespace fts3
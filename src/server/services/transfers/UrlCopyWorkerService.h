@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef URLCOPYWORKERSERVICE_H
+#define URLCOPYWORKERSERVICE_H
+
+#include "../BaseService.h"
+
+
+namespace fts3 {
+namespace server {
+
+/// Keeps the url copy worker pool at the configured size (UrlCopyWorkers),
+/// tracks which workers are idle, and restarts those that die
+class UrlCopyWorkerService: public BaseService {
+public:
+    /// Constructor
+    UrlCopyWorkerService();
+
+    /// Service code
+    void runService();
+};
+
+} // end namespace server
+} // end namespace fts3
+
+#endif // URLCOPYWORKERSERVICE_H
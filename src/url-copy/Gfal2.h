@@ -17,8 +17,11 @@
 #ifndef GFAL2_CPP_H
 #define GFAL2_CPP_H
 
+#include <map>
+#include <string>
 #include <vector>
 
+#include <boost/optional.hpp>
 #include <gfal_api.h>
 #include "common/Uri.h"
 
@@ -276,14 +279,44 @@ public:
 
 class Gfal2 {
 private:
+    typedef std::pair<std::string, std::string> OptionKey;
+
     gfal2_context_t context;
 
+    // Per transfer state, tracked between beginTransfer and resetTransfer
+    bool tracking;
+    bool restorable;
+    bool credentialsSet;
+    GLogLevelFlags logLevel;
+    /// Value of the options before the transfer overrode them. None if they were not set.
+    std::map<OptionKey, boost::optional<std::string>> overridden;
+
+    /// Keep the value of an option the transfer is about to override
+    void remember(const std::string &group, const std::string &key) {
+        OptionKey option(group, key);
+        if (!tracking || overridden.count(option)) {
+            return;
+        }
+
+        GError *error = NULL;
+        char *value = gfal2_get_opt_string(context, group.c_str(), key.c_str(), &error);
+        if (value) {
+            overridden[option] = std::string(value);
+            g_free(value);
+        }
+        else {
+            overridden[option] = boost::none;
+            g_clear_error(&error);
+        }
+    }
+
     /// Configure bearer token.
     void bearerInit(Gfal2TransferParams &params,
                     const std::string &source, const std::string &destination)
     {
         GError *error = NULL;
         if (!source.empty() && !params.src_token.empty()) {
+            credentialsSet = true;
             gfal2_cred_t *token_cred = gfal2_cred_new("BEARER", params.src_token.c_str());
             //set the bearer associated to the source URL
             if (gfal2_cred_set(context, source.c_str(), token_cred, &error) < 0) {
@@ -291,6 +324,7 @@ private:
             }
         }
         if (!destination.empty() && !params.dst_token.empty()) {
+            credentialsSet = true;
             gfal2_cred_t *token_cred = gfal2_cred_new("BEARER", params.dst_token.c_str());
             //set the bearer associated to the host 
             std::string destHost = Uri::parse(destination).host;
@@ -303,7 +337,7 @@ private:
 public:
 
     /// Constructor
-    Gfal2() {
+    Gfal2(): tracking(false), restorable(true), credentialsSet(false), logLevel(gfal2_log_get_level()) {
         GError *error = NULL;
         context = gfal2_context_new(&error);
         if (context == NULL ){
@@ -320,8 +354,72 @@ public:
     Gfal2(const Gfal2&) = delete;
     Gfal2& operator = (const Gfal2&) = delete;
 
+    /// Start tracking what the next transfer configures (options, configuration files,
+    /// credentials, client info and log level), so resetTransfer can undo it
+    void beginTransfer() {
+        tracking = true;
+        restorable = true;
+        credentialsSet = false;
+        logLevel = gfal2_log_get_level();
+        overridden.clear();
+    }
+
+    /// Undo what was configured since beginTransfer, so the context can be reused by another transfer
+    /// @return false if something could not be undone, and the context must not be reused
+    bool resetTransfer() {
+        bool clean = tracking && restorable;
+        GError *error = NULL;
+
+        for (auto i = overridden.begin(); i != overridden.end(); ++i) {
+            const char *group = i->first.first.c_str();
+            const char *key = i->first.second.c_str();
+            bool restored = i->second ?
+                gfal2_set_opt_string(context, group, key, i->second->c_str(), &error) == 0 :
+                gfal2_remove_opt(context, group, key, &error);
+            if (!restored) {
+                clean = false;
+                g_clear_error(&error);
+            }
+        }
+        overridden.clear();
+
+        if (credentialsSet && gfal2_cred_clean(context, &error) < 0) {
+            clean = false;
+            g_clear_error(&error);
+        }
+        if (gfal2_clear_client_info(context, &error) < 0) {
+            clean = false;
+            g_clear_error(&error);
+        }
+        gfal2_log_set_level(logLevel);
+
+        tracking = false;
+        credentialsSet = false;
+        return clean;
+    }
+
     /// Load configuration from a file
     void loadConfigFile(const std::string &path) {
+        // Remember what the file is going to override
+        if (tracking) {
+            GKeyFile *file = g_key_file_new();
+            if (g_key_file_load_from_file(file, path.c_str(), G_KEY_FILE_NONE, NULL)) {
+                gchar **groups = g_key_file_get_groups(file, NULL);
+                for (gchar **group = groups; *group != NULL; ++group) {
+                    gchar **keys = g_key_file_get_keys(file, *group, NULL, NULL);
+                    for (gchar **key = keys; keys != NULL && *key != NULL; ++key) {
+                        remember(*group, *key);
+                    }
+                    g_strfreev(keys);
+                }
+                g_strfreev(groups);
+            }
+            else {
+                restorable = false;
+            }
+            g_key_file_free(file);
+        }
+
         GError *error = NULL;
         if (gfal2_load_opts_from_file(context, path.c_str(), &error) < 0) {
             throw Gfal2Exception(error);
@@ -330,6 +428,7 @@ public:
 
     /// Set a boolean config value
     void set(const std::string &group, const std::string &key, bool value) {
+        remember(group, key);
         GError *error = NULL;
         if (gfal2_set_opt_boolean(context, group.c_str(), key.c_str(), value, &error) < 0) {
             throw Gfal2Exception(error);
@@ -338,6 +437,7 @@ public:
 
     /// Set a string config value
     void set(const std::string &group, const std::string &key, const std::string &value) {
+        remember(group, key);
         GError *error = NULL;
         if (gfal2_set_opt_string(context, group.c_str(), key.c_str(), value.c_str(), &error) < 0) {
             throw Gfal2Exception(error);
@@ -422,6 +522,16 @@ public:
         return buffer;
     }
 
+    /// Get a client info value, or an empty string if not set
+    std::string getClientInfo(const std::string &key) {
+        GError *error = NULL;
+        const char *value = NULL;
+        if (gfal2_get_client_info_value(context, key.c_str(), &value, &error) < 0) {
+            g_clear_error(&error);
+        }
+        return value ? value : "";
+    }
+
     /// Get a string config value
     std::string get(const std::string &group, const std::string &key) {
         std::string value = "N/A";
@@ -134,8 +134,8 @@ void LegacyReporter::sendTransferCompleted(const Transfer &transfer, Gfal2Transf
     status.set_timestamp(millisecondsSinceEpoch());
     status.set_job_id(transfer.jobId);
     status.set_file_id(transfer.fileId);
-    status.set_source_se(Uri::parse(transfer.source.fullUri).getSeName());
-    status.set_dest_se(Uri::parse(transfer.destination.fullUri).getSeName());
+    status.set_source_se(transfer.source.getSeName());
+    status.set_dest_se(transfer.destination.getSeName());
     status.set_process_id(getpid());
     status.set_filesize(transfer.fileSize);
     status.set_time_in_secs(transfer.getTransferDurationInSeconds());
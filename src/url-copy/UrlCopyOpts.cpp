@@ -93,6 +93,7 @@ const option UrlCopyOpts::long_options[] =
     {"help",              no_argument,       0, 0},
     {"debug",             required_argument, 0, 1},
     {"stderr",            no_argument,       0, 2},
+    {"worker-fd",         required_argument, 0, 3},
     {0, 0, 0, 0}
 };
 
@@ -181,7 +182,7 @@ UrlCopyOpts::UrlCopyOpts():
     timeout(0), enableUdt(false), enableIpv6(boost::indeterminate), addSecPerMb(0), noStreaming(false),
     evict(false), enableMonitoring(false), active(0), pingInterval(60), retry(0), retryMax(0),
     logDir("/var/log/fts3"), msgDir("/var/lib/fts3"),
-    debugLevel(0), logToStderr(false)
+    debugLevel(0), logToStderr(false), workerFd(-1)
 {
 }
 
@@ -221,6 +222,9 @@ void UrlCopyOpts::parse(int argc, char * const argv[])
                 case 2:
                     logToStderr = true;
                     break;
+                case 3:
+                    workerFd = boost::lexical_cast<int>(optarg);
+                    break;
 
                 case 100:
                     referenceTransfer.jobId = optarg;
@@ -409,6 +413,11 @@ void UrlCopyOpts::parse(int argc, char * const argv[])
         exit(-1);
     }
 
+    // Workers get their transfers later
+    if (workerFd >= 0) {
+        return;
+    }
+
     if (bulkFile.empty() &&
         (!referenceTransfer.source.fullUri.empty() && !referenceTransfer.destination.fullUri.empty())) {
         transfers.push_back(referenceTransfer);
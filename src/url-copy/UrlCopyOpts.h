@@ -85,6 +85,9 @@ public:
     unsigned debugLevel;
     bool     logToStderr;
 
+    // Worker mode: transfers are received over this socket
+    int      workerFd;
+
     Transfer::TransferList transfers;
 
 private:
@@ -100,7 +100,15 @@ static DestFile createDestFileReport(const Transfer &transfer, Gfal2 &gfal2, Gfa
 
 
 UrlCopyProcess::UrlCopyProcess(const UrlCopyOpts &opts, Reporter &reporter):
-    opts(opts), reporter(reporter), canceled(false), timeoutExpired(false)
+    opts(opts), reporter(reporter), ownGfal2(new Gfal2), gfal2(*ownGfal2), canceled(false), timeoutExpired(false)
+{
+    todoTransfers = opts.transfers;
+    setupGlobalGfal2Config(opts, gfal2);
+}
+
+
+UrlCopyProcess::UrlCopyProcess(const UrlCopyOpts &opts, Reporter &reporter, Gfal2 &gfal2):
+    opts(opts), reporter(reporter), gfal2(gfal2), canceled(false), timeoutExpired(false)
 {
     todoTransfers = opts.transfers;
     setupGlobalGfal2Config(opts, gfal2);
@@ -548,6 +556,12 @@ void UrlCopyProcess::cancel(void)
 }
 
 
+bool UrlCopyProcess::isCanceled(void) const
+{
+    return canceled;
+}
+
+
 void UrlCopyProcess::timeout(void)
 {
     timeoutExpired = true;
@@ -17,6 +17,7 @@
 #ifndef URLCOPYPROCESS_H
 #define URLCOPYPROCESS_H
 
+#include <memory>
 #include <boost/thread.hpp>
 #include <gfal_api.h>
 
@@ -42,7 +43,8 @@ private:
 
     Reporter &reporter;
 
-    Gfal2 gfal2;
+    std::unique_ptr<Gfal2> ownGfal2;
+    Gfal2 &gfal2;
     bool canceled;
     bool timeoutExpired;
 
@@ -57,6 +59,10 @@ public:
     /// Constructor. Initialize all internals from the command line options.
     UrlCopyProcess(const UrlCopyOpts &opts, Reporter &reporter);
 
+    /// Constructor. Use an already initialized gfal2 context instead of creating a new one.
+    /// The global configuration is applied again, and the context flagged as shareable afterwards.
+    UrlCopyProcess(const UrlCopyOpts &opts, Reporter &reporter, Gfal2 &gfal2);
+
     /// Run the UrlCopy process
     void run(void);
 
@@ -70,6 +76,9 @@ public:
 
     /// Trigger a cancel, mark running transfer as expired.
     void timeout(void);
+
+    /// True if cancel has been called
+    bool isCanceled(void) const;
 };
 
 
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "UrlCopyWorker.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <vector>
+#include <getopt.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/thread.hpp>
+
+#include "common/Logger.h"
+#include "common/panic.h"
+
+#include "LegacyReporter.h"
+#include "LogHelper.h"
+#include "UrlCopyOpts.h"
+#include "UrlCopyProcess.h"
+
+using fts3::common::commit;
+namespace panic = fts3::common::panic;
+
+
+const char UrlCopyWorker::DONE_MESSAGE[] = "DONE";
+const char UrlCopyWorker::CANCEL_MESSAGE[] = "CANCEL";
+
+
+bool UrlCopyWorker::parseCancel(const std::string &message, uint64_t &fileId)
+{
+    const std::string prefix = std::string(CANCEL_MESSAGE) + " ";
+    if (message.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+    try {
+        fileId = boost::lexical_cast<uint64_t>(message.substr(prefix.size()));
+    }
+    catch (const boost::bad_lexical_cast&) {
+        return false;
+    }
+    return true;
+}
+
+
+UrlCopyWorker::UrlCopyWorker(int fd, SignalCallback signalCallback):
+    fd(fd), signalCallback(signalCallback), current(NULL), terminate(false)
+{
+}
+
+
+UrlCopyWorker::~UrlCopyWorker()
+{
+    close(fd);
+}
+
+
+void UrlCopyWorker::onSignal(int signum, void *udata)
+{
+    UrlCopyWorker *worker = static_cast<UrlCopyWorker*>(udata);
+
+    boost::lock_guard<boost::mutex> lock(worker->mutex);
+    worker->terminate = true;
+    worker->signalCallback(signum, worker->current);
+    // Unblock receive if idle
+    shutdown(worker->fd, SHUT_RD);
+}
+
+
+bool UrlCopyWorker::isTerminating(void)
+{
+    boost::lock_guard<boost::mutex> lock(mutex);
+    return terminate;
+}
+
+
+bool UrlCopyWorker::receiveMessage(std::string &message)
+{
+    while (true) {
+        // Peek first to get the full size of the message
+        ssize_t size = recv(fd, NULL, 0, MSG_PEEK | MSG_TRUNC);
+        if (size < 0 && errno == EINTR) {
+            continue;
+        }
+        if (size <= 0) {
+            return false;
+        }
+
+        message.resize(size);
+        ssize_t received = recv(fd, &message[0], size, 0);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            return false;
+        }
+        message.resize(received);
+        return true;
+    }
+}
+
+
+bool UrlCopyWorker::receive(std::string &params)
+{
+    uint64_t fileId;
+    while (receiveMessage(params)) {
+        // Cancel requests for a transfer that is already over
+        if (parseCancel(params, fileId)) {
+            FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Ignoring the cancel request for " << fileId
+                << ", no longer running" << commit;
+            continue;
+        }
+        return true;
+    }
+    return false;
+}
+
+
+void UrlCopyWorker::watch(const std::vector<uint64_t> &fileIds)
+{
+    std::string message;
+    while (!boost::this_thread::interruption_requested()) {
+        pollfd pfd = {fd, POLLIN, 0};
+        int ret = poll(&pfd, 1, 200);
+        if (ret < 0 && errno != EINTR) {
+            return;
+        }
+        if (ret <= 0) {
+            continue;
+        }
+
+        // Server gone, or a signal shut the socket down
+        if (!receiveMessage(message)) {
+            return;
+        }
+
+        uint64_t fileId;
+        if (!parseCancel(message, fileId) ||
+            std::find(fileIds.begin(), fileIds.end(), fileId) == fileIds.end()) {
+            FTS3_COMMON_LOGGER_NEWLOG(WARNING) << "Unexpected message from the server while running a transfer: "
+                << message << commit;
+            continue;
+        }
+
+        FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Transfer " << fileId << " canceled by the server" << commit;
+        boost::lock_guard<boost::mutex> lock(mutex);
+        if (current) {
+            current->cancel();
+        }
+    }
+}
+
+
+void UrlCopyWorker::runTransfer(const std::string &params)
+{
+    // Same splitting as ExecuteProcess does for the command line
+    std::list<std::string> argsHolder;
+    boost::split(argsHolder, params, boost::is_any_of(" "));
+
+    std::vector<char*> argv;
+    argv.push_back(const_cast<char*>("fts_url_copy"));
+    for (auto i = argsHolder.begin(); i != argsHolder.end(); ++i) {
+        argv.push_back(const_cast<char*>(i->c_str()));
+    }
+    argv.push_back(NULL);
+
+    UrlCopyOpts opts;
+    optind = 0;
+    opts.parse(argv.size() - 1, argv.data());
+    setupLogging(opts.debugLevel);
+
+    // Do not leave the credentials of the previous transfer in the environment
+    unsetenv("X509_USER_CERT");
+    unsetenv("X509_USER_KEY");
+    unsetenv("X509_USER_PROXY");
+
+    // Undo what the previous transfer configured. Plugin sessions (i.e. gridftp session reuse)
+    // are bound to the credentials, so the context can only be kept for the same proxy.
+    if (!gfal2 || opts.proxy != gfal2Proxy || !gfal2->resetTransfer()) {
+        gfal2.reset();
+        gfal2.reset(new Gfal2);
+        gfal2Proxy = opts.proxy;
+    }
+    else {
+        FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Reusing the gfal2 context of the previous transfer" << commit;
+    }
+    gfal2->beginTransfer();
+
+    LegacyReporter reporter(opts);
+    UrlCopyProcess urlCopyProcess(opts, reporter, *gfal2);
+
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        current = &urlCopyProcess;
+        // Signal received before the transfer started
+        if (terminate) {
+            urlCopyProcess.cancel();
+        }
+    }
+
+    std::vector<uint64_t> fileIds;
+    for (auto i = opts.transfers.begin(); i != opts.transfers.end(); ++i) {
+        fileIds.push_back(i->fileId);
+    }
+    boost::thread watcher(&UrlCopyWorker::watch, this, fileIds);
+
+    try {
+        urlCopyProcess.run();
+    }
+    catch (const std::exception &e) {
+        urlCopyProcess.panic(e.what());
+    }
+
+    watcher.interrupt();
+    watcher.join();
+
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        current = NULL;
+    }
+
+    // Stop writing into the log of the finished transfer
+    if (!opts.logToStderr) {
+        fts3::common::theLogger().redirect("/dev/null", "/dev/null");
+    }
+}
+
+
+void UrlCopyWorker::run(void)
+{
+    panic::setup_signal_handlers(&UrlCopyWorker::onSignal, this);
+
+    std::string params;
+    while (!isTerminating() && receive(params)) {
+        try {
+            runTransfer(params);
+        }
+        catch (const std::exception &e) {
+            FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Worker failed to run the transfer: " << e.what() << commit;
+        }
+
+        if (send(fd, DONE_MESSAGE, sizeof(DONE_MESSAGE) - 1, MSG_NOSIGNAL) < 0) {
+            FTS3_COMMON_LOGGER_NEWLOG(ERR) << "Lost the connection with the server: " << strerror(errno) << commit;
+            break;
+        }
+    }
+}
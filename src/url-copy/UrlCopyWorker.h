@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef URLCOPYWORKER_H
+#define URLCOPYWORKER_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+
+#include "Gfal2.h"
+
+class UrlCopyProcess;
+
+
+/// Long lived fts_url_copy process. Instead of getting a single transfer on the command line,
+/// it receives the command line of each transfer from the server over a socket, and runs them
+/// one after the other. The gfal2 context, and thus the loaded plugins, is kept between transfers
+/// using the same proxy, once the options, credentials and client info of the previous one are undone.
+class UrlCopyWorker {
+public:
+    typedef void (*SignalCallback)(int signum, void *udata);
+
+    /// Reply sent back to the server once a transfer is over
+    static const char DONE_MESSAGE[];
+
+    /// Sent by the server, followed by a space and the file id, to cancel a transfer.
+    /// Ignored if the worker is not running that transfer anymore.
+    static const char CANCEL_MESSAGE[];
+
+    /// Parse a cancel request
+    /// @return false if message is not one
+    static bool parseCancel(const std::string &message, uint64_t &fileId);
+
+    /// Constructor
+    /// @param fd               Socket connected to the server
+    /// @param signalCallback   Called with the running UrlCopyProcess (or NULL) when a signal is received
+    UrlCopyWorker(int fd, SignalCallback signalCallback);
+
+    ~UrlCopyWorker();
+
+    /// Run transfers until the server closes the socket, or a signal is received.
+    /// Signal handling is one shot, so the worker always quits after one, and the server starts a new one.
+    void run(void);
+
+private:
+    int fd;
+    SignalCallback signalCallback;
+
+    boost::mutex mutex;
+    UrlCopyProcess *current;
+    bool terminate;
+
+    std::unique_ptr<Gfal2> gfal2;
+    std::string gfal2Proxy;
+
+    /// Get the next message from the server
+    /// @return false if the server closed the socket
+    bool receiveMessage(std::string &message);
+
+    /// Get the next transfer, skipping stale cancel requests
+    /// @return false if the server closed the socket
+    bool receive(std::string &params);
+
+    /// Run the transfer described by params
+    void runTransfer(const std::string &params);
+
+    /// Wait for cancel requests from the server while a transfer runs.
+    /// Runs on its own thread until interrupted.
+    void watch(const std::vector<uint64_t> &fileIds);
+
+    /// True once a signal has been received
+    bool isTerminating(void);
+
+    static void onSignal(int signum, void *udata);
+};
+
+#endif // URLCOPYWORKER_H
@@ -20,6 +20,7 @@
 #include "LogHelper.h"
 #include "UrlCopyOpts.h"
 #include "UrlCopyProcess.h"
+#include "UrlCopyWorker.h"
 #include "LegacyReporter.h"
 
 #include <cstdlib>
@@ -86,6 +87,13 @@ int main(int argc, char *argv[])
     opts.parse(argc, argv);
     setupLogging(opts.debugLevel);
 
+    // Long lived worker: transfers come from the server
+    if (opts.workerFd >= 0) {
+        UrlCopyWorker worker(opts.workerFd, signalCallback);
+        worker.run();
+        return 0;
+    }
+
     // Construct Url Copy Process
     LegacyReporter reporter(opts);
     UrlCopyProcess urlCopyProcess(opts, reporter);
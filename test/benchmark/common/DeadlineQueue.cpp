@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <list>
+#include <thread>
+#include <time.h>
+
+#include "common/DeadlineQueue.h"
+
+using fts3::common::DeadlineQueue;
+
+
+BOOST_AUTO_TEST_SUITE(DeadlineQueueBenchmark)
+
+
+/// The one second full scan used before, as a reference for the benchmark
+class ScanningQueue
+{
+public:
+    void push(time_t deadline, int item)
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        items.emplace_back(deadline, item);
+    }
+
+    void popExpired(std::vector<int> &out, time_t)
+    {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        boost::mutex::scoped_lock lock(mutex);
+        time_t now = time(NULL);
+        for (auto i = items.begin(); i != items.end();) {
+            if (i->first > now) {
+                ++i;
+            }
+            else {
+                out.push_back(i->second);
+                i = items.erase(i);
+            }
+        }
+    }
+
+private:
+    boost::mutex mutex;
+    std::list<std::pair<time_t, int>> items;
+};
+
+
+static double threadCpuSeconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+
+/// 100k tasks parked for a long time, plus a few that come due while measuring.
+/// Reports the CPU used by the consumer per second, and how late the due tasks are dispatched.
+template <typename QUEUE>
+static void measureDispatch(const std::string &name)
+{
+    const int nParked = 100000;
+    const int nDue = 1000;
+    const int nProducers = 4;
+    const int spread = 3;
+
+    QUEUE queue;
+    time_t start = time(NULL);
+    for (int i = 0; i < nParked; ++i) {
+        queue.push(start + 3600, -1);
+    }
+
+    // Let the queue take in the parked tasks before measuring
+    std::vector<int> warmUp;
+    queue.popExpired(warmUp, 0);
+    BOOST_REQUIRE(warmUp.empty());
+
+    std::vector<time_t> deadlines(nDue);
+    std::vector<double> lateness;
+    lateness.reserve(nDue);
+
+    double cpu = 0;
+    std::chrono::duration<double> wall(0);
+
+    std::thread consumer([&]() {
+        double cpuStart = threadCpuSeconds();
+        auto wallStart = std::chrono::steady_clock::now();
+
+        std::vector<int> out;
+        while (lateness.size() < size_t(nDue)) {
+            out.clear();
+            queue.popExpired(out, 60);
+            auto now = std::chrono::system_clock::now();
+            for (auto i = out.begin(); i != out.end(); ++i) {
+                std::chrono::duration<double> late = now - std::chrono::system_clock::from_time_t(deadlines[*i]);
+                lateness.push_back(late.count());
+            }
+        }
+
+        cpu = threadCpuSeconds() - cpuStart;
+        wall = std::chrono::steady_clock::now() - wallStart;
+    });
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < nProducers; ++p) {
+        producers.emplace_back([&, p]() {
+            for (int i = p; i < nDue; i += nProducers) {
+                deadlines[i] = time(NULL) + 1 + (i % spread);
+                queue.push(deadlines[i], i);
+                std::this_thread::sleep_for(std::chrono::microseconds(500));
+            }
+        });
+    }
+    for (auto i = producers.begin(); i != producers.end(); ++i) {
+        i->join();
+    }
+    consumer.join();
+
+    BOOST_CHECK_EQUAL(lateness.size(), nDue);
+    std::sort(lateness.begin(), lateness.end());
+    BOOST_TEST_MESSAGE(name << ": " << (cpu / wall.count()) * 1000 << " ms CPU per second, "
+        << "dispatch delay median " << lateness[nDue / 2] * 1000 << " ms, "
+        << "max " << lateness.back() * 1000 << " ms");
+}
+
+
+BOOST_AUTO_TEST_CASE (dispatch100k)
+{
+    measureDispatch<ScanningQueue>("1 second scan");
+    measureDispatch<DeadlineQueue<int>>("deadline queue");
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/thread.hpp>
+#include <chrono>
+
+#include "common/Logger.h"
+
+
+BOOST_AUTO_TEST_SUITE(LoggerBenchmark)
+
+
+/// Cost of a log statement with a disabled level
+BOOST_AUTO_TEST_CASE(disabledCost)
+{
+    const unsigned iterations = 10000000;
+    fts3::common::Logger &logger = fts3::common::theLogger();
+    logger.setLogLevel(fts3::common::Logger::WARNING);
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations; ++i) {
+        FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "Disabled " << i << " " << 0.5 << fts3::common::commit;
+    }
+    std::chrono::duration<double, std::nano> macroElapsed = std::chrono::steady_clock::now() - start;
+
+    // Building the entry, as every statement did before, regardless of the level
+    start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations / 100; ++i) {
+        logger.newLog(fts3::common::Logger::DEBUG, __FILE__, __FUNCTION__, __LINE__)
+            << "Disabled " << i << " " << 0.5 << fts3::common::commit;
+    }
+    std::chrono::duration<double, std::nano> entryElapsed = std::chrono::steady_clock::now() - start;
+
+    BOOST_TEST_MESSAGE("disabled statement: " << macroElapsed.count() / iterations << " ns");
+    BOOST_TEST_MESSAGE("disabled entry: " << entryElapsed.count() / (iterations / 100) << " ns");
+}
+
+
+/// Redirect the logger into a file for the duration of the benchmark, and recover
+/// stdout, stderr and the synchronous mode afterwards
+class RedirectFixture {
+protected:
+    const std::string logPath;
+    int oldOut, oldErr;
+
+public:
+    RedirectFixture(): logPath("/tmp/fts3benchmark.log")
+    {
+        boost::filesystem::remove(logPath);
+        oldOut = dup(STDOUT_FILENO);
+        oldErr = dup(STDERR_FILENO);
+        fts3::common::theLogger().redirect(logPath, logPath);
+        fts3::common::theLogger().setLogLevel(fts3::common::Logger::INFO);
+    }
+
+    ~RedirectFixture()
+    {
+        fts3::common::theLogger().setAsync(false);
+        fts3::common::theLogger().redirect("/dev/null", "");
+
+        dup2(oldOut, STDOUT_FILENO);
+        dup2(oldErr, STDERR_FILENO);
+        close(oldOut);
+        close(oldErr);
+
+        boost::filesystem::remove(logPath);
+    }
+};
+
+
+/// Lines per second written by 32 threads
+static double measureLogRate(unsigned linesPerThread)
+{
+    const unsigned nThreads = 32;
+
+    auto start = std::chrono::steady_clock::now();
+
+    boost::thread_group threads;
+    for (unsigned t = 0; t < nThreads; ++t) {
+        threads.create_thread([t, linesPerThread]() {
+            for (unsigned i = 0; i < linesPerThread; ++i) {
+                FTS3_COMMON_LOGGER_NEWLOG(INFO) << "Benchmark line from thread " << t
+                    << " with some payload " << i << fts3::common::commit;
+            }
+        });
+    }
+    threads.join_all();
+    fts3::common::theLogger().drain();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return (nThreads * linesPerThread) / elapsed.count();
+}
+
+
+BOOST_FIXTURE_TEST_CASE(throughput, RedirectFixture)
+{
+    fts3::common::Logger &logger = fts3::common::theLogger();
+
+    double syncRate = measureLogRate(2000);
+
+    logger.setAsync(true);
+    uint64_t droppedBefore = logger.getDroppedCount();
+    double asyncRate = measureLogRate(2000);
+    uint64_t dropped = logger.getDroppedCount() - droppedBefore;
+
+    BOOST_TEST_MESSAGE("synchronous: " << syncRate << " lines/second");
+    BOOST_TEST_MESSAGE("asynchronous: " << asyncRate << " lines/second (" << dropped << " dropped)");
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/filesystem.hpp>
+
+#include <chrono>
+
+#include "msg-bus/consumer.h"
+#include "msg-bus/producer.h"
+#include "msg-bus/ShmRing.h"
+
+using namespace fts3::events;
+
+
+BOOST_AUTO_TEST_SUITE(ShmRingBenchmark)
+
+
+class ShmRingFixture {
+protected:
+    static const std::string TEST_PATH;
+
+public:
+    ShmRingFixture() {
+        boost::filesystem::create_directories(TEST_PATH);
+    }
+
+    ~ShmRingFixture() {
+        boost::filesystem::remove_all(TEST_PATH);
+    }
+};
+
+const std::string ShmRingFixture::TEST_PATH("/tmp/ShmRingBenchmark");
+
+
+/// Compare the throughput of both transports
+/// Run under strace -c -f to get the syscalls per message
+static double measureThroughput(const std::string &path, unsigned count)
+{
+    Producer producer(path);
+    Consumer consumer(path, count);
+
+    Message msg;
+    msg.set_job_id("1906cc40-b915-11e5-9a03-02163e006dd0");
+    msg.set_transfer_status("ACTIVE");
+    msg.set_source_se("mock://source");
+    msg.set_dest_se("mock://destination");
+    msg.set_process_id(0);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned i = 0; i < count; ++i) {
+        msg.set_file_id(i);
+        producer.runProducerStatus(msg);
+    }
+
+    std::vector<Message> statuses;
+    consumer.runConsumerStatus(statuses);
+    BOOST_CHECK_EQUAL(count, statuses.size());
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return count / elapsed.count();
+}
+
+
+BOOST_FIXTURE_TEST_CASE (throughput, ShmRingFixture)
+{
+    const unsigned count = 5000;
+
+    double dirqRate = measureThroughput(TEST_PATH, count);
+
+    ShmRing::configure(TEST_PATH + "/status.ring", true, 8192);
+    double ringRate = measureThroughput(TEST_PATH, count);
+
+    BOOST_TEST_MESSAGE("dirq: " << dirqRate << " messages/second");
+    BOOST_TEST_MESSAGE("shm ring: " << ringRate << " messages/second");
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
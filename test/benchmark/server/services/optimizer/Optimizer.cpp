@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <chrono>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include "OptimizerFixture.h"
+
+
+BOOST_AUTO_TEST_SUITE(OptimizerBenchmark)
+
+
+// Compare the run time depending on the number of workers
+BOOST_AUTO_TEST_CASE (optimizerParallel)
+{
+    const std::chrono::microseconds latency(200);
+    const unsigned nPairs = 256;
+
+    for (unsigned nWorkers = 1; nWorkers <= 16; nWorkers *= 4) {
+        OptimizerLatencyFixture optimizer(latency);
+        optimizer.populate(nPairs);
+        optimizer.setWorkers(nWorkers);
+
+        auto start = std::chrono::steady_clock::now();
+        optimizer.run();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        BOOST_CHECK_EQUAL(optimizer.committed.size(), nPairs);
+        BOOST_TEST_MESSAGE(nPairs << " pairs with " << nWorkers << " workers: "
+            << elapsed.count() * 1000 << " ms");
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include <sys/resource.h>
+
+#include "server/services/transfers/ExecuteProcess.h"
+
+
+BOOST_AUTO_TEST_SUITE(ExecuteProcessBenchmark)
+
+
+/// Expose both launch methods
+class TestExecuteProcess: public ExecuteProcess {
+public:
+    TestExecuteProcess(const std::string &app, const std::string &arguments):
+        ExecuteProcess(app, arguments)
+    {
+    }
+
+    int launch(bool spawn, std::string &forkMessage)
+    {
+        if (spawn) {
+            return spawnProcessShell(forkMessage);
+        }
+        return forkProcessShell(forkMessage);
+    }
+};
+
+
+/// Median time to start /bin/true, which is less noisy than the average
+static double measureLatency(bool spawn)
+{
+    const int count = 31;
+
+    std::vector<double> samples;
+    for (int i = 0; i < count; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        TestExecuteProcess process("/bin/true", "");
+        std::string forkMessage;
+        process.launch(spawn, forkMessage);
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        samples.push_back(elapsed.count());
+    }
+    std::sort(samples.begin(), samples.end());
+    return samples[count / 2];
+}
+
+
+/// posix_spawn does not copy the page tables, nor walks the file descriptor table,
+/// so starting the url copy should not get slower when the server grows or raises its fd limit
+BOOST_AUTO_TEST_CASE (latency)
+{
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 34)
+    struct rlimit original;
+    getrlimit(RLIMIT_NOFILE, &original);
+    struct rlimit raised = original;
+    raised.rlim_cur = original.rlim_max;
+
+    double base = measureLatency(true);
+    BOOST_TEST_MESSAGE("posix_spawn, base: " << base << " ms");
+    BOOST_TEST_MESSAGE("fork, base: " << measureLatency(false) << " ms");
+
+    setrlimit(RLIMIT_NOFILE, &raised);
+    double raisedLimit = measureLatency(true);
+    setrlimit(RLIMIT_NOFILE, &original);
+    BOOST_TEST_MESSAGE("posix_spawn, nofile " << raised.rlim_cur << ": " << raisedLimit << " ms");
+
+    // Touch the pages so they are resident
+    const size_t size = 64 * 1024 * 1024;
+    std::unique_ptr<char[]> ballast(new char[size]);
+    memset(ballast.get(), 1, size);
+
+    double bigger = measureLatency(true);
+    BOOST_TEST_MESSAGE("posix_spawn, RSS + 64 MB: " << bigger << " ms");
+    BOOST_TEST_MESSAGE("fork, RSS + 64 MB: " << measureLatency(false) << " ms");
+#endif
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
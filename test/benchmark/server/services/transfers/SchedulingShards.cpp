@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "server/services/transfers/SchedulingShards.h"
+
+using namespace fts3::server;
+
+
+BOOST_AUTO_TEST_SUITE(SchedulingShardsBenchmark)
+
+
+static std::vector<QueueId> generateQueues(unsigned nQueues, unsigned nStorages)
+{
+    std::vector<QueueId> queues;
+    for (unsigned i = 0; i < nQueues; ++i) {
+        std::string source = "gsiftp://source" + std::to_string(i % nStorages);
+        std::string dest = "gsiftp://dest" + std::to_string((i / nStorages) % nStorages);
+        std::string vo = "vo" + std::to_string(i % 3);
+        queues.emplace_back(source, dest, vo, 0);
+    }
+    return queues;
+}
+
+
+struct SyntheticShard {
+    std::vector<QueueId> queues;
+    int scheduled;
+
+    SyntheticShard(const std::vector<QueueId> &queues): queues(queues), scheduled(0) {}
+};
+
+
+/// Simulate a scheduling cycle: each queue costs a database round trip to fetch, and
+/// then its transfers are planned against the shared slot table
+static double measureCycle(unsigned nQueues, unsigned nShards, std::chrono::microseconds fetchLatency)
+{
+    std::vector<QueueId> queues = generateQueues(nQueues, 20);
+
+    auto start = std::chrono::steady_clock::now();
+
+    SlotTable slots(nQueues * 10);
+    std::vector<SyntheticShard> shards;
+    std::vector<std::vector<QueueId>> partitions = partitionQueues(queues, nShards);
+    for (auto i = partitions.begin(); i != partitions.end(); ++i) {
+        shards.emplace_back(*i);
+    }
+
+    runShards(shards, [&slots, fetchLatency](SyntheticShard &shard) {
+        for (auto q = shard.queues.begin(); q != shard.queues.end(); ++q) {
+            slots.addStorage(q->sourceSe, 60, 60);
+            slots.addStorage(q->destSe, 60, 60);
+            std::this_thread::sleep_for(fetchLatency);
+        }
+    });
+    runShards(shards, [&slots](SyntheticShard &shard) {
+        for (int round = 0; round < 10; ++round) {
+            for (auto q = shard.queues.begin(); q != shard.queues.end(); ++q) {
+                if (slots.acquire(q->sourceSe, q->destSe) == SlotTable::ACQUIRED) {
+                    ++shard.scheduled;
+                }
+            }
+        }
+    });
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+
+BOOST_AUTO_TEST_CASE (cycleTime)
+{
+    const unsigned nShards = std::max(2u, std::thread::hardware_concurrency());
+    const std::chrono::microseconds fetchLatency(200);
+
+    for (unsigned nQueues = 16; nQueues <= 1024; nQueues *= 4) {
+        double sequential = measureCycle(nQueues, 1, fetchLatency);
+        double sharded = measureCycle(nQueues, nShards, fetchLatency);
+        BOOST_TEST_MESSAGE(nQueues << " queues: " << sequential * 1000 << " ms with 1 shard, "
+            << sharded * 1000 << " ms with " << nShards << " shards");
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
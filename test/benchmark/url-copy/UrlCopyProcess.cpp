@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+#include <chrono>
+#include "url-copy/UrlCopyProcess.h"
+
+
+BOOST_AUTO_TEST_SUITE(UrlCopyProcessBenchmark)
+
+
+class UrlCopyFixture: public Reporter {
+protected:
+    UrlCopyOpts opts;
+    std::list<Transfer> completedMsgs, startMsgs, pingMsgs, protoMsgs;
+
+public:
+    UrlCopyFixture() {
+        opts.logToStderr = false;
+        opts.logDir = "/tmp/fts3-tests";
+    }
+
+    void sendTransferStart(const Transfer &t, Gfal2TransferParams&) {
+        startMsgs.push_back(t);
+    }
+
+    void sendProtocol(const Transfer &t, Gfal2TransferParams&) {
+        protoMsgs.push_back(t);
+    }
+
+    void sendTransferCompleted(const Transfer &t, Gfal2TransferParams&) {
+        completedMsgs.push_back(t);
+    }
+
+    void sendPing(Transfer &t) {
+        pingMsgs.push_back(t);
+    }
+};
+
+
+/// Transfers per second of small files, with a new gfal2 context per transfer, as a forked fts_url_copy does,
+/// or sharing one, as the url copy workers do. The fork and exec of the process is on top of the former.
+static double measureThroughput(UrlCopyFixture &fixture, UrlCopyOpts opts, uint64_t size, bool shared)
+{
+    const unsigned count = 100;
+
+    Transfer transfer;
+    transfer.source = Uri::parse("mock://host/path?size=" + std::to_string(size));
+    transfer.destination = Uri::parse("mock://host/path?size_post=" + std::to_string(size));
+    opts.transfers.push_back(transfer);
+
+    std::unique_ptr<Gfal2> gfal2;
+    if (shared) {
+        gfal2.reset(new Gfal2);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < count; ++i) {
+        if (shared) {
+            UrlCopyProcess proc(opts, fixture, *gfal2);
+            proc.run();
+        }
+        else {
+            UrlCopyProcess proc(opts, fixture);
+            proc.run();
+        }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return count / elapsed.count();
+}
+
+
+BOOST_FIXTURE_TEST_CASE (throughput, UrlCopyFixture)
+{
+    const uint64_t sizes[] = {1024, 10 * 1024, 100 * 1024, 1024 * 1024};
+
+    for (auto size = std::begin(sizes); size != std::end(sizes); ++size) {
+        double perTransfer = measureThroughput(*this, opts, *size, false);
+        double shared = measureThroughput(*this, opts, *size, true);
+
+        BOOST_TEST_MESSAGE(*size << " bytes: " << perTransfer << " transfers/second with a context per transfer, "
+            << shared << " transfers/second with a shared context");
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
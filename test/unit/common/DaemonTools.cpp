@@ -71,6 +71,16 @@ BOOST_AUTO_TEST_CASE(countProcessesWithNameTest)
 }
 
 
+BOOST_AUTO_TEST_CASE(findProcessesWithNameTest)
+{
+    std::string self = getCurrentProcName();
+    std::set<pid_t> pids = findProcessesWithName(self);
+    BOOST_CHECK_EQUAL(pids.size(), 1);
+    BOOST_CHECK_EQUAL(pids.count(getpid()), 1);
+    BOOST_CHECK(findProcessesWithName("/fake/path/really/unlikely").empty());
+}
+
+
 BOOST_AUTO_TEST_CASE(binaryExistsTest)
 {
     std::string path;
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <chrono>
+#include <thread>
+#include <time.h>
+
+#include "common/DeadlineQueue.h"
+
+using fts3::common::DeadlineQueue;
+
+
+BOOST_AUTO_TEST_SUITE(common)
+BOOST_AUTO_TEST_SUITE(DeadlineQueueTest)
+
+
+BOOST_AUTO_TEST_CASE (order)
+{
+    DeadlineQueue<int> queue;
+    time_t now = time(NULL);
+
+    queue.push(now - 1, 2);
+    queue.push(now - 5, 1);
+    queue.push(now - 1, 3);
+    queue.push(now + 3600, 4);
+    BOOST_CHECK_EQUAL(queue.size(), 4);
+
+    std::vector<int> out;
+    queue.popExpired(out, 1);
+
+    // Earliest first, and in push order for the same deadline
+    BOOST_REQUIRE_EQUAL(out.size(), 3);
+    BOOST_CHECK_EQUAL(out[0], 1);
+    BOOST_CHECK_EQUAL(out[1], 2);
+    BOOST_CHECK_EQUAL(out[2], 3);
+    BOOST_CHECK_EQUAL(queue.size(), 1);
+
+    // Nothing is due, so this waits for maxWait
+    out.clear();
+    auto start = std::chrono::steady_clock::now();
+    queue.popExpired(out, 2);
+    BOOST_CHECK(out.empty());
+    BOOST_CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(500));
+
+    queue.clear();
+    BOOST_CHECK_EQUAL(queue.size(), 0);
+}
+
+
+BOOST_AUTO_TEST_CASE (wakeUp)
+{
+    DeadlineQueue<int> queue;
+    queue.push(time(NULL) + 3600, 1);
+
+    std::vector<int> out;
+    std::chrono::steady_clock::duration elapsed;
+
+    std::thread consumer([&]() {
+        auto start = std::chrono::steady_clock::now();
+        while (out.empty()) {
+            queue.popExpired(out, 30);
+        }
+        elapsed = std::chrono::steady_clock::now() - start;
+    });
+
+    // An earlier item must interrupt the sleep on the later one
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    queue.push(time(NULL), 2);
+    consumer.join();
+
+    BOOST_REQUIRE_EQUAL(out.size(), 1);
+    BOOST_CHECK_EQUAL(out[0], 2);
+    BOOST_CHECK(elapsed < std::chrono::seconds(5));
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
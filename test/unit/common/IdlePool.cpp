@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "common/IdlePool.h"
+
+using fts3::common::IdlePool;
+
+
+BOOST_AUTO_TEST_SUITE(common)
+BOOST_AUTO_TEST_SUITE(IdlePoolTest)
+
+
+/// Stands for a gfal2 context: an option that belongs to the task, and one that belongs to the credential
+struct MockContext {
+    std::string spaceToken;
+    std::string credential;
+    bool sticky = false;
+};
+
+
+/// Counts what the pool creates and destroys
+class MockFactory {
+public:
+    std::atomic<int> created;
+    std::atomic<int> destroyed;
+
+    MockFactory(): created(0), destroyed(0) {}
+
+    MockContext *create()
+    {
+        ++created;
+        return new MockContext;
+    }
+
+    IdlePool<MockContext*> *newPool(size_t maxIdle)
+    {
+        return new IdlePool<MockContext*>(maxIdle,
+            [](MockContext *context) {
+                context->spaceToken.clear();
+                return !context->sticky;
+            },
+            [this](MockContext *context) {
+                ++destroyed;
+                delete context;
+            });
+    }
+};
+
+
+BOOST_AUTO_TEST_CASE (acquireByKey)
+{
+    MockFactory factory;
+    std::unique_ptr<IdlePool<MockContext*>> pool(factory.newPool(4));
+
+    MockContext *context = NULL;
+    BOOST_CHECK(!pool->tryAcquire("alice", context));
+
+    MockContext *alice = factory.create();
+    MockContext *bob = factory.create();
+    pool->release(alice, "alice");
+    pool->release(bob, "bob");
+    BOOST_CHECK_EQUAL(pool->size(), 2);
+
+    BOOST_CHECK(pool->tryAcquire("alice", context));
+    BOOST_CHECK_EQUAL(context, alice);
+    BOOST_CHECK(!pool->tryAcquire("alice", context));
+    BOOST_CHECK_EQUAL(pool->size(), 1);
+
+    pool->release(alice, "alice");
+    pool.reset();
+    BOOST_CHECK_EQUAL(factory.destroyed, 2);
+}
+
+
+BOOST_AUTO_TEST_CASE (resetOnRelease)
+{
+    MockFactory factory;
+    std::unique_ptr<IdlePool<MockContext*>> pool(factory.newPool(4));
+
+    MockContext *context = factory.create();
+    context->spaceToken = "TOKEN";
+    pool->release(context, "alice");
+
+    BOOST_REQUIRE(pool->tryAcquire("alice", context));
+    BOOST_CHECK(context->spaceToken.empty());
+
+    // Could not be reset, so it is not kept
+    context->sticky = true;
+    pool->release(context, "alice");
+    BOOST_CHECK_EQUAL(factory.destroyed, 1);
+    BOOST_CHECK_EQUAL(pool->size(), 0);
+    BOOST_CHECK(!pool->tryAcquire("alice", context));
+}
+
+
+BOOST_AUTO_TEST_CASE (evictLeastRecentlyReleased)
+{
+    MockFactory factory;
+    std::unique_ptr<IdlePool<MockContext*>> pool(factory.newPool(2));
+
+    MockContext *first = factory.create();
+    pool->release(first, "first");
+    pool->release(factory.create(), "second");
+    pool->release(factory.create(), "third");
+
+    BOOST_CHECK_EQUAL(pool->size(), 2);
+    BOOST_CHECK_EQUAL(factory.destroyed, 1);
+
+    MockContext *context = NULL;
+    BOOST_CHECK(!pool->tryAcquire("first", context));
+    BOOST_CHECK(pool->tryAcquire("second", context));
+    BOOST_CHECK(pool->tryAcquire("third", context));
+}
+
+
+/// Same flow as the staging tasks: start from an anonymous context,
+/// and switch to one already set up for the proxy if there is any
+BOOST_AUTO_TEST_CASE (stagingTasks)
+{
+    const int nTasks = 10000;
+    const int nThreads = 8;
+    const int nProxies = 50;
+
+    MockFactory factory;
+    std::unique_ptr<IdlePool<MockContext*>> pool(factory.newPool(64));
+
+    std::atomic<int> next(0);
+    std::atomic<int> errors(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nThreads; ++t) {
+        threads.emplace_back([&]() {
+            int i;
+            while ((i = next++) < nTasks) {
+                std::string proxy = "/tmp/x509up_h" + std::to_string(i % nProxies);
+
+                MockContext *context = NULL;
+                if (!pool->tryAcquire("", context)) {
+                    context = factory.create();
+                }
+                std::string credential;
+
+                MockContext *configured = NULL;
+                if (pool->tryAcquire(proxy, configured)) {
+                    pool->release(context, credential);
+                    context = configured;
+                }
+                else {
+                    context->credential = proxy;
+                }
+                credential = proxy;
+
+                if (!context->spaceToken.empty() || context->credential != proxy) {
+                    ++errors;
+                }
+                context->spaceToken = "TOKEN";
+                pool->release(context, credential);
+            }
+        });
+    }
+    for (auto t = threads.begin(); t != threads.end(); ++t) {
+        t->join();
+    }
+
+    BOOST_TEST_MESSAGE(nTasks << " tasks, " << factory.created << " contexts created, "
+        << factory.destroyed << " destroyed");
+    BOOST_CHECK_EQUAL(errors, 0);
+    BOOST_CHECK_LE(pool->size(), 64);
+    // About one per proxy, plus the ones in flight. Far from one per task.
+    BOOST_CHECK_LT(factory.created, nTasks / 100);
+
+    pool.reset();
+    BOOST_CHECK_EQUAL(factory.created, factory.destroyed);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include "common/LatencyHistogram.h"
+
+using fts3::common::LatencyHistogram;
+
+
+BOOST_AUTO_TEST_SUITE(common)
+BOOST_AUTO_TEST_SUITE(LatencyHistogramTest)
+
+
+BOOST_AUTO_TEST_CASE (empty)
+{
+    LatencyHistogram histogram;
+    BOOST_CHECK_EQUAL(histogram.getCount(), 0);
+    BOOST_CHECK_EQUAL(histogram.getMax(), 0);
+    BOOST_CHECK_EQUAL(histogram.getPercentile(50), 0);
+}
+
+
+BOOST_AUTO_TEST_CASE (percentiles)
+{
+    LatencyHistogram histogram;
+
+    // 90 fast, 9 slower, 1 very slow
+    for (int i = 0; i < 90; ++i) {
+        histogram.record(3);
+    }
+    for (int i = 0; i < 9; ++i) {
+        histogram.record(100);
+    }
+    histogram.record(5000);
+
+    BOOST_CHECK_EQUAL(histogram.getCount(), 100);
+    BOOST_CHECK_EQUAL(histogram.getMax(), 5000);
+    // Percentiles are the upper bound of the bucket
+    BOOST_CHECK_EQUAL(histogram.getPercentile(50), 4);
+    BOOST_CHECK_EQUAL(histogram.getPercentile(90), 4);
+    BOOST_CHECK_EQUAL(histogram.getPercentile(99), 128);
+    BOOST_CHECK_EQUAL(histogram.getPercentile(100), 5000);
+}
+
+
+BOOST_AUTO_TEST_CASE (outOfRange)
+{
+    LatencyHistogram histogram;
+
+    // Clock skew
+    histogram.record(-10);
+    BOOST_CHECK_EQUAL(histogram.getPercentile(100), 0);
+
+    // Beyond the last bucket
+    histogram.record(int64_t(1) << 40);
+    BOOST_CHECK_EQUAL(histogram.getPercentile(100), int64_t(1) << 40);
+
+    histogram.reset();
+    BOOST_CHECK_EQUAL(histogram.getCount(), 0);
+    BOOST_CHECK_EQUAL(histogram.getMax(), 0);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
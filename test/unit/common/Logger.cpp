@@ -17,6 +17,7 @@
 #include <boost/test/unit_test_suite.hpp>
 #include <boost/test/test_tools.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/thread.hpp>
 #include <fstream>
 
 #include "common/Logger.h"
@@ -65,6 +66,27 @@ BOOST_AUTO_TEST_CASE(logLevel)
 }
 
 
+BOOST_AUTO_TEST_CASE(disabledNotEvaluated)
+{
+    fts3::common::Logger &logger = fts3::common::theLogger();
+    logger.setLogLevel(fts3::common::Logger::WARNING);
+
+    int evaluated = 0;
+    FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << ++evaluated << fts3::common::commit;
+    BOOST_CHECK_EQUAL(evaluated, 0);
+
+    // Must behave as a single statement
+    if (evaluated == 0)
+        FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << "DISABLED" << fts3::common::commit;
+    else
+        BOOST_FAIL("The else branch belongs to the outer if");
+
+    logger.setLogLevel(fts3::common::Logger::DEBUG);
+    FTS3_COMMON_LOGGER_NEWLOG(DEBUG) << ++evaluated << fts3::common::commit;
+    BOOST_CHECK_EQUAL(evaluated, 1);
+}
+
+
 BOOST_AUTO_TEST_CASE(redirect)
 {
     const std::string logPath("/tmp/fts3tests.log");
@@ -123,5 +145,180 @@ BOOST_AUTO_TEST_CASE(redirect)
 }
 
 
+/// Redirect the logger into a file for the duration of the test, and recover
+/// stdout, stderr and the synchronous mode afterwards
+class RedirectFixture {
+protected:
+    const std::string logPath;
+    int oldOut, oldErr;
+
+public:
+    RedirectFixture(): logPath("/tmp/fts3tests-async.log")
+    {
+        boost::filesystem::remove(logPath);
+        oldOut = dup(STDOUT_FILENO);
+        oldErr = dup(STDERR_FILENO);
+        fts3::common::theLogger().redirect(logPath, logPath);
+        fts3::common::theLogger().setLogLevel(fts3::common::Logger::INFO);
+    }
+
+    ~RedirectFixture()
+    {
+        fts3::common::theLogger().setAsync(false);
+        fts3::common::theLogger().redirect("/dev/null", "");
+
+        dup2(oldOut, STDOUT_FILENO);
+        dup2(oldErr, STDERR_FILENO);
+        close(oldOut);
+        close(oldErr);
+
+        boost::filesystem::remove(logPath);
+    }
+
+    /// Count the lines of the log file containing the marker
+    static unsigned countLines(const std::string &path, const std::string &marker)
+    {
+        std::ifstream read(path);
+        std::string line;
+        unsigned count = 0;
+        while (std::getline(read, line)) {
+            if (line.find(marker) != std::string::npos) {
+                ++count;
+            }
+        }
+        return count;
+    }
+};
+
+
+BOOST_FIXTURE_TEST_CASE(async, RedirectFixture)
+{
+    fts3::common::Logger &logger = fts3::common::theLogger();
+    logger.setAsync(true);
+
+    boost::thread_group threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.create_thread([t]() {
+            for (int i = 0; i < 1000; ++i) {
+                FTS3_COMMON_LOGGER_NEWLOG(INFO) << "ASYNC " << t << " " << i << fts3::common::commit;
+            }
+        });
+    }
+    threads.join_all();
+
+    // Threads are gone, but their lines must be written nevertheless
+    logger.drain();
+    BOOST_CHECK_EQUAL(countLines(logPath, "ASYNC "), 4000 - logger.getDroppedCount());
+
+    // CRIT lines are written right away, after what was queued
+    FTS3_COMMON_LOGGER_NEWLOG(INFO) << "BEFORE CRIT" << fts3::common::commit;
+    FTS3_COMMON_LOGGER_NEWLOG(CRIT) << "CRIT LINE" << fts3::common::commit;
+    BOOST_CHECK_EQUAL(countLines(logPath, "BEFORE CRIT"), 1);
+    BOOST_CHECK_EQUAL(countLines(logPath, "CRIT LINE"), 1);
+}
+
+
+BOOST_FIXTURE_TEST_CASE(asyncDropped, RedirectFixture)
+{
+    fts3::common::Logger &logger = fts3::common::theLogger();
+    logger.setAsync(true, 4);
+
+    uint64_t droppedBefore = logger.getDroppedCount();
+    for (int i = 0; i < 10000; ++i) {
+        FTS3_COMMON_LOGGER_NEWLOG(INFO) << "DROPPABLE " << i << fts3::common::commit;
+    }
+    logger.setAsync(false);
+
+    uint64_t dropped = logger.getDroppedCount() - droppedBefore;
+    BOOST_CHECK_GT(dropped, 0);
+    BOOST_CHECK_EQUAL(countLines(logPath, "DROPPABLE "), 10000 - dropped);
+}
+
+
+BOOST_FIXTURE_TEST_CASE(asyncRedirect, RedirectFixture)
+{
+    const std::string secondPath("/tmp/fts3tests-async-second.log");
+    boost::filesystem::remove(secondPath);
+
+    fts3::common::Logger &logger = fts3::common::theLogger();
+    logger.setAsync(true);
+
+    // Whatever was logged before the redirection, goes into the first file
+    for (int i = 0; i < 100; ++i) {
+        FTS3_COMMON_LOGGER_NEWLOG(INFO) << "FIRST " << i << fts3::common::commit;
+    }
+    logger.redirect(secondPath, "");
+    for (int i = 0; i < 100; ++i) {
+        FTS3_COMMON_LOGGER_NEWLOG(INFO) << "SECOND " << i << fts3::common::commit;
+    }
+    logger.drain();
+
+    BOOST_CHECK_EQUAL(countLines(logPath, "FIRST "), 100);
+    BOOST_CHECK_EQUAL(countLines(logPath, "SECOND "), 0);
+    BOOST_CHECK_EQUAL(countLines(secondPath, "FIRST "), 0);
+    BOOST_CHECK_EQUAL(countLines(secondPath, "SECOND "), 100);
+
+    boost::filesystem::remove(secondPath);
+}
+
+
+/// Count the file descriptors of this process open on the path
+static unsigned countOpenFds(const std::string &path)
+{
+    unsigned count = 0;
+    boost::filesystem::directory_iterator end;
+    for (boost::filesystem::directory_iterator i("/proc/self/fd"); i != end; ++i) {
+        boost::system::error_code ec;
+        if (boost::filesystem::read_symlink(i->path(), ec).string() == path) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+
+BOOST_FIXTURE_TEST_CASE(asyncFdOnlyWhenEnabled, RedirectFixture)
+{
+    fts3::common::Logger &logger = fts3::common::theLogger();
+    unsigned syncFds = countOpenFds(logPath);
+
+    logger.setAsync(true);
+    BOOST_CHECK_EQUAL(countOpenFds(logPath), syncFds + 1);
+
+    logger.setAsync(false);
+    BOOST_CHECK_EQUAL(countOpenFds(logPath), syncFds);
+
+    // Redirecting while synchronous does not open the asynchronous output either
+    logger.redirect(logPath, "");
+    BOOST_CHECK_EQUAL(countOpenFds(logPath), syncFds);
+}
+
+
+/// Lines logged while the asynchronous mode is being disabled are written anyway
+BOOST_FIXTURE_TEST_CASE(asyncStopWhileLogging, RedirectFixture)
+{
+    const int nThreads = 4, linesPerThread = 20000;
+
+    fts3::common::Logger &logger = fts3::common::theLogger();
+    logger.setAsync(true, nThreads * linesPerThread);
+    uint64_t droppedBefore = logger.getDroppedCount();
+
+    boost::thread_group threads;
+    for (int t = 0; t < nThreads; ++t) {
+        threads.create_thread([t]() {
+            for (int i = 0; i < linesPerThread; ++i) {
+                FTS3_COMMON_LOGGER_NEWLOG(INFO) << "STOPPING " << t << " " << i << fts3::common::commit;
+            }
+        });
+    }
+    boost::this_thread::sleep(boost::posix_time::milliseconds(5));
+    logger.setAsync(false);
+    threads.join_all();
+
+    BOOST_CHECK_EQUAL(logger.getDroppedCount(), droppedBefore);
+    BOOST_CHECK_EQUAL(countLines(logPath, "STOPPING "), nThreads * linesPerThread);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "common/PollPlanner.h"
+
+using fts3::common::PollPlanner;
+
+
+BOOST_AUTO_TEST_SUITE(common)
+BOOST_AUTO_TEST_SUITE(PollPlannerTest)
+
+
+BOOST_AUTO_TEST_CASE (fallback)
+{
+    // Not enough history
+    std::vector<time_t> durations(PollPlanner::MIN_SAMPLES - 1, 100);
+    BOOST_CHECK_EQUAL(PollPlanner::getInterval(durations, 0, 42), 42);
+
+    // Enough history, but the request is older than all of it
+    durations.push_back(200);
+    BOOST_CHECK_NE(PollPlanner::getInterval(durations, 0, 42), 42);
+    BOOST_CHECK_NE(PollPlanner::getInterval(durations, 199, 42), 42);
+    BOOST_CHECK_EQUAL(PollPlanner::getInterval(durations, 200, 42), 42);
+    BOOST_CHECK_EQUAL(PollPlanner::getInterval(durations, 5000, 42), 42);
+}
+
+
+BOOST_AUTO_TEST_CASE (clamp)
+{
+    // Completions are a day away, which would give an interval of about an hour
+    std::vector<time_t> durations(PollPlanner::MIN_SAMPLES, 86400);
+    BOOST_CHECK_EQUAL(PollPlanner::getInterval(durations, 0, 42), PollPlanner::MAX_INTERVAL);
+
+    // Whatever the history, the interval stays within bounds
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<time_t> durationDistribution(1, 20000);
+    durations.clear();
+    for (int i = 0; i < 500; ++i) {
+        durations.push_back(durationDistribution(generator));
+    }
+    std::sort(durations.begin(), durations.end());
+
+    for (time_t elapsed = 0; elapsed < durations.back(); elapsed += 7) {
+        time_t interval = PollPlanner::getInterval(durations, elapsed, 42);
+        BOOST_CHECK_GE(interval, PollPlanner::MIN_INTERVAL);
+        BOOST_CHECK_LE(interval, PollPlanner::MAX_INTERVAL);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE (denseAroundUsualDuration)
+{
+    // Everything completes between one and two hours
+    std::vector<time_t> durations;
+    for (time_t d = 3600; d < 7200; d += 4) {
+        durations.push_back(d);
+    }
+
+    time_t early = PollPlanner::getInterval(durations, 0, 42);
+    time_t usual = PollPlanner::getInterval(durations, 5400, 42);
+
+    BOOST_CHECK_EQUAL(early, PollPlanner::MAX_INTERVAL);
+    BOOST_CHECK_LT(usual, early / 2);
+}
+
+
+BOOST_AUTO_TEST_CASE (reserveSpill)
+{
+    PollPlanner planner;
+
+    // Two per second: the third and fourth go to the next second, and so on
+    BOOST_CHECK_EQUAL(planner.reserve("srm://a", 100, 50, 2), 100);
+    BOOST_CHECK_EQUAL(planner.reserve("srm://a", 100, 50, 2), 100);
+    BOOST_CHECK_EQUAL(planner.reserve("srm://a", 100, 50, 2), 101);
+    BOOST_CHECK_EQUAL(planner.reserve("srm://a", 100, 50, 2), 101);
+    BOOST_CHECK_EQUAL(planner.reserve("srm://a", 100, 50, 2), 102);
+
+    // Other endpoints do not count
+    BOOST_CHECK_EQUAL(planner.reserve("srm://b", 100, 50, 2), 100);
+
+    // Full seconds are skipped until the first gap
+    BOOST_CHECK_EQUAL(planner.reserve("srm://c", 200, 50, 1), 200);
+    BOOST_CHECK_EQUAL(planner.reserve("srm://c", 201, 50, 1), 201);
+    BOOST_CHECK_EQUAL(planner.reserve("srm://c", 203, 50, 1), 203);
+    BOOST_CHECK_EQUAL(planner.reserve("srm://c", 200, 50, 1), 202);
+    BOOST_CHECK_EQUAL(planner.reserve("srm://c", 200, 50, 1), 204);
+
+    // No limit
+    for (int i = 0; i < 10; ++i) {
+        BOOST_CHECK_EQUAL(planner.reserve("srm://d", 100, 50, 0), 100);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE (reserveForget)
+{
+    PollPlanner planner;
+
+    BOOST_CHECK_EQUAL(planner.reserve("srm://a", 100, 50, 1), 100);
+    BOOST_CHECK_EQUAL(planner.reserve("srm://a", 100, 50, 1), 101);
+
+    // Once past, the bookings are dropped
+    BOOST_CHECK_EQUAL(planner.reserve("srm://a", 300, 200, 1), 300);
+    BOOST_CHECK_EQUAL(planner.reserve("srm://a", 100, 0, 1), 100);
+}
+
+
+// Exponential backoff the poll tasks fall back to
+static time_t getBackoffInterval(int nPolls)
+{
+    if (nPolls > 9)
+        return 600;
+    else
+        return (2 << nPolls);
+}
+
+
+// Poll requests whose durations follow a lognormal distribution, and count
+// the polls and how long after completing they are noticed
+static void simulate(std::mt19937 &generator, std::lognormal_distribution<double> &distribution,
+    const std::vector<time_t> &history, bool learned, double *polls, double *delay)
+{
+    const int nRequests = 5000;
+    *polls = *delay = 0;
+
+    for (int r = 0; r < nRequests; ++r) {
+        time_t completion = time_t(distribution(generator));
+        time_t elapsed = 0;
+        int nPolls = 0;
+
+        while (true) {
+            ++(*polls);
+            if (elapsed >= completion) {
+                break;
+            }
+            time_t fallback = getBackoffInterval(++nPolls);
+            elapsed += learned ? PollPlanner::getInterval(history, elapsed, fallback) : fallback;
+        }
+        *delay += elapsed - completion;
+    }
+
+    *polls /= nRequests;
+    *delay /= nRequests;
+}
+
+
+// With the history of an endpoint, fewer polls notice completions sooner than the backoff
+BOOST_AUTO_TEST_CASE (lognormalSimulation)
+{
+    const double medians[] = {7200, 1200, 21600};
+    const double sigmas[] = {0.5, 1, 0.3};
+
+    std::mt19937 generator(42);
+
+    for (int i = 0; i < 3; ++i) {
+        std::lognormal_distribution<double> distribution(log(medians[i]), sigmas[i]);
+
+        std::vector<time_t> history;
+        for (int j = 0; j < 2000; ++j) {
+            history.push_back(time_t(distribution(generator)));
+        }
+        std::sort(history.begin(), history.end());
+
+        double backoffPolls, backoffDelay, learnedPolls, learnedDelay;
+        simulate(generator, distribution, history, false, &backoffPolls, &backoffDelay);
+        simulate(generator, distribution, history, true, &learnedPolls, &learnedDelay);
+
+        BOOST_TEST_MESSAGE("Median " << medians[i] << "s, sigma " << sigmas[i]
+            << ": backoff " << backoffPolls << " polls, " << backoffDelay << "s delay"
+            << ", learned " << learnedPolls << " polls, " << learnedDelay << "s delay");
+
+        BOOST_CHECK_LT(learnedPolls, backoffPolls);
+        BOOST_CHECK_LT(learnedDelay, backoffDelay);
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
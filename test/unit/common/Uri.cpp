@@ -16,6 +16,9 @@
 
 #include <boost/test/unit_test_suite.hpp>
 #include <boost/test/test_tools.hpp>
+#include <boost/regex.hpp>
+#include <chrono>
+#include <random>
 
 #include "common/Uri.h"
 
@@ -56,6 +59,153 @@ BOOST_AUTO_TEST_CASE(simpleHost)
 }
 
 
+BOOST_AUTO_TEST_CASE(ipv6)
+{
+    Uri uri = Uri::parse("gsiftp://[2001:db8::1]:2811/path");
+    BOOST_CHECK_EQUAL(uri.host, "[2001:db8::1]");
+    BOOST_CHECK_EQUAL(uri.port, 2811);
+    BOOST_CHECK_EQUAL(uri.path, "/path");
+
+    uri = Uri::parse("gsiftp://[2001:db8::1]/path");
+    BOOST_CHECK_EQUAL(uri.host, "[2001:db8::1]");
+    BOOST_CHECK_EQUAL(uri.port, 0);
+}
+
+
+BOOST_AUTO_TEST_CASE(view)
+{
+    std::string str("root://eos.cern.ch:1094//eos/file?svcClass=default#fragment");
+    UriView uri = UriView::parse(str);
+    BOOST_CHECK_EQUAL(uri.protocol, "root");
+    BOOST_CHECK_EQUAL(uri.host, "eos.cern.ch");
+    BOOST_CHECK_EQUAL(uri.port, 1094);
+    BOOST_CHECK_EQUAL(uri.path, "//eos/file");
+    BOOST_CHECK_EQUAL(uri.queryString, "svcClass=default");
+    BOOST_CHECK_EQUAL(uri.getSeName(), "root://eos.cern.ch");
+
+    // Components point into the original string
+    BOOST_CHECK(uri.host.data() == str.data() + 7);
+}
+
+
+/// The implementation based on boost::regex that UriView replaced
+static Uri regexParse(const std::string &uri)
+{
+    static boost::regex uri_regex("^(([^:/?#]+):)?(//([^/?#]*))?([^?#]*)(\\?([^#]*))?(#(.*))?");
+
+    Uri u0;
+    u0.fullUri = uri;
+
+    boost::smatch matches;
+    if (boost::regex_match(uri, matches, uri_regex, boost::match_posix)) {
+        u0.protocol = matches[2];
+        u0.host = matches[4];
+        u0.path = matches[5];
+        u0.queryString = matches[7];
+
+        size_t bracket_close_i = u0.host.rfind(']');
+        size_t colon_i = u0.host.rfind(':');
+        if (colon_i != std::string::npos &&
+            (bracket_close_i == std::string::npos || bracket_close_i < colon_i)) {
+            std::string port_str = u0.host.substr(colon_i + 1);
+            u0.host = u0.host.substr(0, colon_i);
+            u0.port = atoi(port_str.c_str());
+        }
+    }
+
+    return u0;
+}
+
+
+static void checkSameAsRegex(const std::string &str)
+{
+    Uri expected = regexParse(str);
+    Uri parsed = Uri::parse(str);
+
+    BOOST_CHECK_MESSAGE(
+        parsed.protocol == expected.protocol && parsed.host == expected.host &&
+        parsed.port == expected.port && parsed.path == expected.path &&
+        parsed.queryString == expected.queryString,
+        "Mismatch for '" << str << "'");
+}
+
+
+BOOST_AUTO_TEST_CASE(sameAsRegex)
+{
+    const char *cases[] = {
+        "", ":", "://", "//", "///", "?", "#", "?#", "#?",
+        "http:", "http:/", "http://", "http:///", "http://host", "http://host:", "http://host:80",
+        "http://host:80/", "http://host:abc/", "http://host:-1/", "http://host: 42/", "http://host:+7/",
+        "http://host:99999999999999999999/", "http://host:4294967297/", ":path", ":/path", "a:b:c",
+        "/absolute/path", "relative/path", "relative:path/with?query#frag", "//host/path",
+        "http://user@host:8080/path;params?a=b&c=d#fragment", "http://host?query", "http://host#frag",
+        "http://[::1]", "http://[::1]:443", "http://[::1]:443/path", "http://[::1/path", "http://::1]:80/",
+        "srm://host:8443/srm/managerv2?SFN=/path/file", "mock://host/?size=10&time=2",
+        "file:///etc/hosts", "s3s://bucket.s3.amazonaws.com/key?x=y?z", "http://a?b?c#d#e",
+        "http://host/pa th", "http://ho st/", "\n", "http://host/\n#\n", "http://host/#frag\nment",
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+        checkSameAsRegex(cases[i]);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(fuzz)
+{
+    // Biased towards the characters that matter to the grammar
+    const std::string alphabet(":/?#[]@.-+ 0123456789abcAB\n\t%");
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<size_t> lengthDist(0, 40);
+    std::uniform_int_distribution<size_t> charDist(0, alphabet.size() - 1);
+
+    for (int i = 0; i < 20000; ++i) {
+        std::string str;
+        size_t length = lengthDist(generator);
+        for (size_t c = 0; c < length; ++c) {
+            str += alphabet[charDist(generator)];
+        }
+        checkSameAsRegex(str);
+        checkSameAsRegex("gsiftp://" + str);
+    }
+}
+
+
+static const std::vector<std::string> BENCHMARK_URLS = {
+    "gsiftp://subdomain.domain.com:2811/path/to/some/file",
+    "davs://[2001:db8::1]:443/eos/experiment/data/file.root?svcClass=default",
+    "srm://srm.site.org:8443/srm/managerv2?SFN=/pnfs/site.org/data/file",
+    "root://eos.cern.ch//eos/experiment/file#fragment",
+};
+
+
+/// URLs parsed per second
+template <typename PARSE>
+static double measureRate(unsigned iterations, PARSE parse)
+{
+    unsigned ports = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations; ++i) {
+        ports += parse(BENCHMARK_URLS[i % BENCHMARK_URLS.size()]).port;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    BOOST_CHECK_EQUAL(ports, (iterations / BENCHMARK_URLS.size()) * (2811 + 443 + 8443));
+    return iterations / elapsed.count();
+}
+
+
+BOOST_AUTO_TEST_CASE(throughput)
+{
+    double regexRate = measureRate(10000, regexParse);
+    double parseRate = measureRate(1000000, Uri::parse);
+    double viewRate = measureRate(1000000, [](const std::string &url) { return UriView::parse(url); });
+
+    BOOST_TEST_MESSAGE("regex: " << regexRate << " URLs/second");
+    BOOST_TEST_MESSAGE("Uri::parse: " << parseRate << " URLs/second");
+    BOOST_TEST_MESSAGE("UriView::parse: " << viewRate << " URLs/second");
+}
+
+
 BOOST_AUTO_TEST_CASE(lanTransfer)
 {
     BOOST_CHECK_EQUAL(isLanTransfer("subdomain.domain.com", "subdomain.domain.com"), true);
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/thread.hpp>
+#include <chrono>
+#include <fstream>
+
+#include "config/FileMonitor.h"
+
+
+BOOST_AUTO_TEST_SUITE(config)
+BOOST_AUTO_TEST_SUITE(FileMonitorTestSuite)
+
+
+/// Count the reloads, instead of reloading
+class CountingMonitor: public fts3::config::FileMonitor {
+public:
+    boost::mutex mutex;
+    boost::condition_variable cond;
+    int reloads;
+
+    CountingMonitor(): FileMonitor(NULL), reloads(0) {}
+
+    ~CountingMonitor() {
+        stop();
+    }
+
+    /// Wait until there are at least n reloads, or the timeout expires
+    int waitFor(int n, int timeoutMs) {
+        boost::mutex::scoped_lock lock(mutex);
+        cond.timed_wait(lock, boost::posix_time::milliseconds(timeoutMs), [this, n]() { return reloads >= n; });
+        return reloads;
+    }
+
+protected:
+    void reload() {
+        boost::mutex::scoped_lock lock(mutex);
+        ++reloads;
+        cond.notify_all();
+    }
+};
+
+
+class FileMonitorFixture {
+protected:
+    static const std::string TEST_PATH;
+    const std::string configPath;
+
+public:
+    FileMonitorFixture(): configPath(TEST_PATH + "/fts3config") {
+        boost::filesystem::create_directories(TEST_PATH);
+        write(configPath, "LogLevel=INFO\n");
+    }
+
+    ~FileMonitorFixture() {
+        boost::filesystem::remove_all(TEST_PATH);
+    }
+
+    static void write(const std::string &path, const std::string &content) {
+        std::ofstream out(path);
+        out << content;
+    }
+};
+
+const std::string FileMonitorFixture::TEST_PATH("/tmp/FileMonitorTest");
+
+
+BOOST_FIXTURE_TEST_CASE (written, FileMonitorFixture)
+{
+    CountingMonitor monitor;
+    monitor.start(configPath);
+
+    // Unrelated files are ignored
+    write(TEST_PATH + "/other", "whatever");
+    BOOST_CHECK_EQUAL(monitor.waitFor(1, 3 * CountingMonitor::DEBOUNCE_MS), 0);
+
+    auto start = std::chrono::steady_clock::now();
+    write(configPath, "LogLevel=DEBUG\n");
+    BOOST_CHECK_EQUAL(monitor.waitFor(1, 5000), 1);
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    BOOST_TEST_MESSAGE("reloaded after " << elapsed.count() << " ms");
+    BOOST_CHECK_LT(elapsed.count(), 5000);
+}
+
+
+BOOST_FIXTURE_TEST_CASE (replaced, FileMonitorFixture)
+{
+    CountingMonitor monitor;
+    monitor.start(configPath);
+
+    // As editors and configuration management tools do
+    write(configPath + ".tmp", "LogLevel=DEBUG\n");
+    boost::filesystem::rename(configPath + ".tmp", configPath);
+
+    BOOST_CHECK_EQUAL(monitor.waitFor(1, 5000), 1);
+}
+
+
+BOOST_FIXTURE_TEST_CASE (debounce, FileMonitorFixture)
+{
+    CountingMonitor monitor;
+    monitor.start(configPath);
+
+    // A burst of writes triggers a single reload
+    for (int i = 0; i < 10; ++i) {
+        write(configPath, "LogLevel=DEBUG\n# " + std::to_string(i) + "\n");
+        boost::this_thread::sleep(boost::posix_time::milliseconds(CountingMonitor::DEBOUNCE_MS / 10));
+    }
+
+    BOOST_CHECK_EQUAL(monitor.waitFor(1, 5000), 1);
+    BOOST_CHECK_EQUAL(monitor.waitFor(2, 3 * CountingMonitor::DEBOUNCE_MS), 1);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -20,6 +20,7 @@
 
 #include <boost/test/unit_test_suite.hpp>
 #include <boost/test/test_tools.hpp>
+#include <chrono>
 
 #include "common/Exceptions.h"
 #include "config/ServerConfig.h"
@@ -39,8 +40,9 @@ BOOST_FIXTURE_TEST_CASE(getStr, fts3::config::ServerConfig)
 {
     const std::string f_key = "key";
     const std::string f_val = "value";
-    _vars[f_key] =
-    f_val;
+    _t_vars vars;
+    vars[f_key] = f_val;
+    publish(vars);
 
     std::string val = get<std::string>(f_key);
     BOOST_CHECK_EQUAL (val, f_val);
@@ -69,17 +71,151 @@ BOOST_FIXTURE_TEST_CASE (read, fts3::config::ServerConfig)
 
 BOOST_FIXTURE_TEST_CASE (getInt, fts3::config::ServerConfig)
 {
-    _vars["key"] = "10";
+    _t_vars vars;
+    vars["key"] = "10";
+    publish(vars);
     BOOST_CHECK_EQUAL (get<int>("key"), 10);
 }
 
 
 BOOST_FIXTURE_TEST_CASE (getDouble, fts3::config::ServerConfig)
 {
-    _vars["key"] = "10.05";
+    _t_vars vars;
+    vars["key"] = "10.05";
+    publish(vars);
     BOOST_CHECK_EQUAL (get<double>("key"), 10.05);
 }
 
 
+BOOST_FIXTURE_TEST_CASE (getTyped, fts3::config::ServerConfig)
+{
+    _t_vars vars;
+    vars["bool"] = "False";
+    vars["list"] = "a;b;;c";
+    vars["seconds"] = "30";
+    vars["notint"] = "abc";
+    publish(vars);
+
+    BOOST_CHECK_EQUAL(get<bool>("bool"), false);
+    BOOST_CHECK_EQUAL(get<bool>("seconds"), true);
+    BOOST_CHECK_EQUAL(get<unsigned>("seconds"), 30);
+    BOOST_CHECK_EQUAL(get<boost::posix_time::time_duration>("seconds").total_seconds(), 30);
+
+    std::vector<std::string> list = get<std::vector<std::string>>("list");
+    BOOST_REQUIRE_EQUAL(list.size(), 3);
+    BOOST_CHECK_EQUAL(list[2], "c");
+
+    BOOST_CHECK_THROW(get<int>("notint"), boost::bad_lexical_cast);
+}
+
+
+BOOST_FIXTURE_TEST_CASE (reload, fts3::config::ServerConfig)
+{
+    int notified = 0;
+    unsigned id = subscribe([&notified]() { ++notified; });
+
+    _t_vars vars;
+    vars["key"] = "1";
+    publish(vars);
+    BOOST_CHECK_EQUAL(notified, 1);
+
+    // A snapshot taken before the reload does not change
+    std::shared_ptr<const fts3::config::ConfigSnapshot> before = getSnapshot();
+
+    vars["key"] = "2";
+    publish(vars);
+    BOOST_CHECK_EQUAL(notified, 2);
+    BOOST_CHECK_EQUAL(get<int>("key"), 2);
+    BOOST_CHECK_EQUAL(before->getValue("key").integer, 1);
+
+    unsubscribe(id);
+    publish(vars);
+    BOOST_CHECK_EQUAL(notified, 2);
+}
+
+
+struct PublicServerConfig: public fts3::config::ServerConfig {
+    using fts3::config::ServerConfig::publish;
+};
+
+
+/// A different instance must not see the snapshot cached from another one,
+/// even if it is allocated at the same address
+BOOST_AUTO_TEST_CASE (instances)
+{
+    std::map<std::string, std::string> vars;
+    vars["key"] = "value";
+
+    PublicServerConfig *first = new PublicServerConfig;
+    first->publish(vars);
+    BOOST_CHECK_EQUAL(first->get<std::string>("key"), "value");
+    delete first;
+
+    PublicServerConfig second;
+    BOOST_CHECK_THROW(second.get<std::string>("key"), fts3::common::UserError);
+}
+
+
+BOOST_FIXTURE_TEST_CASE (changedKeys, fts3::config::ServerConfig)
+{
+    _t_vars vars;
+    vars["LogLevel"] = "INFO";
+    vars["Other"] = "1";
+    publish(vars);
+
+    int notified = 0;
+    subscribe([&notified]() { ++notified; }, {"LogLevel"});
+
+    // Nothing changed
+    publish(vars);
+    BOOST_CHECK_EQUAL(notified, 0);
+
+    // Something else changed
+    vars["Other"] = "2";
+    publish(vars);
+    BOOST_CHECK_EQUAL(notified, 0);
+
+    vars["LogLevel"] = "DEBUG";
+    publish(vars);
+    BOOST_CHECK_EQUAL(notified, 1);
+
+    // Removed
+    vars.erase("LogLevel");
+    publish(vars);
+    BOOST_CHECK_EQUAL(notified, 2);
+}
+
+
+/// Cost of getting an option, while the configuration is being reloaded
+BOOST_FIXTURE_TEST_CASE (getCost, fts3::config::ServerConfig)
+{
+    const unsigned iterations = 1000000;
+
+    _t_vars vars;
+    vars["UseFixedJobPriority"] = "0";
+    publish(vars);
+
+    boost::thread reloader([this, vars]() {
+        while (!boost::this_thread::interruption_requested()) {
+            publish(vars);
+            boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+        }
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    int sum = 0;
+    for (unsigned i = 0; i < iterations; ++i) {
+        sum += get<int>("UseFixedJobPriority");
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    reloader.interrupt();
+    reloader.join();
+
+    BOOST_CHECK_EQUAL(sum, 0);
+    BOOST_TEST_MESSAGE("get<int>: " << elapsed.count() / iterations << " ns");
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "db/mysql/SchedulingPlan.h"
+
+
+BOOST_AUTO_TEST_SUITE(db)
+BOOST_AUTO_TEST_SUITE(SchedulingPlanTest)
+
+
+/// A t_file row, joined with its job
+struct FileRow {
+    uint64_t fileId;
+    std::string vo;
+    std::string source;
+    std::string dest;
+    std::string state;
+    int priority;
+    /// Empty stands for NULL
+    std::string activity;
+};
+
+
+struct OptimizerRow {
+    std::string source;
+    std::string dest;
+    int active;
+};
+
+
+/// Fixed contents of the database
+struct Dataset {
+    std::vector<FileRow> files;
+    std::vector<OptimizerRow> optimizer;
+    std::map<std::string, std::map<std::string, double> > shares;
+
+    Dataset()
+    {
+        // No optimizer entry: up to 10, highest priority only
+        files.push_back({1, "atlas", "srm://a", "srm://b", "SUBMITTED", 3, ""});
+        files.push_back({2, "atlas", "srm://a", "srm://b", "SUBMITTED", 5, ""});
+        files.push_back({3, "atlas", "srm://a", "srm://b", "SUBMITTED", 5, ""});
+        files.push_back({4, "atlas", "srm://a", "srm://b", "ACTIVE", 5, ""});
+
+        // Optimizer allows 3, 1 running: 2 left, shared by two VOs of the same link
+        optimizer.push_back({"srm://a", "srm://c", 3});
+        files.push_back({10, "atlas", "srm://a", "srm://c", "ACTIVE", 3, ""});
+        files.push_back({11, "atlas", "srm://a", "srm://c", "SUBMITTED", 3, ""});
+        files.push_back({12, "atlas", "srm://a", "srm://c", "SUBMITTED", 3, ""});
+        files.push_back({13, "atlas", "srm://a", "srm://c", "SUBMITTED", 3, ""});
+        files.push_back({14, "cms", "srm://a", "srm://c", "SUBMITTED", 3, ""});
+
+        // Optimizer full
+        optimizer.push_back({"srm://a", "srm://d", 1});
+        files.push_back({20, "atlas", "srm://a", "srm://d", "ACTIVE", 3, ""});
+        files.push_back({21, "atlas", "srm://a", "srm://d", "SUBMITTED", 3, ""});
+
+        // Activity shares, with mixed case and NULL activities.
+        // Few enough files that the random split between activities is not involved.
+        optimizer.push_back({"srm://b", "srm://c", 20});
+        shares["lhcb"] = {{"express", 0.7}, {"default", 0.3}};
+        files.push_back({30, "lhcb", "srm://b", "srm://c", "SUBMITTED", 3, "Express"});
+        files.push_back({31, "lhcb", "srm://b", "srm://c", "SUBMITTED", 3, "express"});
+        files.push_back({32, "lhcb", "srm://b", "srm://c", "SUBMITTED", 3, ""});
+        files.push_back({33, "lhcb", "srm://b", "srm://c", "SUBMITTED", 3, "DEFAULT"});
+        files.push_back({34, "lhcb", "srm://b", "srm://c", "SUBMITTED", 2, "express"});
+
+        // Queue with nothing left
+        files.push_back({40, "dteam", "srm://c", "srm://a", "FINISHED", 3, ""});
+    }
+
+    std::vector<QueueId> getQueues() const
+    {
+        return {
+            QueueId("srm://a", "srm://b", "atlas", 0),
+            QueueId("srm://a", "srm://c", "atlas", 0),
+            QueueId("srm://a", "srm://c", "cms", 0),
+            QueueId("srm://a", "srm://d", "atlas", 0),
+            QueueId("srm://b", "srm://c", "lhcb", 0),
+            QueueId("srm://c", "srm://a", "dteam", 0)
+        };
+    }
+};
+
+
+/// What the per-queue statements of getReadyTransfers load for a queue
+static QueueState loadQueueState(const Dataset &data, const QueueId &queue)
+{
+    QueueState state;
+    for (auto f = data.files.begin(); f != data.files.end(); ++f) {
+        if (f->source != queue.sourceSe || f->dest != queue.destSe) {
+            continue;
+        }
+        if (f->state == "ACTIVE") {
+            ++state.activeCount;
+        }
+        if (f->state == "SUBMITTED" && f->vo == queue.voName) {
+            state.maxPriority = state.hasMaxPriority ? std::max(state.maxPriority, f->priority) : f->priority;
+            state.hasMaxPriority = true;
+        }
+    }
+    for (auto o = data.optimizer.begin(); o != data.optimizer.end(); ++o) {
+        if (o->source == queue.sourceSe && o->dest == queue.destSe) {
+            state.maxActive = o->active;
+        }
+    }
+    auto shares = data.shares.find(queue.voName);
+    if (shares != data.shares.end()) {
+        state.activityShares = shares->second;
+        // GROUP BY activity is case insensitive
+        for (auto f = data.files.begin(); f != data.files.end(); ++f) {
+            if (f->state == "SUBMITTED" && f->vo == queue.voName &&
+                f->source == queue.sourceSe && f->dest == queue.destSe) {
+                state.activitiesInQueue[normaliseActivityName(f->activity)] += 1;
+            }
+        }
+    }
+    return state;
+}
+
+
+/// What the grouped statements of the snapshot return
+static SchedulingSnapshot loadSnapshot(const Dataset &data)
+{
+    typedef std::tuple<std::string, std::string, std::string> VoLinkKey;
+
+    SchedulingSnapshot snapshot;
+
+    std::map<std::pair<std::string, std::string>, int> active;
+    std::map<VoLinkKey, int> priorities;
+    std::map<std::tuple<std::string, std::string, std::string, std::string>, long long> activities;
+
+    for (auto f = data.files.begin(); f != data.files.end(); ++f) {
+        if (f->state == "ACTIVE") {
+            ++active[std::make_pair(f->source, f->dest)];
+        }
+        if (f->state == "SUBMITTED") {
+            VoLinkKey key(f->vo, f->source, f->dest);
+            auto p = priorities.find(key);
+            priorities[key] = (p == priorities.end()) ? f->priority : std::max(p->second, f->priority);
+            if (data.shares.count(f->vo)) {
+                ++activities[std::make_tuple(f->vo, f->source, f->dest, f->activity)];
+            }
+        }
+    }
+
+    for (auto i = active.begin(); i != active.end(); ++i) {
+        snapshot.addActiveCount(i->first.first, i->first.second, i->second);
+    }
+    for (auto o = data.optimizer.begin(); o != data.optimizer.end(); ++o) {
+        snapshot.addMaxActive(o->source, o->dest, o->active);
+    }
+    for (auto i = priorities.begin(); i != priorities.end(); ++i) {
+        snapshot.addMaxPriority(std::get<0>(i->first), std::get<1>(i->first), std::get<2>(i->first), i->second);
+    }
+    for (auto i = data.shares.begin(); i != data.shares.end(); ++i) {
+        snapshot.addActivityShares(i->first, i->second);
+    }
+    // The snapshot groups by the raw activity, so case variants arrive as separate rows
+    for (auto i = activities.begin(); i != activities.end(); ++i) {
+        snapshot.addQueuedActivity(std::get<0>(i->first), std::get<1>(i->first), std::get<2>(i->first),
+            std::get<3>(i->first), i->second);
+    }
+    return snapshot;
+}
+
+
+/// What the candidate selects return for a plan
+static std::vector<uint64_t> selectCandidates(const Dataset &data, const QueueId &queue, const QueuePlan &plan)
+{
+    std::map<std::string, int> limits = plan.activityFilesNum;
+    if (limits.empty()) {
+        limits[""] = plan.filesNum;
+    }
+
+    std::vector<uint64_t> selected;
+    for (auto limit = limits.begin(); limit != limits.end(); ++limit) {
+        int picked = 0;
+        for (auto f = data.files.begin(); f != data.files.end() && picked < limit->second; ++f) {
+            if (f->state != "SUBMITTED" || f->vo != queue.voName ||
+                f->source != queue.sourceSe || f->dest != queue.destSe || f->priority != plan.maxPriority) {
+                continue;
+            }
+            std::string activity = normaliseActivityName(f->activity);
+            if (!limit->first.empty() && activity != limit->first &&
+                !(limit->first == "default" && plan.defaultActivities.count(activity))) {
+                continue;
+            }
+            selected.push_back(f->fileId);
+            ++picked;
+        }
+    }
+    std::sort(selected.begin(), selected.end());
+    return selected;
+}
+
+
+static std::map<std::string, std::vector<uint64_t> > schedule(const Dataset &data, bool useSnapshot)
+{
+    SchedulingSnapshot snapshot = loadSnapshot(data);
+    std::map<std::string, std::vector<uint64_t> > files;
+
+    std::vector<QueueId> queues = data.getQueues();
+    for (auto queue = queues.begin(); queue != queues.end(); ++queue) {
+        QueueState state = useSnapshot ? snapshot.getQueueState(*queue) : loadQueueState(data, *queue);
+        QueuePlan plan;
+        if (!planQueue(state, 0, plan)) {
+            continue;
+        }
+        std::vector<uint64_t> selected = selectCandidates(data, *queue, plan);
+        files[queue->voName].insert(files[queue->voName].end(), selected.begin(), selected.end());
+    }
+    return files;
+}
+
+
+BOOST_AUTO_TEST_CASE (snapshotMatchesPerQueue)
+{
+    Dataset data;
+
+    std::map<std::string, std::vector<uint64_t> > perQueue = schedule(data, false);
+    std::map<std::string, std::vector<uint64_t> > snapshot = schedule(data, true);
+
+    BOOST_CHECK_EQUAL(perQueue.size(), snapshot.size());
+    for (auto vo = perQueue.begin(); vo != perQueue.end(); ++vo) {
+        BOOST_CHECK_EQUAL_COLLECTIONS(vo->second.begin(), vo->second.end(),
+            snapshot[vo->first].begin(), snapshot[vo->first].end());
+    }
+
+    // And both are what getReadyTransfers is meant to pick
+    std::vector<uint64_t> atlas = {2, 3, 11, 12};
+    BOOST_CHECK_EQUAL_COLLECTIONS(snapshot["atlas"].begin(), snapshot["atlas"].end(), atlas.begin(), atlas.end());
+    std::vector<uint64_t> cms = {14};
+    BOOST_CHECK_EQUAL_COLLECTIONS(snapshot["cms"].begin(), snapshot["cms"].end(), cms.begin(), cms.end());
+    std::vector<uint64_t> lhcb = {30, 31, 32, 33};
+    BOOST_CHECK_EQUAL_COLLECTIONS(snapshot["lhcb"].begin(), snapshot["lhcb"].end(), lhcb.begin(), lhcb.end());
+    BOOST_CHECK(snapshot.find("dteam") == snapshot.end());
+}
+
+
+BOOST_AUTO_TEST_CASE (planLimits)
+{
+    QueueState state;
+    QueuePlan plan;
+
+    // No optimizer value
+    state.hasMaxPriority = true;
+    state.maxPriority = 4;
+    BOOST_CHECK(planQueue(state, 0, plan));
+    BOOST_CHECK_EQUAL(plan.filesNum, 10);
+    BOOST_CHECK_EQUAL(plan.maxPriority, 4);
+
+    state.maxActive = 5;
+    state.activeCount = 5;
+    BOOST_CHECK(!planQueue(state, 0, plan));
+
+    state.activeCount = 2;
+    BOOST_CHECK(planQueue(state, 0, plan));
+    BOOST_CHECK_EQUAL(plan.filesNum, 3);
+
+    // Nothing waiting, unless the priority is fixed
+    state.hasMaxPriority = false;
+    BOOST_CHECK(!planQueue(state, 0, plan));
+    BOOST_CHECK(planQueue(state, 2, plan));
+    BOOST_CHECK_EQUAL(plan.maxPriority, 2);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include "db/mysql/StagingPlan.h"
+
+using boost::posix_time::ptime;
+using boost::posix_time::seconds;
+
+
+BOOST_AUTO_TEST_SUITE(db)
+BOOST_AUTO_TEST_SUITE(StagingPlanTest)
+
+
+BOOST_AUTO_TEST_CASE (concurrentOps)
+{
+    StagingLimits limits;
+    limits.addConcurrentOps("atlas", "srm://a", 10);
+    limits.addConcurrentOps("atlas", "*", 5);
+    limits.addConcurrentOps("CMS", "SRM://B", 7);
+    limits.addConcurrentOps("cms", "srm://c", 0);
+
+    BOOST_CHECK_EQUAL(limits.getConcurrentOps("atlas", "srm://a"), 10);
+    // Fall back to the wildcard
+    BOOST_CHECK_EQUAL(limits.getConcurrentOps("atlas", "srm://z"), 5);
+    // The collation of t_stage_req is case insensitive
+    BOOST_CHECK_EQUAL(limits.getConcurrentOps("ATLAS", "SRM://A"), 10);
+    BOOST_CHECK_EQUAL(limits.getConcurrentOps("cms", "srm://b"), 7);
+    // A zero is not a limit, and there is no wildcard
+    BOOST_CHECK_EQUAL(limits.getConcurrentOps("cms", "srm://c"), 0);
+    BOOST_CHECK_EQUAL(limits.getConcurrentOps("dteam", "srm://a"), 0);
+}
+
+
+BOOST_AUTO_TEST_CASE (limits)
+{
+    StagingConfig config;
+    config.bulkSize = 100;
+    config.waitingFactor = 300;
+    config.concurrentRequests = 500;
+
+    std::map<std::string, ptime> nextSubmission;
+    ptime now = boost::posix_time::second_clock::local_time();
+
+    StagingState state;
+    state.queued = 1000;
+
+    // Nothing configured: a bulk
+    BOOST_CHECK_EQUAL(planStaging("srm://a", state, 0, config, nextSubmission, now), 100);
+
+    // Configured, minus what is already staging
+    state.started = 20;
+    BOOST_CHECK_EQUAL(planStaging("srm://a", state, 50, config, nextSubmission, now), 30);
+
+    // Never more than a bulk
+    BOOST_CHECK_EQUAL(planStaging("srm://a", state, 1000, config, nextSubmission, now), 100);
+
+    // Limit reached
+    state.started = 50;
+    BOOST_CHECK_EQUAL(planStaging("srm://a", state, 50, config, nextSubmission, now), 0);
+
+    // Too many requests in flight
+    state.started = 0;
+    state.activeRequests = 501;
+    BOOST_CHECK_EQUAL(planStaging("srm://a", state, 0, config, nextSubmission, now), 0);
+
+    BOOST_CHECK(nextSubmission.empty());
+}
+
+
+BOOST_AUTO_TEST_CASE (waitingFactor)
+{
+    StagingConfig config;
+    config.bulkSize = 100;
+    config.waitingFactor = 300;
+    config.concurrentRequests = 500;
+
+    std::map<std::string, ptime> nextSubmission;
+    ptime now = boost::posix_time::second_clock::local_time();
+
+    StagingState state;
+    state.queued = 10;
+
+    // Less than a bulk: wait for more files
+    BOOST_CHECK_EQUAL(planStaging("srm://a", state, 0, config, nextSubmission, now), 0);
+    BOOST_REQUIRE_EQUAL(nextSubmission.count("srm://a"), 1);
+    BOOST_CHECK(nextSubmission["srm://a"] == now + seconds(300));
+
+    // Still waiting
+    BOOST_CHECK_EQUAL(planStaging("srm://a", state, 0, config, nextSubmission, now + seconds(299)), 0);
+    BOOST_CHECK_EQUAL(nextSubmission.count("srm://a"), 1);
+
+    // Waited enough, go with what is there
+    BOOST_CHECK_EQUAL(planStaging("srm://a", state, 0, config, nextSubmission, now + seconds(301)), 100);
+    BOOST_CHECK_EQUAL(nextSubmission.count("srm://a"), 0);
+
+    // A full bulk does not wait
+    state.queued = 100;
+    BOOST_CHECK_EQUAL(planStaging("srm://b", state, 0, config, nextSubmission, now), 100);
+    BOOST_CHECK(nextSubmission.empty());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
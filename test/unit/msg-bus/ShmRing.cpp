@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/filesystem.hpp>
+
+#include <set>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "msg-bus/consumer.h"
+#include "msg-bus/producer.h"
+#include "msg-bus/ShmRing.h"
+
+using namespace fts3::events;
+
+
+BOOST_AUTO_TEST_SUITE(ShmRingTest)
+
+
+class ShmRingFixture {
+protected:
+    static const std::string TEST_PATH;
+
+public:
+    ShmRingFixture() {
+        boost::filesystem::create_directories(TEST_PATH);
+    }
+
+    ~ShmRingFixture() {
+        boost::filesystem::remove_all(TEST_PATH);
+    }
+};
+
+const std::string ShmRingFixture::TEST_PATH("/tmp/ShmRingTest");
+
+
+BOOST_FIXTURE_TEST_CASE (roundTrip, ShmRingFixture)
+{
+    const std::string path = TEST_PATH + "/test.ring";
+
+    ShmRing::configure(path, true, 16, 128);
+    std::unique_ptr<ShmRing> ring = ShmRing::open(path);
+    BOOST_REQUIRE(ring);
+    BOOST_CHECK(ring->isEnabled());
+
+    BOOST_CHECK(ring->push("first"));
+    BOOST_CHECK(ring->push("second"));
+    BOOST_CHECK(ring->push(""));
+
+    std::string payload;
+    BOOST_CHECK(ring->pop(payload));
+    BOOST_CHECK_EQUAL(payload, "first");
+    BOOST_CHECK(ring->pop(payload));
+    BOOST_CHECK_EQUAL(payload, "second");
+    BOOST_CHECK(ring->pop(payload));
+    BOOST_CHECK_EQUAL(payload, "");
+    BOOST_CHECK(!ring->pop(payload));
+
+    // Wrap around several times
+    for (int i = 0; i < 100; ++i) {
+        std::string msg = std::to_string(i);
+        BOOST_CHECK(ring->push(msg));
+        BOOST_CHECK(ring->pop(payload));
+        BOOST_CHECK_EQUAL(payload, msg);
+    }
+}
+
+
+BOOST_FIXTURE_TEST_CASE (fullAndOversized, ShmRingFixture)
+{
+    const std::string path = TEST_PATH + "/test.ring";
+
+    ShmRing::configure(path, true, 4, 64);
+    std::unique_ptr<ShmRing> ring = ShmRing::open(path);
+    BOOST_REQUIRE(ring);
+
+    BOOST_CHECK(!ring->push(std::string(ring->getMaxPayload() + 1, 'x')));
+    BOOST_CHECK(ring->push(std::string(ring->getMaxPayload(), 'x')));
+
+    for (int i = 0; i < 3; ++i) {
+        BOOST_CHECK(ring->push("msg"));
+    }
+    BOOST_CHECK(!ring->push("msg"));
+
+    std::string payload;
+    BOOST_CHECK(ring->pop(payload));
+    BOOST_CHECK(ring->push("msg"));
+}
+
+
+BOOST_FIXTURE_TEST_CASE (slowProducer, ShmRingFixture)
+{
+    const std::string path = TEST_PATH + "/test.ring";
+
+    ShmRing::configure(path, true, 4, 64);
+    std::unique_ptr<ShmRing> ring = ShmRing::open(path);
+    BOOST_REQUIRE(ring);
+    ring->setStaleSlotTimeout(1);
+
+    uint64_t late;
+    BOOST_REQUIRE(ring->reserve(4, late));
+
+    std::string payload;
+    BOOST_CHECK(!ring->pop(payload));
+    sleep(2);
+    BOOST_CHECK(!ring->pop(payload));
+
+    // The skipped slot must not be handed to another producer while the slow one may still write into it
+    for (int i = 0; i < 3; ++i) {
+        BOOST_CHECK(ring->push("msg" + std::to_string(i)));
+    }
+    BOOST_CHECK(!ring->push("overwritten"));
+
+    for (int i = 0; i < 3; ++i) {
+        BOOST_CHECK(ring->pop(payload));
+        BOOST_CHECK_EQUAL(payload, "msg" + std::to_string(i));
+    }
+    BOOST_CHECK(!ring->pop(payload));
+
+    // The slow producer is told its message was dropped, and gives the slot back
+    BOOST_CHECK(!ring->publish(late, "late"));
+    BOOST_CHECK(ring->push("next"));
+    BOOST_CHECK(ring->pop(payload));
+    BOOST_CHECK_EQUAL(payload, "next");
+    BOOST_CHECK(!ring->pop(payload));
+}
+
+
+BOOST_FIXTURE_TEST_CASE (deadProducer, ShmRingFixture)
+{
+    const std::string path = TEST_PATH + "/test.ring";
+
+    ShmRing::configure(path, true, 4, 64);
+    std::unique_ptr<ShmRing> ring = ShmRing::open(path);
+    BOOST_REQUIRE(ring);
+    ring->setStaleSlotTimeout(1);
+
+    pid_t child = fork();
+    BOOST_REQUIRE(child >= 0);
+    if (child == 0) {
+        uint64_t position;
+        std::unique_ptr<ShmRing> childRing = ShmRing::open(path);
+        _exit(childRing && childRing->reserve(4, position) ? 0 : 1);
+    }
+    int status = 0;
+    waitpid(child, &status, 0);
+    BOOST_REQUIRE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    std::string payload;
+    BOOST_CHECK(!ring->pop(payload));
+    sleep(2);
+    BOOST_CHECK(!ring->pop(payload));
+
+    // Nobody will give the slot back, so it is recycled right away
+    for (int i = 0; i < 4; ++i) {
+        BOOST_CHECK(ring->push("msg" + std::to_string(i)));
+    }
+    for (int i = 0; i < 4; ++i) {
+        BOOST_CHECK(ring->pop(payload));
+        BOOST_CHECK_EQUAL(payload, "msg" + std::to_string(i));
+    }
+}
+
+
+BOOST_FIXTURE_TEST_CASE (abandonedTimeout, ShmRingFixture)
+{
+    const std::string path = TEST_PATH + "/test.ring";
+
+    ShmRing::configure(path, true, 4, 64);
+    std::unique_ptr<ShmRing> ring = ShmRing::open(path);
+    BOOST_REQUIRE(ring);
+    ring->setStaleSlotTimeout(1);
+    ring->setAbandonedSlotTimeout(1);
+
+    // The owner looks alive forever (as if its pid had been reused), and never gives the slot back
+    uint64_t lost;
+    BOOST_REQUIRE(ring->reserve(4, lost));
+
+    std::string payload;
+    BOOST_CHECK(!ring->pop(payload));
+    sleep(2);
+    BOOST_CHECK(!ring->pop(payload));
+    for (int i = 0; i < 3; ++i) {
+        BOOST_CHECK(ring->push("msg" + std::to_string(i)));
+    }
+    BOOST_CHECK(!ring->push("full"));
+
+    // The consumer recycles it on its own
+    sleep(2);
+    for (int i = 0; i < 3; ++i) {
+        BOOST_CHECK(ring->pop(payload));
+        BOOST_CHECK_EQUAL(payload, "msg" + std::to_string(i));
+    }
+    BOOST_CHECK(ring->push("next"));
+
+    // If the owner ever shows up, it must not hand over a slot that is not its anymore
+    BOOST_CHECK(!ring->publish(lost, "late"));
+    BOOST_CHECK(ring->pop(payload));
+    BOOST_CHECK_EQUAL(payload, "next");
+    BOOST_CHECK(!ring->pop(payload));
+
+    // A new consumer also finds the slots skipped by the previous one
+    BOOST_REQUIRE(ring->reserve(4, lost));
+    BOOST_CHECK(!ring->pop(payload));
+    sleep(2);
+    BOOST_CHECK(!ring->pop(payload));
+    std::unique_ptr<ShmRing> restarted = ShmRing::open(path);
+    BOOST_REQUIRE(restarted);
+    restarted->setAbandonedSlotTimeout(0);
+    BOOST_CHECK(!restarted->pop(payload));
+    for (int i = 0; i < 4; ++i) {
+        BOOST_CHECK(restarted->push("msg" + std::to_string(i)));
+    }
+}
+
+
+BOOST_FIXTURE_TEST_CASE (disabled, ShmRingFixture)
+{
+    const std::string path = TEST_PATH + "/test.ring";
+
+    // Disabling a ring that does not exist must not create it
+    ShmRing::configure(path, false);
+    BOOST_CHECK(!boost::filesystem::exists(path));
+    BOOST_CHECK(!ShmRing::open(path));
+
+    ShmRing::configure(path, true, 16, 128);
+    std::unique_ptr<ShmRing> ring = ShmRing::open(path);
+    BOOST_REQUIRE(ring);
+    BOOST_CHECK(ring->push("before"));
+
+    // Already mapped rings see the change
+    ShmRing::configure(path, false);
+    BOOST_CHECK(!ring->isEnabled());
+    BOOST_CHECK(!ring->push("after"));
+
+    // But what was already there can still be consumed
+    std::string payload;
+    BOOST_CHECK(ring->pop(payload));
+    BOOST_CHECK_EQUAL(payload, "before");
+}
+
+
+BOOST_FIXTURE_TEST_CASE (spillToDirq, ShmRingFixture)
+{
+    ShmRing::configure(TEST_PATH + "/status.ring", true, 4, 1024);
+
+    Producer producer(TEST_PATH);
+    Consumer consumer(TEST_PATH);
+
+    std::set<uint64_t> expected;
+    for (uint64_t i = 0; i < 10; ++i) {
+        Message msg;
+        msg.set_job_id("1906cc40-b915-11e5-9a03-02163e006dd0");
+        msg.set_file_id(i);
+        msg.set_transfer_status("ACTIVE");
+        msg.set_source_se("mock://source");
+        msg.set_dest_se("mock://destination");
+        msg.set_process_id(0);
+        BOOST_CHECK_EQUAL(0, producer.runProducerStatus(msg));
+        expected.insert(i);
+    }
+
+    // Only 4 fit in the ring, the rest must have gone to dirq
+    std::unique_ptr<ShmRing> ring = ShmRing::open(TEST_PATH + "/status.ring");
+    BOOST_REQUIRE(ring);
+    BOOST_CHECK(!ring->push("full"));
+
+    std::vector<Message> statuses;
+    BOOST_CHECK_EQUAL(0, consumer.runConsumerStatus(statuses));
+    BOOST_CHECK_EQUAL(10, statuses.size());
+
+    std::set<uint64_t> received;
+    for (auto i = statuses.begin(); i != statuses.end(); ++i) {
+        received.insert(i->file_id());
+    }
+    BOOST_CHECK(expected == received);
+
+    statuses.clear();
+    BOOST_CHECK_EQUAL(0, consumer.runConsumerStatus(statuses));
+    BOOST_CHECK_EQUAL(0, statuses.size());
+}
+
+
+BOOST_FIXTURE_TEST_CASE (fairConsumer, ShmRingFixture)
+{
+    ShmRing::configure(TEST_PATH + "/status.ring", true, 4, 1024);
+    std::unique_ptr<ShmRing> ring = ShmRing::open(TEST_PATH + "/status.ring");
+    BOOST_REQUIRE(ring);
+
+    Producer producer(TEST_PATH);
+    Consumer consumer(TEST_PATH, 4);
+
+    Message msg;
+    msg.set_job_id("1906cc40-b915-11e5-9a03-02163e006dd0");
+    msg.set_transfer_status("ACTIVE");
+    msg.set_source_se("mock://source");
+    msg.set_dest_se("mock://destination");
+    msg.set_process_id(0);
+
+    // The first 4 fill the ring, the next 6 spill to dirq
+    for (uint64_t i = 0; i < 10; ++i) {
+        msg.set_file_id(i);
+        msg.set_timestamp(1000 + i);
+        BOOST_CHECK_EQUAL(0, producer.runProducerStatus(msg));
+    }
+    std::string payload;
+    while (ring->pop(payload));
+
+    // Newer messages find room in the ring again
+    for (uint64_t i = 10; i < 14; ++i) {
+        msg.set_file_id(i);
+        msg.set_timestamp(1000 + i);
+        BOOST_CHECK_EQUAL(0, producer.runProducerStatus(msg));
+    }
+
+    // Each source gets its share, and the older ones from dirq come first
+    std::vector<Message> statuses;
+    BOOST_CHECK_EQUAL(0, consumer.runConsumerStatus(statuses));
+    BOOST_REQUIRE_EQUAL(4, statuses.size());
+    BOOST_CHECK_EQUAL(4, statuses[0].file_id());
+    BOOST_CHECK_EQUAL(5, statuses[1].file_id());
+    BOOST_CHECK_EQUAL(10, statuses[2].file_id());
+    BOOST_CHECK_EQUAL(11, statuses[3].file_id());
+
+    // A source with nothing left gives its share to the other one
+    statuses.clear();
+    BOOST_CHECK_EQUAL(0, consumer.runConsumerStatus(statuses));
+    statuses.clear();
+    BOOST_CHECK_EQUAL(0, consumer.runConsumerStatus(statuses));
+    BOOST_REQUIRE_EQUAL(2, statuses.size());
+    for (auto i = statuses.begin(); i != statuses.end(); ++i) {
+        BOOST_CHECK_LT(i->file_id(), 10);
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,298 +18,17 @@
  * limitations under the License.
  */
 
-#include <boost/range/adaptor/map.hpp>
-#include <boost/range/algorithm/copy.hpp>
+#include <algorithm>
+#include <set>
 #include <boost/test/unit_test_suite.hpp>
 #include <boost/test/test_tools.hpp>
 
-#include "server/services/optimizer/Optimizer.h"
-#include "server/services/optimizer/OptimizerConstants.h"
-
-using namespace fts3::optimizer;
+#include "OptimizerFixture.h"
 
 BOOST_AUTO_TEST_SUITE(server)
 BOOST_AUTO_TEST_SUITE(OptimizerTestSuite)
 
 
-struct OptimizerEntry {
-    int activeDecision;
-    const PairState state;
-    int diff;
-    std::string rationale;
-
-    OptimizerEntry(int ad, const PairState &ps, int diff, const std::string &r):
-        activeDecision(ad), state(ps), diff(diff), rationale(r) {
-    }
-};
-typedef std::list<OptimizerEntry> OptimizerRegister;
-
-
-struct MockTransfer {
-    time_t start, end;
-    std::string state;
-    uint64_t filesize;
-    double throughput;
-    bool recoverable;
-    int numRetries;
-
-    MockTransfer(time_t start, time_t end, const std::string &state,
-        uint64_t filesize, double throughput, bool recoverable):
-        start(start), end(end), state(state), filesize(filesize), throughput(throughput), recoverable(recoverable),
-        numRetries(0) {
-    }
-};
-typedef std::list<MockTransfer> TransferList;
-
-class BaseOptimizerFixture: public OptimizerDataSource, public Optimizer {
-protected:
-    std::map<Pair, OptimizerRegister> registry;
-    std::map<Pair, int> streamsRegistry;
-    std::map<Pair, TransferList> transferStore;
-    OptimizerMode mockOptimizerMode;
-
-    void populateTransfers(const Pair &pair, const std::string &state, int count,
-        bool recoverable = false, double thr = 10, uint64_t filesize = 1024) {
-        auto &transfers = transferStore[pair];
-
-        for (int i = 0; i < count; i++) {
-            time_t start = 0, end = 0;
-            if (state != "SUBMITTED" && state != "ACTIVE") {
-                end = time(NULL) - count;
-            }
-            if (state != "SUBMITTED") {
-                start = time(NULL) - count - 60;
-            }
-
-            transfers.emplace_back(start, end, state, filesize, thr, recoverable);
-        }
-    }
-
-    void removeTransfers(const Pair &pair, const std::string &state, int count) {
-        auto &transfers = transferStore[pair];
-        for (auto i = transfers.begin(); i != transfers.end();) {
-            if (i->state == state && count > 0) {
-                i = transfers.erase(i);
-                --count;
-            }
-            else {
-                ++i;
-            }
-        }
-    }
-
-    OptimizerEntry* getLastEntry(const Pair &pair) {
-        if (registry[pair].size()) {
-            return &registry[pair].back();
-        }
-        return NULL;
-    }
-
-    void setOptimizerValue(const Pair &pair, int value) {
-        registry[pair].emplace_back(value, PairState(), value, "Patched");
-    }
-
-public:
-    BaseOptimizerFixture(): Optimizer(this, NULL) {
-        mockOptimizerMode = kOptimizerDisabled;
-    }
-
-    std::list<Pair> getActivePairs(void) {
-        std::list<Pair> pairs;
-        boost::copy(transferStore | boost::adaptors::map_keys, std::back_inserter(pairs));
-        return pairs;
-    }
-
-    OptimizerMode getOptimizerMode(const std::string&, const std::string&) {
-        return mockOptimizerMode;
-    }
-
-    bool isRetryEnabled(void) {
-        return false;
-    }
-
-    void getPairLimits(const Pair&, Range *range, StorageLimits *limits) {
-        range->min = range->max = 0;
-        limits->destination = limits->source = 200;
-        limits->throughputDestination = limits->throughputSource = 0;
-    }
-
-    int getOptimizerValue(const Pair &pair) {
-        auto i = registry.find(pair);
-        if (i == registry.end() || i->second.empty()) {
-            return 0;
-        }
-        return i->second.back().activeDecision;
-    }
-
-    void getThroughputInfo(const Pair &pair, const boost::posix_time::time_duration &interval,
-        double *throughput, double *filesizeAvg, double *filesizeStdDev)
-    {
-        *throughput = *filesizeAvg = *filesizeStdDev = 0;
-
-        auto tsi = transferStore.find(pair);
-        if (tsi == transferStore.end()) {
-            return;
-        }
-
-        auto &transfers = tsi->second;
-
-        double acc = 0;
-        double totalSize = 0;
-        time_t notBefore = time(NULL) - interval.total_seconds();
-
-        for (auto i = transfers.begin(); i != transfers.end(); ++i) {
-            if (i->state == "ACTIVE" || (i->state == "FINISHED" && i->end >= notBefore)) {
-                totalSize += i->filesize;
-                acc += i->throughput * i->filesize;
-            }
-        }
-
-        if (totalSize > 0 && transfers.size() > 0) {
-            *throughput = acc / totalSize;
-            *filesizeAvg = totalSize / transfers.size();
-        }
-
-        return;
-    }
-
-    time_t getAverageDuration(const Pair &pair, const boost::posix_time::time_duration &interval) {
-        auto tsi = transferStore.find(pair);
-        if (tsi == transferStore.end()) {
-            return 0;
-        }
-
-        auto &transfers = tsi->second;
-
-        time_t acc = 0;
-        int counter = 0;
-        time_t notBefore = time(NULL) - interval.total_seconds();
-
-        for (auto i = transfers.begin(); i != transfers.end(); ++i) {
-            if (i->end >= notBefore) {
-                ++counter;
-                acc += (i->end - i->start);
-            }
-        }
-
-        if (counter == 0) {
-            return 0;
-        }
-        return acc / counter;
-    }
-
-    double getSuccessRateForPair(const Pair &pair, const boost::posix_time::time_duration &interval, int *retryCount) {
-        auto tsi = transferStore.find(pair);
-        if (tsi == transferStore.end()) {
-            return 0;
-        }
-
-        auto &transfers = tsi->second;
-
-        int nFailedLastHour = 0;
-        int nFinishedLastHour = 0;
-        time_t notBefore = time(NULL) - interval.total_seconds();
-
-        *retryCount = 0;
-        for (auto i = transfers.begin(); i != transfers.end(); ++i) {
-            if (i->end >= notBefore) {
-                if (i->state == "FAILED" && i->recoverable) {
-                    ++nFailedLastHour;
-                }
-                else if (i->state == "FINISHED") {
-                    ++nFinishedLastHour;
-                }
-                *retryCount += i->numRetries;
-            }
-        }
-
-        if (nFinishedLastHour > 0) {
-            return ceil((nFinishedLastHour * 100.0) / (nFinishedLastHour + nFailedLastHour));
-        }
-        else {
-            return 0.0;
-        }
-    }
-
-    int getActive(const Pair &pair) {
-        auto tsi = transferStore.find(pair);
-        if (tsi == transferStore.end()) {
-            return 0;
-        }
-
-        auto &transfers = tsi->second;
-
-        int counter = 0;
-        for (auto i = transfers.begin(); i != transfers.end(); ++i) {
-            if (i->state == "ACTIVE") {
-                ++counter;
-            }
-        }
-        return counter;
-    }
-
-    int getSubmitted(const Pair &pair) {
-        auto tsi = transferStore.find(pair);
-        if (tsi == transferStore.end()) {
-            return 0;
-        }
-
-        auto &transfers = tsi->second;
-
-        int counter = 0;
-        for (auto i = transfers.begin(); i != transfers.end(); ++i) {
-            if (i->state == "SUBMITTED") {
-                ++counter;
-            }
-        }
-        return counter;
-    }
-
-    double getThroughputAsSource(const std::string &storage) {
-        double acc = 0;
-
-        for (auto i = transferStore.begin(); i != transferStore.end(); ++i) {
-            if (i->first.source == storage) {
-                auto &transfers = i->second;
-
-                for (auto j = transfers.begin(); j != transfers.end(); ++j) {
-                    if (j->state == "ACTIVE") {
-                        acc += j->throughput;
-                    }
-                }
-            }
-        }
-        return acc;
-    }
-
-    double getThroughputAsDestination(const std::string &storage) {
-        double acc = 0;
-
-        for (auto i = transferStore.begin(); i != transferStore.end(); ++i) {
-            if (i->first.destination == storage) {
-                auto &transfers = i->second;
-
-                for (auto j = transfers.begin(); j != transfers.end(); ++j) {
-                    if (j->state == "ACTIVE") {
-                        acc += j->throughput;
-                    }
-                }
-            }
-        }
-        return acc;
-    }
-
-    void storeOptimizerDecision(const Pair &pair, int activeDecision,
-        const PairState &newState, int diff, const std::string &rationale) {
-        registry[pair].push_back(OptimizerEntry(activeDecision, newState, diff, rationale));
-    }
-
-    void storeOptimizerStreams(const Pair &pair, int streams) {
-        streamsRegistry[pair] = streams;
-    }
-};
-
-
 // Working range for a non configured storage
 BOOST_FIXTURE_TEST_CASE (optimizerRangeAllDefaults, BaseOptimizerFixture)
 {
@@ -611,6 +330,114 @@ BOOST_FIXTURE_TEST_CASE (optimizerMaxStreams, BaseOptimizerFixture)
     BOOST_CHECK_LE(streamsRegistry[pair], maxNumberOfStreams);
 }
 
+// The data source gets a chance to load all pairs in bulk before the run, and
+// to drop what it loaded after
+class OptimizerPrefetchFixture: public BaseOptimizerFixture {
+public:
+    std::list<Pair> prefetchedPairs;
+    std::vector<boost::posix_time::time_duration> prefetchedTimeFrames;
+    bool prefetchedWithTerminal;
+    int nPrefetch, nClear;
+
+    OptimizerPrefetchFixture(): prefetchedWithTerminal(false), nPrefetch(0), nClear(0) {}
+
+    void prefetch(const std::list<Pair> &pairs, const std::vector<boost::posix_time::time_duration> &timeFrames,
+        bool withTerminal) {
+        ++nPrefetch;
+        prefetchedPairs = pairs;
+        prefetchedTimeFrames = timeFrames;
+        prefetchedWithTerminal = withTerminal;
+    }
+
+    void clearPrefetched(void) {
+        ++nClear;
+    }
+};
+
+BOOST_FIXTURE_TEST_CASE (optimizerPrefetch, OptimizerPrefetchFixture)
+{
+    const Pair pair1("mock://dpm.cern.ch", "mock://dcache.desy.de");
+    const Pair pair2("mock://cern.ch", "mock://fnal.gov");
+
+    populateTransfers(pair1, "ACTIVE", 20);
+    populateTransfers(pair2, "ACTIVE", 20);
+
+    run();
+
+    BOOST_CHECK_EQUAL(nPrefetch, 1);
+    BOOST_CHECK_EQUAL(nClear, 1);
+    BOOST_CHECK_EQUAL(prefetchedPairs.size(), 2);
+    BOOST_CHECK(prefetchedWithTerminal);
+
+    // All the time frames the optimizer may use must be there
+    std::set<long> seconds;
+    for (auto i = prefetchedTimeFrames.begin(); i != prefetchedTimeFrames.end(); ++i) {
+        seconds.insert(i->total_seconds());
+    }
+    BOOST_CHECK(seconds.count(SHORT_TIME_FRAME));
+    BOOST_CHECK(seconds.count(MEDIUM_TIME_FRAME));
+    BOOST_CHECK(seconds.count(LONG_TIME_FRAME));
+
+    // Both pairs got a decision
+    BOOST_CHECK(getLastEntry(pair1) != NULL);
+    BOOST_CHECK(getLastEntry(pair2) != NULL);
+}
+
+// Decisions are flushed once per run, after all of them are stored
+class OptimizerFlushFixture: public BaseOptimizerFixture {
+public:
+    int nStored;
+    std::vector<int> storedAtFlush;
+
+    OptimizerFlushFixture(): nStored(0) {}
+
+    void storeOptimizerDecision(const Pair &pair, int activeDecision,
+        const PairState &newState, int diff, const std::string &rationale) {
+        ++nStored;
+        BaseOptimizerFixture::storeOptimizerDecision(pair, activeDecision, newState, diff, rationale);
+    }
+
+    void flushDecisions(void) {
+        storedAtFlush.push_back(nStored);
+    }
+};
+
+BOOST_FIXTURE_TEST_CASE (optimizerFlush, OptimizerFlushFixture)
+{
+    populateTransfers(Pair("mock://cern.ch", "mock://fnal.gov"), "ACTIVE", 20);
+    populateTransfers(Pair("mock://cern.ch", "mock://desy.de"), "ACTIVE", 20);
+    populateTransfers(Pair("mock://dpm.cern.ch", "mock://desy.de"), "ACTIVE", 20);
+
+    run();
+    BOOST_REQUIRE_EQUAL(storedAtFlush.size(), 1);
+    BOOST_CHECK_EQUAL(storedAtFlush.back(), 3);
+
+    run();
+    BOOST_REQUIRE_EQUAL(storedAtFlush.size(), 2);
+    BOOST_CHECK_EQUAL(storedAtFlush.back(), nStored);
+}
+
+// The decisions, and the order they are stored, do not depend on the number of workers
+BOOST_AUTO_TEST_CASE (optimizerParallelDeterministic)
+{
+    OptimizerLatencyFixture sequential, parallel;
+    sequential.populate(64);
+    parallel.populate(64);
+    parallel.setWorkers(8);
+
+    for (int round = 0; round < 3; ++round) {
+        sequential.run();
+        parallel.run();
+    }
+
+    BOOST_CHECK(!parallel.committed.empty());
+    BOOST_CHECK(parallel.getHistory() == sequential.getHistory());
+
+    // The first run decides for every pair, in sorted order
+    BOOST_REQUIRE_GE(parallel.committed.size(), 64);
+    BOOST_CHECK(std::is_sorted(parallel.committed.begin(), parallel.committed.begin() + 64));
+}
+
 // NOTE: I am not sure it is worth to add more tests. At the end, we will basically be
 //       writing tests that set the parameters to fit the implementation at the time.
 //       They do not prove that the optimizer optimizes.
@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef OPTIMIZERFIXTURE_H
+#define OPTIMIZERFIXTURE_H
+
+#include <algorithm>
+#include <chrono>
+#include <list>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/range/adaptor/map.hpp>
+#include <boost/range/algorithm/copy.hpp>
+
+#include "server/services/optimizer/Optimizer.h"
+#include "server/services/optimizer/OptimizerConstants.h"
+
+using namespace fts3::optimizer;
+
+
+/// Optimizer running over an in-memory data source
+struct OptimizerEntry {
+    int activeDecision;
+    const PairState state;
+    int diff;
+    std::string rationale;
+
+    OptimizerEntry(int ad, const PairState &ps, int diff, const std::string &r):
+        activeDecision(ad), state(ps), diff(diff), rationale(r) {
+    }
+};
+typedef std::list<OptimizerEntry> OptimizerRegister;
+
+
+struct MockTransfer {
+    time_t start, end;
+    std::string state;
+    uint64_t filesize;
+    double throughput;
+    bool recoverable;
+    int numRetries;
+
+    MockTransfer(time_t start, time_t end, const std::string &state,
+        uint64_t filesize, double throughput, bool recoverable):
+        start(start), end(end), state(state), filesize(filesize), throughput(throughput), recoverable(recoverable),
+        numRetries(0) {
+    }
+};
+typedef std::list<MockTransfer> TransferList;
+
+class BaseOptimizerFixture: public OptimizerDataSource, public Optimizer {
+protected:
+    std::map<Pair, OptimizerRegister> registry;
+    std::map<Pair, int> streamsRegistry;
+    std::map<Pair, TransferList> transferStore;
+    OptimizerMode mockOptimizerMode;
+
+    void populateTransfers(const Pair &pair, const std::string &state, int count,
+        bool recoverable = false, double thr = 10, uint64_t filesize = 1024) {
+        auto &transfers = transferStore[pair];
+
+        for (int i = 0; i < count; i++) {
+            time_t start = 0, end = 0;
+            if (state != "SUBMITTED" && state != "ACTIVE") {
+                end = time(NULL) - count;
+            }
+            if (state != "SUBMITTED") {
+                start = time(NULL) - count - 60;
+            }
+
+            transfers.emplace_back(start, end, state, filesize, thr, recoverable);
+        }
+    }
+
+    void removeTransfers(const Pair &pair, const std::string &state, int count) {
+        auto &transfers = transferStore[pair];
+        for (auto i = transfers.begin(); i != transfers.end();) {
+            if (i->state == state && count > 0) {
+                i = transfers.erase(i);
+                --count;
+            }
+            else {
+                ++i;
+            }
+        }
+    }
+
+    OptimizerEntry* getLastEntry(const Pair &pair) {
+        if (registry[pair].size()) {
+            return &registry[pair].back();
+        }
+        return NULL;
+    }
+
+    void setOptimizerValue(const Pair &pair, int value) {
+        registry[pair].emplace_back(value, PairState(), value, "Patched");
+    }
+
+public:
+    BaseOptimizerFixture(): Optimizer(this, NULL) {
+        mockOptimizerMode = kOptimizerDisabled;
+    }
+
+    std::list<Pair> getActivePairs(void) {
+        std::list<Pair> pairs;
+        boost::copy(transferStore | boost::adaptors::map_keys, std::back_inserter(pairs));
+        return pairs;
+    }
+
+    OptimizerMode getOptimizerMode(const std::string&, const std::string&) {
+        return mockOptimizerMode;
+    }
+
+    bool isRetryEnabled(void) {
+        return false;
+    }
+
+    void getPairLimits(const Pair&, Range *range, StorageLimits *limits) {
+        range->min = range->max = 0;
+        limits->destination = limits->source = 200;
+        limits->throughputDestination = limits->throughputSource = 0;
+    }
+
+    int getOptimizerValue(const Pair &pair) {
+        auto i = registry.find(pair);
+        if (i == registry.end() || i->second.empty()) {
+            return 0;
+        }
+        return i->second.back().activeDecision;
+    }
+
+    void getThroughputInfo(const Pair &pair, const boost::posix_time::time_duration &interval,
+        double *throughput, double *filesizeAvg, double *filesizeStdDev)
+    {
+        *throughput = *filesizeAvg = *filesizeStdDev = 0;
+
+        auto tsi = transferStore.find(pair);
+        if (tsi == transferStore.end()) {
+            return;
+        }
+
+        auto &transfers = tsi->second;
+
+        double acc = 0;
+        double totalSize = 0;
+        time_t notBefore = time(NULL) - interval.total_seconds();
+
+        for (auto i = transfers.begin(); i != transfers.end(); ++i) {
+            if (i->state == "ACTIVE" || (i->state == "FINISHED" && i->end >= notBefore)) {
+                totalSize += i->filesize;
+                acc += i->throughput * i->filesize;
+            }
+        }
+
+        if (totalSize > 0 && transfers.size() > 0) {
+            *throughput = acc / totalSize;
+            *filesizeAvg = totalSize / transfers.size();
+        }
+
+        return;
+    }
+
+    time_t getAverageDuration(const Pair &pair, const boost::posix_time::time_duration &interval) {
+        auto tsi = transferStore.find(pair);
+        if (tsi == transferStore.end()) {
+            return 0;
+        }
+
+        auto &transfers = tsi->second;
+
+        time_t acc = 0;
+        int counter = 0;
+        time_t notBefore = time(NULL) - interval.total_seconds();
+
+        for (auto i = transfers.begin(); i != transfers.end(); ++i) {
+            if (i->end >= notBefore) {
+                ++counter;
+                acc += (i->end - i->start);
+            }
+        }
+
+        if (counter == 0) {
+            return 0;
+        }
+        return acc / counter;
+    }
+
+    double getSuccessRateForPair(const Pair &pair, const boost::posix_time::time_duration &interval, int *retryCount) {
+        auto tsi = transferStore.find(pair);
+        if (tsi == transferStore.end()) {
+            return 0;
+        }
+
+        auto &transfers = tsi->second;
+
+        int nFailedLastHour = 0;
+        int nFinishedLastHour = 0;
+        time_t notBefore = time(NULL) - interval.total_seconds();
+
+        *retryCount = 0;
+        for (auto i = transfers.begin(); i != transfers.end(); ++i) {
+            if (i->end >= notBefore) {
+                if (i->state == "FAILED" && i->recoverable) {
+                    ++nFailedLastHour;
+                }
+                else if (i->state == "FINISHED") {
+                    ++nFinishedLastHour;
+                }
+                *retryCount += i->numRetries;
+            }
+        }
+
+        if (nFinishedLastHour > 0) {
+            return ceil((nFinishedLastHour * 100.0) / (nFinishedLastHour + nFailedLastHour));
+        }
+        else {
+            return 0.0;
+        }
+    }
+
+    int getActive(const Pair &pair) {
+        auto tsi = transferStore.find(pair);
+        if (tsi == transferStore.end()) {
+            return 0;
+        }
+
+        auto &transfers = tsi->second;
+
+        int counter = 0;
+        for (auto i = transfers.begin(); i != transfers.end(); ++i) {
+            if (i->state == "ACTIVE") {
+                ++counter;
+            }
+        }
+        return counter;
+    }
+
+    int getSubmitted(const Pair &pair) {
+        auto tsi = transferStore.find(pair);
+        if (tsi == transferStore.end()) {
+            return 0;
+        }
+
+        auto &transfers = tsi->second;
+
+        int counter = 0;
+        for (auto i = transfers.begin(); i != transfers.end(); ++i) {
+            if (i->state == "SUBMITTED") {
+                ++counter;
+            }
+        }
+        return counter;
+    }
+
+    double getThroughputAsSource(const std::string &storage) {
+        double acc = 0;
+
+        for (auto i = transferStore.begin(); i != transferStore.end(); ++i) {
+            if (i->first.source == storage) {
+                auto &transfers = i->second;
+
+                for (auto j = transfers.begin(); j != transfers.end(); ++j) {
+                    if (j->state == "ACTIVE") {
+                        acc += j->throughput;
+                    }
+                }
+            }
+        }
+        return acc;
+    }
+
+    double getThroughputAsDestination(const std::string &storage) {
+        double acc = 0;
+
+        for (auto i = transferStore.begin(); i != transferStore.end(); ++i) {
+            if (i->first.destination == storage) {
+                auto &transfers = i->second;
+
+                for (auto j = transfers.begin(); j != transfers.end(); ++j) {
+                    if (j->state == "ACTIVE") {
+                        acc += j->throughput;
+                    }
+                }
+            }
+        }
+        return acc;
+    }
+
+    void storeOptimizerDecision(const Pair &pair, int activeDecision,
+        const PairState &newState, int diff, const std::string &rationale) {
+        registry[pair].push_back(OptimizerEntry(activeDecision, newState, diff, rationale));
+    }
+
+    void storeOptimizerStreams(const Pair &pair, int streams) {
+        streamsRegistry[pair] = streams;
+    }
+};
+
+
+// Each read waits for a fixed latency, as a remote database would
+class OptimizerLatencyFixture: public BaseOptimizerFixture {
+public:
+    std::chrono::microseconds latency;
+    std::vector<Pair> committed;
+
+    OptimizerLatencyFixture(std::chrono::microseconds latency = std::chrono::microseconds(0)): latency(latency) {}
+
+    void populate(unsigned nPairs) {
+        for (unsigned i = 0; i < nPairs; ++i) {
+            const Pair pair("mock://source" + std::to_string(i % 7) + ".cern.ch",
+                "mock://destination" + std::to_string(i) + ".cern.ch");
+            populateTransfers(pair, "FINISHED", 50, false, 10 + i % 3);
+            populateTransfers(pair, "FAILED", i % 4, true);
+            populateTransfers(pair, "ACTIVE", 10 + i % 5);
+            populateTransfers(pair, "SUBMITTED", 100);
+        }
+    }
+
+    void wait() {
+        std::this_thread::sleep_for(latency);
+    }
+
+    int getOptimizerValue(const Pair &pair) {
+        wait();
+        return BaseOptimizerFixture::getOptimizerValue(pair);
+    }
+
+    void getThroughputInfo(const Pair &pair, const boost::posix_time::time_duration &interval,
+        double *throughput, double *filesizeAvg, double *filesizeStdDev) {
+        wait();
+        BaseOptimizerFixture::getThroughputInfo(pair, interval, throughput, filesizeAvg, filesizeStdDev);
+    }
+
+    time_t getAverageDuration(const Pair &pair, const boost::posix_time::time_duration &interval) {
+        wait();
+        return BaseOptimizerFixture::getAverageDuration(pair, interval);
+    }
+
+    double getSuccessRateForPair(const Pair &pair, const boost::posix_time::time_duration &interval,
+        int *retryCount) {
+        wait();
+        return BaseOptimizerFixture::getSuccessRateForPair(pair, interval, retryCount);
+    }
+
+    int getActive(const Pair &pair) {
+        wait();
+        return BaseOptimizerFixture::getActive(pair);
+    }
+
+    int getSubmitted(const Pair &pair) {
+        wait();
+        return BaseOptimizerFixture::getSubmitted(pair);
+    }
+
+    void storeOptimizerDecision(const Pair &pair, int activeDecision,
+        const PairState &newState, int diff, const std::string &rationale) {
+        committed.push_back(pair);
+        BaseOptimizerFixture::storeOptimizerDecision(pair, activeDecision, newState, diff, rationale);
+    }
+
+    // Decisions and rationales, in the order they were committed
+    std::vector<std::string> getHistory() {
+        std::vector<std::string> history;
+        for (auto i = committed.begin(); i != committed.end(); ++i) {
+            auto entry = getLastEntry(*i);
+            std::ostringstream msg;
+            msg << *i << " " << entry->activeDecision << " " << entry->diff << " " << entry->rationale
+                << " " << streamsRegistry[*i];
+            history.push_back(msg.str());
+        }
+        return history;
+    }
+};
+
+#endif // OPTIMIZERFIXTURE_H
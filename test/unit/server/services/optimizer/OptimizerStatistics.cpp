@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cmath>
+#include <random>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include "server/services/optimizer/OptimizerStatistics.h"
+
+using namespace fts3::optimizer;
+
+BOOST_AUTO_TEST_SUITE(server)
+BOOST_AUTO_TEST_SUITE(OptimizerStatisticsTestSuite)
+
+
+// Only serves terminal transfers, and fixed values for the rest
+class MockTerminalDataSource: public OptimizerDataSource {
+public:
+    std::vector<std::pair<Pair, TerminalTransfer>> transfers;
+
+    std::list<Pair> getActivePairs(void) { return std::list<Pair>(); }
+    OptimizerMode getOptimizerMode(const std::string&, const std::string&) { return kOptimizerNormal; }
+    void getPairLimits(const Pair&, Range*, StorageLimits*) {}
+    int getOptimizerValue(const Pair&) { return 0; }
+
+    void getThroughputInfo(const Pair&, const boost::posix_time::time_duration&,
+        double *throughput, double *filesizeAvg, double *filesizeStdDev) {
+        *throughput = *filesizeAvg = *filesizeStdDev = -1;
+    }
+
+    time_t getAverageDuration(const Pair&, const boost::posix_time::time_duration&) { return -1; }
+
+    double getSuccessRateForPair(const Pair&, const boost::posix_time::time_duration&, int *retryCount) {
+        *retryCount = -1;
+        return -1;
+    }
+
+    void getTerminalTransfers(const boost::posix_time::time_duration&,
+        const std::function<void(const Pair&, const TerminalTransfer&)> &callback) {
+        for (auto i = transfers.begin(); i != transfers.end(); ++i) {
+            callback(i->first, i->second);
+        }
+    }
+
+    int getActive(const Pair&) { return 0; }
+    int getSubmitted(const Pair&) { return 0; }
+    double getThroughputAsSource(const std::string&) { return 0; }
+    double getThroughputAsDestination(const std::string&) { return 0; }
+    void storeOptimizerDecision(const Pair&, int, const PairState&, int, const std::string&) {}
+    void storeOptimizerStreams(const Pair&, int) {}
+};
+
+
+static TerminalTransfer makeTransfer(const std::string &state, time_t start, time_t end, int64_t filesize,
+    bool recoverable = false, int retry = 0)
+{
+    TerminalTransfer transfer;
+    transfer.state = state;
+    transfer.start = start;
+    transfer.end = end;
+    transfer.filesize = filesize;
+    transfer.duration = end - start;
+    transfer.recoverable = recoverable;
+    transfer.retry = retry;
+    return transfer;
+}
+
+
+// The streaming statistics must give the same values the database queries do
+// for a time frame aligned with the buckets
+BOOST_AUTO_TEST_CASE (matchesDatabase)
+{
+    const Pair pair("mock://source", "mock://destination");
+    const time_t now = 1500000000;
+    const long timeFrames[] = {SHORT_TIME_FRAME, MEDIUM_TIME_FRAME, LONG_TIME_FRAME};
+    const char *states[] = {"FINISHED", "ARCHIVING", "FAILED", "SUBMITTED", "CANCELED"};
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<time_t> endDistribution(now - LONG_TIME_FRAME - 300, now);
+    std::uniform_int_distribution<time_t> durationDistribution(0, 2 * LONG_TIME_FRAME);
+    std::uniform_int_distribution<int64_t> filesizeDistribution(0, 10LL * 1024 * 1024 * 1024);
+    std::uniform_int_distribution<int> stateDistribution(0, 4);
+    std::uniform_int_distribution<int> retryDistribution(0, 3);
+
+    OptimizerStatistics statistics;
+    std::vector<TerminalTransfer> transfers;
+
+    while (transfers.size() < 5000) {
+        time_t end = endDistribution(generator);
+        // The database compares the finish time with >= or > depending on the metric.
+        // The buckets can not tell the difference on the boundary.
+        if (end == now - SHORT_TIME_FRAME || end == now - MEDIUM_TIME_FRAME || end == now - LONG_TIME_FRAME) {
+            continue;
+        }
+        int retry = retryDistribution(generator);
+        TerminalTransfer transfer = makeTransfer(states[stateDistribution(generator)],
+            end - durationDistribution(generator), end, filesizeDistribution(generator), retry % 2, retry);
+        transfers.push_back(transfer);
+        statistics.record(pair, transfer);
+    }
+
+    for (size_t i = 0; i < 3; ++i) {
+        WindowStatistics expected;
+        for (auto t = transfers.begin(); t != transfers.end(); ++t) {
+            expected.addTerminal(*t, now - timeFrames[i], now);
+        }
+
+        WindowStatistics got;
+        statistics.get(pair, boost::posix_time::seconds(timeFrames[i]), now, &got);
+
+        BOOST_CHECK_CLOSE(got.bytes, expected.bytes, 0.0001);
+        BOOST_CHECK_EQUAL(got.nFiles, expected.nFiles);
+        BOOST_CHECK_CLOSE(got.filesizeMean, expected.filesizeMean, 0.0001);
+        BOOST_CHECK_CLOSE(got.getFilesizeStdDev(), expected.getFilesizeStdDev(), 0.0001);
+        BOOST_CHECK_CLOSE(got.durationSum, expected.durationSum, 0.0001);
+        BOOST_CHECK_EQUAL(got.nDurations, expected.nDurations);
+        BOOST_CHECK_EQUAL(got.nFinished, expected.nFinished);
+        BOOST_CHECK_EQUAL(got.nFailed, expected.nFailed);
+        BOOST_CHECK_EQUAL(got.retryCount, expected.retryCount);
+        BOOST_CHECK_EQUAL(got.getSuccessRate(), expected.getSuccessRate());
+    }
+
+    // Other pairs are not affected
+    WindowStatistics other;
+    statistics.get(Pair("mock://source", "mock://other"), boost::posix_time::seconds(LONG_TIME_FRAME), now, &other);
+    BOOST_CHECK_EQUAL(other.nFinished, 0);
+    BOOST_CHECK_EQUAL(other.bytes, 0);
+}
+
+
+// A row of t_file, as getSuccessRateForPair reads it
+struct FileRow {
+    std::string state;
+    int retry;
+    bool recoverable;
+    time_t finishTime;
+};
+
+
+// Reference success rate, following the query and classification of the database data source
+static double querySuccessRate(const std::vector<FileRow> &rows, time_t windowStart, int *retryCount)
+{
+    int nFailed = 0, nFinished = 0;
+    *retryCount = 0;
+    for (auto i = rows.begin(); i != rows.end(); ++i) {
+        if (i->finishTime <= windowStart || i->state == "NOT_USED") {
+            continue;
+        }
+        if (i->state == "FAILED" && i->recoverable) {
+            ++nFailed;
+        }
+        else if (i->state == "SUBMITTED" && i->retry) {
+            ++nFailed;
+            *retryCount += i->retry;
+        }
+        else if (i->state == "FINISHED" || i->state == "ARCHIVING") {
+            ++nFinished;
+        }
+    }
+    int nTotal = nFinished + nFailed;
+    if (nTotal > 0) {
+        return ceil((nFinished * 100.0) / nTotal);
+    }
+    return 100.0;
+}
+
+
+// Completion messages, including the failures that are retried, must give the success rate
+// and retry count the database query gives on the rows they leave behind
+BOOST_AUTO_TEST_CASE (successRateMatchesQuery)
+{
+    const Pair pair("mock://source", "mock://destination");
+    const time_t now = 1500000000;
+    const long timeFrames[] = {SHORT_TIME_FRAME, MEDIUM_TIME_FRAME, LONG_TIME_FRAME};
+
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<time_t> endDistribution(now - LONG_TIME_FRAME - 300, now);
+    std::uniform_int_distribution<int> outcomeDistribution(0, 3);
+    std::uniform_int_distribution<int> retryDistribution(1, 3);
+
+    MockTerminalDataSource database;
+    OptimizerStatistics statistics;
+    statistics.rebuild(&database);
+
+    std::vector<FileRow> rows;
+    while (rows.size() < 5000) {
+        time_t end = endDistribution(generator);
+        if (end == now - SHORT_TIME_FRAME || end == now - MEDIUM_TIME_FRAME || end == now - LONG_TIME_FRAME) {
+            continue;
+        }
+
+        fts3::events::Message msg;
+        msg.set_job_id("1906cc40-b915-11e5-9a03-02163e006dd0");
+        msg.set_file_id(rows.size() + 1);
+        msg.set_source_se(pair.source);
+        msg.set_dest_se(pair.destination);
+        msg.set_timestamp(end * 1000);
+        msg.set_time_in_secs(10);
+        msg.set_filesize(1000);
+
+        FileRow row;
+        row.finishTime = end;
+        row.retry = 0;
+
+        switch (outcomeDistribution(generator)) {
+            case 0:
+                msg.set_transfer_status("FINISHED");
+                row.state = "FINISHED";
+                row.recoverable = false;
+                statistics.record(msg);
+                break;
+            case 1:
+                msg.set_transfer_status("FAILED");
+                msg.set_retry(true);
+                row.state = "FAILED";
+                row.recoverable = true;
+                statistics.record(msg);
+                break;
+            case 2:
+                msg.set_transfer_status("FAILED");
+                msg.set_retry(false);
+                row.state = "FAILED";
+                row.recoverable = false;
+                statistics.record(msg);
+                break;
+            default:
+                // What MessageProcessingService does when the job allows another attempt
+                msg.set_transfer_status("FAILED");
+                msg.set_retry(true);
+                row.state = "SUBMITTED";
+                row.recoverable = true;
+                row.retry = retryDistribution(generator);
+                statistics.recordRetry(msg, row.retry);
+        }
+        rows.push_back(row);
+    }
+
+    for (size_t i = 0; i < 3; ++i) {
+        int expectedRetries = 0;
+        double expected = querySuccessRate(rows, now - timeFrames[i], &expectedRetries);
+
+        WindowStatistics got;
+        statistics.get(pair, boost::posix_time::seconds(timeFrames[i]), now, &got);
+
+        BOOST_CHECK_EQUAL(got.getSuccessRate(), expected);
+        BOOST_CHECK_EQUAL(got.retryCount, expectedRetries);
+        BOOST_CHECK_LT(expected, 100);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE (expire)
+{
+    const Pair pair("mock://source", "mock://destination");
+    const time_t now = 1500000000;
+
+    OptimizerStatistics statistics;
+    statistics.record(pair, makeTransfer("FINISHED", now - LONG_TIME_FRAME, now - LONG_TIME_FRAME + 50, 1000));
+    statistics.record(pair, makeTransfer("FINISHED", now - 100, now - 50, 1000));
+
+    WindowStatistics beforeExpire;
+    statistics.get(pair, boost::posix_time::seconds(LONG_TIME_FRAME), now, &beforeExpire);
+    BOOST_CHECK_EQUAL(beforeExpire.nFinished, 2);
+
+    statistics.expire(now + 100);
+
+    WindowStatistics afterExpire;
+    statistics.get(pair, boost::posix_time::seconds(2 * LONG_TIME_FRAME), now, &afterExpire);
+    BOOST_CHECK_EQUAL(afterExpire.nFinished, 1);
+
+    // Older than the longest time frame of the newest transfer, so it is not even stored
+    statistics.record(pair, makeTransfer("FINISHED", now - LONG_TIME_FRAME - 200, now - LONG_TIME_FRAME - 100, 1000));
+    WindowStatistics tooOld;
+    statistics.get(pair, boost::posix_time::seconds(2 * LONG_TIME_FRAME), now, &tooOld);
+    BOOST_CHECK_EQUAL(tooOld.nFinished, 1);
+
+    // Once everything is out of the window, the pair is gone
+    statistics.expire(now + 2 * LONG_TIME_FRAME);
+    WindowStatistics empty;
+    statistics.get(pair, boost::posix_time::seconds(2 * LONG_TIME_FRAME), now, &empty);
+    BOOST_CHECK_EQUAL(empty.nFinished, 0);
+}
+
+
+// Messages are ignored until rebuilt, and the data source falls back to the database until then
+BOOST_AUTO_TEST_CASE (streamingDataSource)
+{
+    const Pair pair("mock://source", "mock://destination");
+    const boost::posix_time::time_duration timeFrame = boost::posix_time::seconds(SHORT_TIME_FRAME);
+    const time_t now = time(NULL);
+
+    MockTerminalDataSource database;
+    database.transfers.emplace_back(pair, makeTransfer("FINISHED", now - 60, now - 30, 1200));
+    database.transfers.emplace_back(pair, makeTransfer("FAILED", now - 60, now - 30, 1000, true));
+
+    OptimizerStatistics statistics;
+    StreamingOptimizerDataSource dataSource(&database, &statistics);
+
+    fts3::events::Message msg;
+    msg.set_job_id("1906cc40-b915-11e5-9a03-02163e006dd0");
+    msg.set_file_id(42);
+    msg.set_source_se(pair.source);
+    msg.set_dest_se(pair.destination);
+    msg.set_transfer_status("FINISHED");
+    msg.set_timestamp(now * 1000);
+    msg.set_time_in_secs(10);
+    msg.set_filesize(1000);
+
+    statistics.record(msg);
+
+    int retryCount = 0;
+    BOOST_CHECK_EQUAL(dataSource.getSuccessRateForPair(pair, timeFrame, &retryCount), -1);
+    BOOST_CHECK_EQUAL(retryCount, -1);
+    BOOST_CHECK_EQUAL(dataSource.getAverageDuration(pair, timeFrame), -1);
+
+    statistics.rebuild(&database);
+    BOOST_CHECK(statistics.isReady());
+
+    // 1 finished, 1 failed
+    BOOST_CHECK_EQUAL(dataSource.getSuccessRateForPair(pair, timeFrame, &retryCount), 50);
+    BOOST_CHECK_EQUAL(retryCount, 0);
+    BOOST_CHECK_EQUAL(dataSource.getAverageDuration(pair, timeFrame), 30);
+
+    // 2 finished, 1 failed
+    statistics.record(msg);
+    BOOST_CHECK_EQUAL(dataSource.getSuccessRateForPair(pair, timeFrame, &retryCount), 67);
+    BOOST_CHECK_EQUAL(dataSource.getAverageDuration(pair, timeFrame), 20);
+
+    double throughput, filesizeAvg, filesizeStdDev;
+    dataSource.getThroughputInfo(pair, timeFrame, &throughput, &filesizeAvg, &filesizeStdDev);
+    BOOST_CHECK_CLOSE(filesizeAvg, 1100, 0.0001);
+    BOOST_CHECK_CLOSE(filesizeStdDev, 100, 0.0001);
+    BOOST_CHECK_CLOSE(throughput, 2200.0 / SHORT_TIME_FRAME, 0.0001);
+
+    // Non recoverable errors do not count
+    msg.set_transfer_status("FAILED");
+    msg.set_retry(false);
+    statistics.record(msg);
+    BOOST_CHECK_EQUAL(dataSource.getSuccessRateForPair(pair, timeFrame, &retryCount), 67);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <algorithm>
+#include <string>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "server/services/transfers/ExecuteProcess.h"
+
+
+BOOST_AUTO_TEST_SUITE(server)
+BOOST_AUTO_TEST_SUITE(ExecuteProcessTestSuite)
+
+
+/// Expose both launch methods
+class TestExecuteProcess: public ExecuteProcess {
+public:
+    TestExecuteProcess(const std::string &app, const std::string &arguments):
+        ExecuteProcess(app, arguments)
+    {
+    }
+
+    int launch(bool spawn, std::string &forkMessage)
+    {
+        if (spawn) {
+            return spawnProcessShell(forkMessage);
+        }
+        return forkProcessShell(forkMessage);
+    }
+};
+
+
+/// Run a shell command, and get what it writes into INHERITED_FD
+/// Spaces separate arguments, so ${IFS} must be used inside the command
+static std::string runShell(bool spawn, const std::string &command)
+{
+    int pipefds[2];
+    BOOST_REQUIRE(pipe2(pipefds, O_CLOEXEC) == 0);
+
+    // Should not be seen by the child
+    int canary = open("/dev/null", O_RDONLY);
+    BOOST_REQUIRE(canary >= 0);
+    BOOST_REQUIRE(dup2(canary, 200) == 200);
+    close(canary);
+
+    TestExecuteProcess process("/bin/sh", "-c " + command + ">&3");
+    process.setInheritedFd(pipefds[1]);
+
+    std::string forkMessage;
+    BOOST_CHECK_EQUAL(process.launch(spawn, forkMessage), 0);
+    BOOST_CHECK_GT(process.getPid(), 0);
+    close(pipefds[1]);
+    close(200);
+
+    std::string output;
+    char buffer[512];
+    ssize_t received;
+    while ((received = read(pipefds[0], buffer, sizeof(buffer))) > 0) {
+        output.append(buffer, received);
+    }
+    close(pipefds[0]);
+    return output;
+}
+
+
+static void checkChild(bool spawn)
+{
+    std::string fds = runShell(spawn, "ls${IFS}/proc/self/fd");
+    BOOST_CHECK(fds.find("3\n") != std::string::npos);
+    BOOST_CHECK(fds.find("200") == std::string::npos);
+
+    std::string cwd = runShell(spawn, "pwd");
+    BOOST_CHECK_EQUAL(cwd, "/tmp\n");
+}
+
+
+BOOST_AUTO_TEST_CASE (fork)
+{
+    checkChild(false);
+}
+
+
+BOOST_AUTO_TEST_CASE (spawn)
+{
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 34)
+    checkChild(true);
+#endif
+}
+
+
+BOOST_AUTO_TEST_CASE (missingBinary)
+{
+    ExecuteProcess process("/does/not/exist", "");
+
+    std::string forkMessage;
+    BOOST_CHECK_EQUAL(process.executeProcessShell(forkMessage), -1);
+    BOOST_CHECK(!forkMessage.empty());
+}
+
+
+/// The child must not see any descriptor of the server, however high the limit was raised
+BOOST_AUTO_TEST_CASE (highFds)
+{
+    struct rlimit original;
+    BOOST_REQUIRE(getrlimit(RLIMIT_NOFILE, &original) == 0);
+    struct rlimit raised = original;
+    raised.rlim_cur = std::min<rlim_t>(original.rlim_max, 65536);
+    BOOST_REQUIRE(setrlimit(RLIMIT_NOFILE, &raised) == 0);
+
+    const int high = raised.rlim_cur - 1;
+    int fd = open("/dev/null", O_RDONLY);
+    BOOST_REQUIRE(fd >= 0);
+    BOOST_REQUIRE(dup2(fd, high) == high);
+    close(fd);
+
+    std::string fds = runShell(false, "ls${IFS}/proc/self/fd");
+    BOOST_CHECK(fds.find(std::to_string(high)) == std::string::npos);
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 34)
+    fds = runShell(true, "ls${IFS}/proc/self/fd");
+    BOOST_CHECK(fds.find(std::to_string(high)) == std::string::npos);
+#endif
+
+    close(high);
+    setrlimit(RLIMIT_NOFILE, &original);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include "server/services/transfers/LinkConfigCache.h"
+#include "MockDbIfce.h"
+
+using namespace fts3::server;
+
+
+BOOST_AUTO_TEST_SUITE(server)
+BOOST_AUTO_TEST_SUITE(LinkConfigCacheTestSuite)
+
+
+struct MockRetryDb: public MockDbIfce {
+    int retryQueries;
+
+    MockRetryDb(): retryQueries(0) {}
+
+    int getRetry(const std::string &)
+    {
+        return ++retryQueries;
+    }
+};
+
+
+BOOST_AUTO_TEST_CASE(hitAndMiss)
+{
+    MockDbIfce db;
+    db.configurationVersion = "v1";
+    LinkConfigCache cache(0);
+
+    cache.newCycle(&db);
+    cache.getLink("srm://a", "srm://b");
+    cache.getLink("srm://a", "srm://b");
+    cache.getLink("srm://a", "srm://c");
+
+    BOOST_CHECK_EQUAL(db.linkQueries["srm://a => srm://b"], 1);
+    BOOST_CHECK_EQUAL(db.linkQueries["srm://a => srm://c"], 1);
+
+    // Same version, the entries survive the next cycle
+    cache.newCycle(&db);
+    cache.getLink("srm://a", "srm://b");
+    BOOST_CHECK_EQUAL(db.linkQueries["srm://a => srm://b"], 1);
+    BOOST_CHECK_EQUAL(db.versionQueries, 2);
+}
+
+
+BOOST_AUTO_TEST_CASE(invalidation)
+{
+    MockDbIfce db;
+    db.configurationVersion = "v1";
+    LinkConfigCache cache(0);
+
+    cache.newCycle(&db);
+    cache.getLink("srm://a", "srm://b");
+
+    db.configurationVersion = "v2";
+    cache.newCycle(&db);
+    cache.getLink("srm://a", "srm://b");
+    BOOST_CHECK_EQUAL(db.linkQueries["srm://a => srm://b"], 2);
+}
+
+
+BOOST_AUTO_TEST_CASE(versionCheckInterval)
+{
+    MockDbIfce db;
+    db.configurationVersion = "v1";
+    LinkConfigCache cache(3600);
+
+    cache.newCycle(&db);
+    cache.getLink("srm://a", "srm://b");
+    BOOST_CHECK_EQUAL(db.versionQueries, 1);
+
+    // Within the interval the version is not queried, so the change goes unnoticed
+    db.configurationVersion = "v2";
+    for (int i = 0; i < 10; ++i) {
+        cache.newCycle(&db);
+    }
+    cache.getLink("srm://a", "srm://b");
+    BOOST_CHECK_EQUAL(db.versionQueries, 1);
+    BOOST_CHECK_EQUAL(db.linkQueries["srm://a => srm://b"], 1);
+}
+
+
+BOOST_AUTO_TEST_CASE(perCycleValues)
+{
+    MockRetryDb db;
+    LinkConfigCache cache(3600);
+
+    cache.newCycle(&db);
+    BOOST_CHECK_EQUAL(cache.getRetry("job"), 1);
+    BOOST_CHECK_EQUAL(cache.getRetry("job"), 1);
+
+    // Retries are dropped on every cycle, even when the version is not checked
+    cache.newCycle(&db);
+    BOOST_CHECK_EQUAL(cache.getRetry("job"), 2);
+    BOOST_CHECK_EQUAL(db.versionQueries, 1);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
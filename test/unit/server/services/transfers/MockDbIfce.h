@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#ifndef MOCKDBIFCE_H_
+#define MOCKDBIFCE_H_
+
+#include <map>
+#include <string>
+
+#include "db/generic/GenericDbIfce.h"
+
+
+/// GenericDbIfce that answers every query with an empty value, and counts
+/// the calls the tests are interested in.
+/// Tests derive from it and override only what they exercise.
+class MockDbIfce: public GenericDbIfce
+{
+public:
+    std::string configurationVersion;
+    int versionQueries;
+    std::map<std::string, int> linkQueries;
+
+    MockDbIfce(): versionQueries(0) {}
+
+    void init(const std::string& username, const std::string& password, const std::string& connectString, int nPooledConnections) {}
+    std::list<fts3::events::MessageUpdater> getActiveInHost(const std::string &host) { return std::list<fts3::events::MessageUpdater>(); }
+    void getReadySessionReuseTransfers(const std::vector<QueueId>& queues, std::map<std::string, std::queue<std::pair<std::string, std::list<TransferFile>>>>& files) {}
+    void getReadyTransfers(const std::vector<QueueId>& queues, std::map<std::string, std::list<TransferFile>>& files) {}
+    boost::tuple<bool, std::string> updateTransferStatus(const std::string& jobId, uint64_t fileId, double throughput, const std::string& transferState, const std::string& errorReason, int processId, double filesize, double duration, bool retry, std::string fileMetadata) { return boost::tuple<bool, std::string>(); }
+    std::vector<TransferStatusOutcome> updateTransferStatusBulk(const std::vector<fts3::events::Message>& messages) { return std::vector<TransferStatusOutcome>(); }
+    bool updateJobStatus(const std::string& jobId, const std::string& jobState) { return false; }
+    boost::optional<UserCredential> findCredential(const std::string& delegationId, const std::string& userDn) { return boost::optional<UserCredential>(); }
+    bool isCredentialExpired(const std::string& delegationId, const std::string &userDn) { return false; }
+    fts3::optimizer::OptimizerDataSource* getOptimizerDataSource() { return NULL; }
+    bool isTrAllowed(const std::string& sourceStorage, const std::string& destStorage, int &currentActive) { return false; }
+    bool terminateReuseProcess(const std::string & jobId, int pid, const std::string & message, bool force) { return false; }
+    void reapStalledTransfers(std::vector<TransferFile>& transfers) {}
+    void setPidForJob(const std::string& jobId, int pid) {}
+    void backup(int intervalDays, long bulkSize, long* nJobs, long* nFiles, long* nDeletions) {}
+    void forkFailed(const std::string& jobId) {}
+    std::unique_ptr<LinkConfig> getLinkConfig(const std::string &source, const std::string &destination) { return std::unique_ptr<LinkConfig>(); }
+    std::vector<ShareConfig> getShareConfig(const std::string &source, const std::string &destination) { return std::vector<ShareConfig>(); }
+    int getRetry(const std::string & jobId) { return 0; }
+    int getRetryTimes(const std::string & jobId, uint64_t fileId) { return 0; }
+    void setToFailOldQueuedJobs(std::vector<std::string>& jobs) {}
+    void updateProtocol(const std::vector<fts3::events::Message>& messages) {}
+    void updateProtocol(const fts3::events::Message& message) {}
+    std::vector<TransferState> getStateOfTransfer(const std::string& jobId, uint64_t fileId) { return std::vector<TransferState>(); }
+    void checkSanityState() {}
+    void multihopSanitySate() {}
+    void setRetryTransfer(const std::string & jobId, uint64_t fileId, int retry, const std::string& reason, int errcode) {}
+    void updateFileTransferProgressVector(const std::vector<fts3::events::MessageUpdater> &messages) {}
+    void transferLogFileVector(std::map<int, fts3::events::MessageLog>& messagesLog) {}
+    unsigned int updateFileStatusReuse(const TransferFile &file, const std::string &status) { return 0; }
+    void getCancelJob(std::vector<std::pair<int, uint64_t>>& requestIDs) {}
+    std::list<TransferFile> getForceStartTransfers() { return std::list<TransferFile>(); }
+    bool getDrain() { return false; }
+    boost::tribool getEvictionFlag(const std::string &source) { return boost::indeterminate; }
+    int getStreamsOptimization(const std::string &sourceSe, const std::string &destSe) { return 0; }
+    int getGlobalTimeout(const std::string &voName) { return 0; }
+    int getSecPerMb(const std::string &voName) { return 0; }
+    bool getDisableStreamingFlag(const std::string &voName) { return false; }
+    void getQueuesWithPending(std::vector<QueueId>& queues) {}
+    void getQueuesWithSessionReusePending(std::vector<QueueId>& queues) {}
+    void updateDeletionsState(const std::vector<MinFileStatus>& delOpsStatus) {}
+    void getFilesForDeletion(std::vector<DeleteOperation>& delOps) {}
+    void requeueStartedDeletes() {}
+    void updateStagingState(const std::vector<MinFileStatus>& stagingOpStatus) {}
+    void updateArchivingState(const std::vector<MinFileStatus>& archivingOpStatus) {}
+    void setArchivingStartTime(const std::map<std::string, std::map<std::string, std::vector<uint64_t>>> &jobs) {}
+    void updateBringOnlineToken(const std::map<std::string, std::map<std::string, std::vector<uint64_t>>> &jobs, const std::string &token) {}
+    void getFilesForStaging(std::vector<StagingOperation> &stagingOps) {}
+    void getFilesForArchiving(std::vector<ArchivingOperation> &archivingOps) {}
+    void getFilesForQosTransition(std::vector<QosTransitionOperation> &qosTranstionOps, const std::string &qosOp, bool matchHost) {}
+    bool updateFileStateToQosRequestSubmitted(const std::string& jobId, uint64_t fileId) { return false; }
+    void updateFileStateToQosTerminal(const std::string& jobId, uint64_t fileId, const std::string& fileState, const std::string& reason) {}
+    void getAlreadyStartedStaging(std::vector<StagingOperation> &stagingOps) {}
+    void getAlreadyStartedArchiving(std::vector<ArchivingOperation> &archivingOps) {}
+    void getStagingDurations(std::map<std::string, std::vector<time_t>> &durations, time_t window) {}
+    void getArchivingDurations(std::map<std::string, std::vector<time_t>> &durations, time_t window) {}
+    void getStagingFilesForCanceling(std::set<std::pair<std::string, std::string>>& files) {}
+    void getArchivingFilesForCanceling(std::set<std::pair<std::string, std::string>>& files) {}
+    bool getCloudStorageCredentials(const std::string& userDn, const std::string& voName, const std::string& cloudName, CloudStorageAuth& auth) { return false; }
+    bool publishUserDn(const std::string &vo) { return false; }
+    StorageConfig getStorageConfig(const std::string &storage) { return StorageConfig(); }
+    std::string getConfigurationVersion()
+    {
+        ++versionQueries;
+        return configurationVersion;
+    }
+
+    unsigned getDebugLevel(const std::string& sourceStorage, const std::string& destStorage)
+    {
+        ++linkQueries[sourceStorage + " => " + destStorage];
+        return 0;
+    }
+
+    boost::tribool isProtocolUDT(const std::string &, const std::string &) { return false; }
+
+    boost::tribool isProtocolIPv6(const std::string &, const std::string &) { return false; }
+
+    bool getDisableDelegationFlag(const std::string &, const std::string &) { return false; }
+
+    std::string getThirdPartyTURL(const std::string &, const std::string &) { return std::string(); }
+};
+
+#endif // MOCKDBIFCE_H_
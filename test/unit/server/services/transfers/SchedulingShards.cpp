@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <set>
+#include <thread>
+
+#include "server/services/transfers/SchedulingShards.h"
+
+using namespace fts3::server;
+
+
+BOOST_AUTO_TEST_SUITE(server)
+BOOST_AUTO_TEST_SUITE(SchedulingShardsTestSuite)
+
+
+static std::vector<QueueId> generateQueues(unsigned nQueues, unsigned nStorages)
+{
+    std::vector<QueueId> queues;
+    for (unsigned i = 0; i < nQueues; ++i) {
+        std::string source = "gsiftp://source" + std::to_string(i % nStorages);
+        std::string dest = "gsiftp://dest" + std::to_string((i / nStorages) % nStorages);
+        std::string vo = "vo" + std::to_string(i % 3);
+        queues.emplace_back(source, dest, vo, 0);
+    }
+    return queues;
+}
+
+
+BOOST_AUTO_TEST_CASE (partition)
+{
+    std::vector<QueueId> queues = generateQueues(200, 10);
+    queues.emplace_back("gsiftp://source0", "gsiftp://dest0", "another", 0);
+
+    std::vector<std::vector<QueueId>> shards = partitionQueues(queues, 4);
+    BOOST_CHECK_LE(shards.size(), 4);
+
+    size_t total = 0;
+    std::map<std::string, size_t> linkShard;
+    for (size_t i = 0; i < shards.size(); ++i) {
+        BOOST_CHECK(!shards[i].empty());
+        total += shards[i].size();
+        for (auto q = shards[i].begin(); q != shards[i].end(); ++q) {
+            std::string link = q->sourceSe + " " + q->destSe;
+            if (linkShard.count(link)) {
+                BOOST_CHECK_EQUAL(linkShard[link], i);
+            }
+            linkShard[link] = i;
+        }
+    }
+    BOOST_CHECK_EQUAL(total, queues.size());
+
+    std::vector<std::vector<QueueId>> single = partitionQueues(queues, 0);
+    BOOST_REQUIRE_EQUAL(single.size(), 1);
+    BOOST_CHECK_EQUAL(single[0].size(), queues.size());
+    BOOST_CHECK_EQUAL(single[0].back().voName, "another");
+}
+
+
+BOOST_AUTO_TEST_CASE (slotTable)
+{
+    SlotTable slots(3);
+    slots.addStorage("source", 10, 2);
+    slots.addStorage("dest", 1, 10);
+    // Already known, ignored
+    slots.addStorage("dest", 100, 100);
+
+    BOOST_CHECK(slots.hasStorage("source"));
+    BOOST_CHECK(!slots.hasStorage("other"));
+
+    BOOST_CHECK_EQUAL(slots.acquire("source", "dest"), SlotTable::ACQUIRED);
+    BOOST_CHECK_EQUAL(slots.acquire("source", "dest"), SlotTable::DESTINATION_FULL);
+    BOOST_CHECK_EQUAL(slots.acquire("source", "source"), SlotTable::ACQUIRED);
+    BOOST_CHECK_EQUAL(slots.acquire("source", "source"), SlotTable::SOURCE_FULL);
+    BOOST_CHECK_EQUAL(slots.acquire("dest", "other"), SlotTable::DESTINATION_FULL);
+
+    // Failures give back what they took
+    BOOST_CHECK_EQUAL(slots.getUrlCopySlots(), 1);
+    BOOST_CHECK_EQUAL(slots.getDestinationSlots("source"), 9);
+
+    BOOST_CHECK_EQUAL(slots.acquire("dest", "source"), SlotTable::ACQUIRED);
+    BOOST_CHECK_EQUAL(slots.acquire("dest", "source"), SlotTable::URLCOPY_FULL);
+
+    // Running transfers can leave the counters below zero
+    slots.addActive("source", "dest", 5);
+    BOOST_CHECK_EQUAL(slots.getSourceSlots("source"), -5);
+    BOOST_CHECK_EQUAL(slots.getDestinationSlots("dest"), -5);
+}
+
+
+BOOST_AUTO_TEST_CASE (slotTableConcurrent)
+{
+    const int nThreads = 8;
+    SlotTable slots(1000);
+    slots.addStorage("shared", 300, 300);
+    for (int i = 0; i < nThreads; ++i) {
+        slots.addStorage("storage" + std::to_string(i), 1000, 1000);
+    }
+
+    std::vector<int> acquired(nThreads, 0);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < nThreads; ++i) {
+        threads.emplace_back([&slots, &acquired, i]() {
+            std::string own = "storage" + std::to_string(i);
+            for (int j = 0; j < 1000; ++j) {
+                if (slots.acquire(own, "shared") == SlotTable::ACQUIRED) {
+                    ++acquired[i];
+                }
+                if (slots.acquire(own, own) == SlotTable::ACQUIRED) {
+                    ++acquired[i];
+                }
+            }
+        });
+    }
+    for (auto i = threads.begin(); i != threads.end(); ++i) {
+        i->join();
+    }
+
+    int total = 0;
+    for (int i = 0; i < nThreads; ++i) {
+        total += acquired[i];
+    }
+    BOOST_CHECK_EQUAL(total, 1000);
+    BOOST_CHECK_EQUAL(slots.getUrlCopySlots(), 0);
+    BOOST_CHECK_GE(slots.getDestinationSlots("shared"), 0);
+}
+
+
+BOOST_AUTO_TEST_CASE (splitSlots)
+{
+    // Enough for everyone
+    std::vector<int> quotas = fts3::server::splitSlots(100, {10, 0, 20});
+    BOOST_CHECK_EQUAL(quotas[0], 10);
+    BOOST_CHECK_EQUAL(quotas[1], 0);
+    BOOST_CHECK_EQUAL(quotas[2], 20);
+
+    // Proportional, remainder to the largest fractions
+    quotas = fts3::server::splitSlots(10, {30, 10, 5});
+    BOOST_CHECK_EQUAL(quotas[0], 7);
+    BOOST_CHECK_EQUAL(quotas[1], 2);
+    BOOST_CHECK_EQUAL(quotas[2], 1);
+
+    quotas = fts3::server::splitSlots(7, {1, 1, 1, 100});
+    int total = 0;
+    for (size_t i = 0; i < quotas.size(); ++i) {
+        BOOST_CHECK_LE(quotas[i], (i < 3) ? 1 : 100);
+        total += quotas[i];
+    }
+    BOOST_CHECK_EQUAL(total, 7);
+    BOOST_CHECK_GE(quotas[3], 4);
+
+    // Nothing to give
+    quotas = fts3::server::splitSlots(0, {10, 10});
+    BOOST_CHECK_EQUAL(quotas[0] + quotas[1], 0);
+    quotas = fts3::server::splitSlots(-5, {10});
+    BOOST_CHECK_EQUAL(quotas[0], 0);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include <map>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include "server/services/transfers/StatusMessageBatch.h"
+
+using namespace fts3::server;
+using fts3::events::Message;
+
+
+BOOST_AUTO_TEST_SUITE(server)
+BOOST_AUTO_TEST_SUITE(StatusMessageBatchTestSuite)
+
+
+static Message makeMessage(uint64_t fileId, const std::string &state, bool retry = false)
+{
+    Message msg;
+    msg.set_job_id("8fa6e4d2-1e32-11e6-9f0c-02163e00a17a");
+    msg.set_file_id(fileId);
+    msg.set_transfer_status(state);
+    msg.set_retry(retry);
+    return msg;
+}
+
+
+// Mimics the two database paths of MessageProcessingService:
+// a retry resets the file right away, while the rest go through the bulk update,
+// which only moves a file forward from the state it finds stored
+struct MockFileStates {
+    std::map<uint64_t, std::string> states;
+    int bulkCalls;
+
+    MockFileStates(): bulkCalls(0) {}
+
+    bool prepare(const Message &msg) {
+        if (msg.transfer_status() == "FAILED" && msg.retry()) {
+            states[msg.file_id()] = "SUBMITTED";
+            return false;
+        }
+        return true;
+    }
+
+    void apply(const std::vector<Message> &batch) {
+        ++bulkCalls;
+        for (auto i = batch.begin(); i != batch.end(); ++i) {
+            std::string &stored = states[i->file_id()];
+            if (i->transfer_status() == "ACTIVE" && (stored == "SUBMITTED" || stored == "READY")) {
+                stored = "ACTIVE";
+            }
+            else if (i->transfer_status() != "ACTIVE" && stored == "ACTIVE") {
+                stored = i->transfer_status();
+            }
+        }
+    }
+
+    /// Feed the messages the way MessageProcessingService::handleOtherMessages does
+    void process(const std::vector<Message> &messages) {
+        StatusMessageBatch batch;
+        auto prepareFunc = [this](const Message &msg) { return prepare(msg); };
+        auto applyFunc = [this](const std::vector<Message> &messages) { apply(messages); };
+
+        for (auto i = messages.begin(); i != messages.end(); ++i) {
+            batch.process(*i, prepareFunc, applyFunc);
+        }
+        batch.flush(applyFunc);
+    }
+};
+
+
+BOOST_AUTO_TEST_CASE (activeThenRetry)
+{
+    MockFileStates db;
+    db.states[1] = "READY";
+
+    std::vector<Message> messages;
+    messages.push_back(makeMessage(1, "ACTIVE"));
+    messages.push_back(makeMessage(1, "FAILED", true));
+    db.process(messages);
+
+    // Without the flush, the ACTIVE would land over the reset and leave an orphan ACTIVE file
+    BOOST_CHECK_EQUAL(db.states[1], "SUBMITTED");
+    BOOST_CHECK_EQUAL(db.bulkCalls, 1);
+}
+
+
+BOOST_AUTO_TEST_CASE (otherFilesStayBatched)
+{
+    MockFileStates db;
+    db.states[1] = "READY";
+    db.states[2] = "READY";
+    db.states[3] = "ACTIVE";
+
+    std::vector<Message> messages;
+    messages.push_back(makeMessage(1, "ACTIVE"));
+    messages.push_back(makeMessage(2, "ACTIVE"));
+    messages.push_back(makeMessage(3, "FAILED", true));
+    messages.push_back(makeMessage(2, "FINISHED"));
+    messages.push_back(makeMessage(1, "FAILED", false));
+    db.process(messages);
+
+    BOOST_CHECK_EQUAL(db.states[1], "FAILED");
+    BOOST_CHECK_EQUAL(db.states[2], "FINISHED");
+    BOOST_CHECK_EQUAL(db.states[3], "SUBMITTED");
+    // Only the FAILED for file 1, which was pending, splits the batch
+    BOOST_CHECK_EQUAL(db.bulkCalls, 2);
+}
+
+
+BOOST_AUTO_TEST_CASE (updatesAndEmptyBatches)
+{
+    MockFileStates db;
+    db.states[1] = "READY";
+
+    // UPDATE messages never reach the bulk update, and an empty batch is never applied
+    std::vector<Message> messages;
+    messages.push_back(makeMessage(1, "UPDATE"));
+    db.process(messages);
+    BOOST_CHECK_EQUAL(db.bulkCalls, 0);
+
+    messages.push_back(makeMessage(1, "FAILED", true));
+    db.process(messages);
+    BOOST_CHECK_EQUAL(db.states[1], "SUBMITTED");
+    BOOST_CHECK_EQUAL(db.bulkCalls, 0);
+}
+
+
+BOOST_AUTO_TEST_CASE (take)
+{
+    StatusMessageBatch batch;
+    BOOST_CHECK(batch.empty());
+    BOOST_CHECK(!batch.mustFlushBefore(makeMessage(1, "FAILED", true)));
+
+    batch.push(makeMessage(1, "ACTIVE"));
+    batch.push(makeMessage(2, "ACTIVE"));
+    BOOST_CHECK(!batch.mustFlushBefore(makeMessage(1, "FINISHED")));
+    BOOST_CHECK(batch.mustFlushBefore(makeMessage(1, "FAILED")));
+    BOOST_CHECK(!batch.mustFlushBefore(makeMessage(3, "FAILED")));
+
+    std::vector<Message> pending = batch.take();
+    BOOST_REQUIRE_EQUAL(pending.size(), 2);
+    BOOST_CHECK_EQUAL(pending[0].file_id(), 1);
+    BOOST_CHECK_EQUAL(pending[1].file_id(), 2);
+    BOOST_CHECK(batch.empty());
+    BOOST_CHECK(!batch.mustFlushBefore(makeMessage(1, "FAILED")));
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+#include <unistd.h>
+
+#include "server/services/transfers/ThreadSafeList.h"
+
+using fts3::events::MessageUpdater;
+
+
+BOOST_AUTO_TEST_SUITE(server)
+BOOST_AUTO_TEST_SUITE(ThreadSafeListTestSuite)
+
+
+static MessageUpdater makeMessage(const std::string &jobId, uint64_t fileId, int pid, uint64_t timestamp)
+{
+    MessageUpdater msg;
+    msg.set_job_id(jobId);
+    msg.set_file_id(fileId);
+    msg.set_process_id(pid);
+    msg.set_timestamp(timestamp);
+    return msg;
+}
+
+
+static const boost::posix_time::minutes TIMEOUT(10);
+
+
+BOOST_AUTO_TEST_CASE (expiredUntilRemoved)
+{
+    ThreadSafeList list;
+    uint64_t now = millisecondsSinceEpoch();
+
+    MessageUpdater stalled = makeMessage("job", 1, 1234, now - 3600 * 1000);
+    MessageUpdater alive = makeMessage("job", 2, 1235, now);
+    list.push_back(stalled);
+    list.push_back(alive);
+    BOOST_CHECK_EQUAL(list.size(), 2);
+
+    std::vector<MessageUpdater> expired;
+    list.checkExpiredMsg(expired, TIMEOUT);
+    BOOST_REQUIRE_EQUAL(expired.size(), 1);
+    BOOST_CHECK_EQUAL(expired[0].file_id(), 1);
+
+    // Still there until removed
+    expired.clear();
+    list.checkExpiredMsg(expired, TIMEOUT);
+    BOOST_CHECK_EQUAL(expired.size(), 1);
+
+    list.deleteMsg(expired);
+    BOOST_CHECK_EQUAL(list.size(), 1);
+
+    expired.clear();
+    list.checkExpiredMsg(expired, TIMEOUT);
+    BOOST_CHECK_EQUAL(expired.size(), 0);
+
+    list.removeFinishedTr("job", 2);
+    BOOST_CHECK_EQUAL(list.size(), 0);
+}
+
+
+BOOST_AUTO_TEST_CASE (updateRefreshesAllFilesOfThePid)
+{
+    ThreadSafeList list;
+    uint64_t now = millisecondsSinceEpoch();
+    int pid = getpid();
+
+    // Session reuse: several files on the same process
+    MessageUpdater first = makeMessage("job", 10, pid, now - 3600 * 1000);
+    MessageUpdater second = makeMessage("job", 11, pid, now - 3600 * 1000);
+    MessageUpdater other = makeMessage("job", 12, pid + 1, now - 3600 * 1000);
+    list.push_back(first);
+    list.push_back(second);
+    list.push_back(other);
+
+    MessageUpdater ping = makeMessage("job", 10, pid, now);
+    list.updateMsg(ping);
+
+    std::vector<MessageUpdater> expired;
+    list.checkExpiredMsg(expired, TIMEOUT);
+    BOOST_REQUIRE_EQUAL(expired.size(), 1);
+    BOOST_CHECK_EQUAL(expired[0].file_id(), 12);
+}
+
+
+BOOST_AUTO_TEST_CASE (updateAfterPartialRemoval)
+{
+    ThreadSafeList list;
+    uint64_t now = millisecondsSinceEpoch();
+    int pid = getpid();
+
+    // Two files on the same shard, and one on another
+    MessageUpdater first = makeMessage("job", 40, pid, now - 3600 * 1000);
+    MessageUpdater sameShard = makeMessage("job", 56, pid, now - 3600 * 1000);
+    MessageUpdater otherShard = makeMessage("job", 41, pid, now - 3600 * 1000);
+    list.push_back(first);
+    list.push_back(sameShard);
+    list.push_back(otherShard);
+
+    list.removeFinishedTr("job", 40);
+    list.removeFinishedTr("job", 41);
+
+    // The process still has a transfer, so its pings must still reach it
+    MessageUpdater ping = makeMessage("job", 56, pid, now);
+    list.updateMsg(ping);
+
+    std::vector<MessageUpdater> expired;
+    list.checkExpiredMsg(expired, TIMEOUT);
+    BOOST_CHECK_EQUAL(expired.size(), 0);
+
+    // And once it has none, pushing again is tracked from scratch
+    list.removeFinishedTr("job", 56);
+    list.push_back(otherShard);
+    list.updateMsg(ping);
+    list.checkExpiredMsg(expired, TIMEOUT);
+    BOOST_CHECK_EQUAL(expired.size(), 0);
+}
+
+
+BOOST_AUTO_TEST_CASE (unbindPid)
+{
+    ThreadSafeList list;
+    uint64_t now = millisecondsSinceEpoch();
+    int pid = getpid();
+
+    // An url copy worker ran a transfer whose final message was lost, and then got a new one
+    MessageUpdater previous = makeMessage("job", 60, pid, now - 3600 * 1000);
+    list.push_back(previous);
+
+    list.unbindPid(pid);
+    MessageUpdater current = makeMessage("job", 61, pid, now - 3600 * 1000);
+    list.push_back(current);
+
+    // Pings of the worker only keep the current transfer alive
+    MessageUpdater ping = makeMessage("job", 61, pid, now);
+    list.updateMsg(ping);
+
+    std::vector<MessageUpdater> expired;
+    list.checkExpiredMsg(expired, TIMEOUT);
+    BOOST_REQUIRE_EQUAL(expired.size(), 1);
+    BOOST_CHECK_EQUAL(expired[0].file_id(), 60);
+
+    // Removing the stale one does not detach the current one
+    list.deleteMsg(expired);
+    BOOST_CHECK_EQUAL(list.size(), 1);
+    list.updateMsg(ping);
+    expired.clear();
+    list.checkExpiredMsg(expired, TIMEOUT);
+    BOOST_CHECK_EQUAL(expired.size(), 0);
+}
+
+
+BOOST_AUTO_TEST_CASE (ignoreMessagesOlderThanProcess)
+{
+    ThreadSafeList list;
+    uint64_t now = millisecondsSinceEpoch();
+    int pid = getpid();
+
+    MessageUpdater msg = makeMessage("job", 20, pid, now - 3600 * 1000);
+    list.push_back(msg);
+
+    // Sent before this process started, so it must come from a previous process with the same pid
+    MessageUpdater ping = makeMessage("job", 20, pid, 1000);
+    list.updateMsg(ping);
+
+    std::vector<MessageUpdater> expired;
+    list.checkExpiredMsg(expired, TIMEOUT);
+    BOOST_CHECK_EQUAL(expired.size(), 1);
+}
+
+
+BOOST_AUTO_TEST_CASE (pushReplaces)
+{
+    ThreadSafeList list;
+    uint64_t now = millisecondsSinceEpoch();
+
+    MessageUpdater old = makeMessage("job", 30, 1234, now - 3600 * 1000);
+    MessageUpdater fresh = makeMessage("job", 30, 1234, now);
+    list.push_back(old);
+    list.push_back(fresh);
+    BOOST_CHECK_EQUAL(list.size(), 1);
+
+    std::vector<MessageUpdater> expired;
+    list.checkExpiredMsg(expired, TIMEOUT);
+    BOOST_CHECK_EQUAL(expired.size(), 0);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <chrono>
+#include <malloc.h>
+
+#include "server/services/transfers/TransferFileHandler.h"
+
+using namespace fts3::server;
+using fts3::common::SymbolTable;
+
+
+BOOST_AUTO_TEST_SUITE(server)
+BOOST_AUTO_TEST_SUITE(TransferFileHandlerTestSuite)
+
+
+static TransferFile makeFile(const std::string &jobId, int fileIndex, uint64_t fileId,
+    const std::string &source, const std::string &dest, const std::string &vo)
+{
+    TransferFile file;
+    file.jobId = jobId;
+    file.fileIndex = fileIndex;
+    file.fileId = fileId;
+    file.sourceSe = source;
+    file.destSe = dest;
+    file.voName = vo;
+    return file;
+}
+
+
+BOOST_AUTO_TEST_CASE (roundRobin)
+{
+    std::map<std::string, std::list<TransferFile>> files;
+    files["atlas"].push_back(makeFile("job1", 0, 1, "gsiftp://a", "gsiftp://b", "atlas"));
+    files["atlas"].push_back(makeFile("job1", 1, 2, "gsiftp://a", "gsiftp://b", "atlas"));
+    files["atlas"].push_back(makeFile("job2", 0, 3, "gsiftp://c", "gsiftp://b", "atlas"));
+    // Two replicas of the same file
+    files["cms"].push_back(makeFile("job3", 0, 4, "gsiftp://a", "gsiftp://d", "cms"));
+    files["cms"].push_back(makeFile("job3", 0, 5, "gsiftp://c", "gsiftp://d", "cms"));
+
+    TransferFileHandler handler(files);
+    BOOST_CHECK_EQUAL(handler.size(), 4);
+    BOOST_CHECK(!handler.empty());
+
+    std::vector<std::string> vos;
+    for (auto i = handler.begin(); i != handler.end(); ++i) {
+        vos.push_back(SymbolTable::vos().name(*i));
+    }
+    BOOST_REQUIRE_EQUAL(vos.size(), 2);
+    BOOST_CHECK_EQUAL(vos[0], "atlas");
+    BOOST_CHECK_EQUAL(vos[1], "cms");
+
+    Symbol atlas = *handler.begin();
+    Symbol cms = *(handler.begin() + 1);
+
+    // Pairs alternate within a VO
+    boost::optional<TransferFile> first = handler.get(atlas);
+    boost::optional<TransferFile> second = handler.get(atlas);
+    BOOST_REQUIRE(first && second);
+    BOOST_CHECK(first->sourceSe != second->sourceSe);
+    BOOST_CHECK_EQUAL(first->voId, atlas);
+    BOOST_CHECK_EQUAL(first->destSeId, SymbolTable::storages().intern("gsiftp://b"));
+
+    boost::optional<TransferFile> third = handler.get(atlas);
+    BOOST_REQUIRE(third);
+    BOOST_CHECK(!handler.get(atlas));
+
+    // Only the first replica is served
+    boost::optional<TransferFile> replica = handler.get(cms);
+    BOOST_REQUIRE(replica);
+    BOOST_CHECK_EQUAL(replica->fileId, 4);
+    BOOST_CHECK(!handler.get(cms));
+
+    BOOST_CHECK(handler.empty());
+    BOOST_CHECK_EQUAL(handler.size(), 0);
+}
+
+
+BOOST_AUTO_TEST_CASE (relations)
+{
+    std::map<std::string, std::list<TransferFile>> files;
+    files["atlas"].push_back(makeFile("job1", 0, 1, "gsiftp://a", "gsiftp://b", "atlas"));
+    files["cms"].push_back(makeFile("job2", 0, 2, "gsiftp://c", "gsiftp://b", "cms"));
+
+    TransferFileHandler handler(files);
+
+    std::set<std::string> expected = {"gsiftp://a", "gsiftp://c"};
+    BOOST_CHECK(handler.getSources("gsiftp://b") == expected);
+    expected = {"atlas", "cms"};
+    BOOST_CHECK(handler.getSourcesVos("gsiftp://b") == expected);
+    expected = {"gsiftp://b"};
+    BOOST_CHECK(handler.getDestinations("gsiftp://a") == expected);
+    expected = {"cms"};
+    BOOST_CHECK(handler.getDestinationsVos("gsiftp://c") == expected);
+
+    BOOST_CHECK(handler.getSources("gsiftp://a").empty());
+    BOOST_CHECK(handler.getSources("gsiftp://never-seen").empty());
+}
+
+
+/// Build and drain a handler with 100k queued files, as a scheduling cycle would
+BOOST_AUTO_TEST_CASE (queued100k)
+{
+    const int nFiles = 100000;
+    const int nStorages = 50;
+    const int nVos = 5;
+
+    std::map<std::string, std::list<TransferFile>> files;
+    for (int i = 0; i < nFiles; ++i) {
+        std::string vo = "vo" + std::to_string(i % nVos);
+        files[vo].push_back(makeFile("job" + std::to_string(i / 100), i % 100, i + 1,
+            "gsiftp://source" + std::to_string(i % nStorages) + ".cern.ch",
+            "gsiftp://destination" + std::to_string((i / nStorages) % nStorages) + ".cern.ch",
+            vo));
+    }
+
+    struct mallinfo2 before = mallinfo2();
+    auto start = std::chrono::steady_clock::now();
+
+    TransferFileHandler handler(files);
+
+    auto built = std::chrono::steady_clock::now();
+    struct mallinfo2 after = mallinfo2();
+
+    int served = 0;
+    while (!handler.empty()) {
+        for (auto vo = handler.begin(); vo != handler.end(); ++vo) {
+            if (handler.get(*vo)) {
+                ++served;
+            }
+        }
+    }
+
+    auto drained = std::chrono::steady_clock::now();
+    BOOST_CHECK_EQUAL(served, nFiles);
+
+    std::chrono::duration<double, std::milli> buildTime = built - start;
+    std::chrono::duration<double, std::milli> drainTime = drained - built;
+    BOOST_TEST_MESSAGE("Build: " << buildTime.count() << " ms, "
+        << "drain: " << drainTime.count() << " ms, "
+        << "memory: " << (double(after.uordblks) - double(before.uordblks)) / (1024 * 1024) << " MiB");
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "server/services/transfers/UrlCopyRegistry.h"
+
+using fts3::server::UrlCopyRegistry;
+
+
+BOOST_AUTO_TEST_SUITE(server)
+BOOST_AUTO_TEST_SUITE(UrlCopyRegistryTestSuite)
+
+
+BOOST_AUTO_TEST_CASE (trackChild)
+{
+    UrlCopyRegistry &registry = UrlCopyRegistry::instance();
+    int initial = registry.count();
+
+    pid_t child = fork();
+    BOOST_REQUIRE(child >= 0);
+    if (child == 0) {
+        pause();
+        _exit(0);
+    }
+
+    registry.add(child);
+    BOOST_CHECK_EQUAL(registry.count(), initial + 1);
+
+    // Alive, so it stays
+    registry.sweep();
+    BOOST_CHECK_EQUAL(registry.count(), initial + 1);
+
+    kill(child, SIGKILL);
+    waitpid(child, NULL, 0);
+
+    registry.sweep();
+    BOOST_CHECK_EQUAL(registry.count(), initial);
+}
+
+
+BOOST_AUTO_TEST_CASE (reconcile)
+{
+    UrlCopyRegistry &registry = UrlCopyRegistry::instance();
+
+    // This process is not an url copy, so reconciling must drop it
+    registry.add(getpid());
+    int withSelf = registry.count();
+    registry.reconcile();
+    BOOST_CHECK_EQUAL(registry.count(), withSelf - 1);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -16,6 +16,7 @@
 
 #include <boost/test/unit_test_suite.hpp>
 #include <boost/test/test_tools.hpp>
+#include <fstream>
 #include "url-copy/UrlCopyProcess.h"
 
 
@@ -242,4 +243,95 @@ BOOST_FIXTURE_TEST_CASE (multiplePanic, UrlCopyFixture)
 }
 
 
+BOOST_FIXTURE_TEST_CASE (sharedContext, UrlCopyFixture)
+{
+    Transfer original;
+    original.source = Uri::parse("mock://host/path?size=10");
+    original.destination = Uri::parse("mock://host/path?size_post=10");
+    original.jobId = "1234-5678";
+    original.fileId = 42;
+
+    // First transfer: debug level 3, a third party TURL, a token file and a raised log level
+    UrlCopyOpts first(opts);
+    first.transfers.push_back(original);
+    first.debugLevel = 3;
+    first.retry = 2;
+    first.thirdPartyTURL = "gsiftp;https";
+    first.oauthFile = "/tmp/fts3-tests-oauth.conf";
+    {
+        std::ofstream oauth(first.oauthFile.c_str());
+        oauth << "[BEARER]" << std::endl << "TOKEN=secret" << std::endl;
+    }
+
+    Gfal2 gfal2;
+    const std::string logSensitive = gfal2.get("HTTP PLUGIN", "LOG_SENSITIVE");
+    const std::string turl = gfal2.get("SRM PLUGIN", "TURL_3RD_PARTY_PROTOCOLS");
+    const GLogLevelFlags logLevel = gfal2_log_get_level();
+
+    gfal2.beginTransfer();
+    {
+        UrlCopyProcess proc(first, *this, gfal2);
+        proc.run();
+    }
+    gfal2_log_set_level(G_LOG_LEVEL_DEBUG);
+
+    BOOST_CHECK_EQUAL(gfal2.get("HTTP PLUGIN", "LOG_SENSITIVE"), "true");
+    BOOST_CHECK_EQUAL(gfal2.get("SRM PLUGIN", "TURL_3RD_PARTY_PROTOCOLS"), "gsiftp;https");
+    BOOST_CHECK_EQUAL(gfal2.get("BEARER", "TOKEN"), "secret");
+    BOOST_CHECK_EQUAL(gfal2.getClientInfo("job-id"), "1234-5678");
+    BOOST_CHECK_EQUAL(gfal2.getClientInfo("retry"), "2");
+
+    // The worker undoes all of it before the next transfer
+    BOOST_CHECK(gfal2.resetTransfer());
+
+    BOOST_CHECK_EQUAL(gfal2.get("HTTP PLUGIN", "LOG_SENSITIVE"), logSensitive);
+    BOOST_CHECK_EQUAL(gfal2.get("SRM PLUGIN", "TURL_3RD_PARTY_PROTOCOLS"), turl);
+    BOOST_CHECK_EQUAL(gfal2.get("BEARER", "TOKEN"), "N/A");
+    BOOST_CHECK_EQUAL(gfal2.getClientInfo("job-id"), "");
+    BOOST_CHECK_EQUAL(gfal2.getClientInfo("file-id"), "");
+    BOOST_CHECK_EQUAL(gfal2.getClientInfo("retry"), "");
+    BOOST_CHECK_EQUAL(gfal2_log_get_level(), logLevel);
+
+    // Second transfer on the same context only sees its own configuration
+    original.jobId = "8765-4321";
+    original.fileId = 43;
+    UrlCopyOpts second(opts);
+    second.transfers.push_back(original);
+
+    gfal2.beginTransfer();
+    {
+        UrlCopyProcess proc(second, *this, gfal2);
+        proc.run();
+    }
+
+    BOOST_CHECK_EQUAL(gfal2.get("HTTP PLUGIN", "LOG_SENSITIVE"), logSensitive);
+    BOOST_CHECK_EQUAL(gfal2.get("SRM PLUGIN", "TURL_3RD_PARTY_PROTOCOLS"), turl);
+    BOOST_CHECK_EQUAL(gfal2.get("BEARER", "TOKEN"), "N/A");
+    BOOST_CHECK_EQUAL(gfal2.getClientInfo("job-id"), "8765-4321");
+    BOOST_CHECK_EQUAL(gfal2.getClientInfo("file-id"), "43");
+    BOOST_CHECK_EQUAL(gfal2.getClientInfo("retry"), "0");
+
+    BOOST_CHECK(gfal2.resetTransfer());
+
+    BOOST_CHECK_EQUAL(completedMsgs.size(), 2);
+    BOOST_CHECK_EQUAL(completedMsgs.front().error.get(), (void*)NULL);
+    BOOST_CHECK_EQUAL(completedMsgs.back().error.get(), (void*)NULL);
+}
+
+
+/// A context with a configuration file that can not be parsed back must not be reused
+BOOST_FIXTURE_TEST_CASE (sharedContextUnknownFile, UrlCopyFixture)
+{
+    Gfal2 gfal2;
+    gfal2.beginTransfer();
+    BOOST_CHECK_THROW(gfal2.loadConfigFile("/tmp/fts3-tests-does-not-exist.conf"), Gfal2Exception);
+    BOOST_CHECK(!gfal2.resetTransfer());
+
+    // Nor a context that was never tracked
+    Gfal2 untracked;
+    untracked.set("HTTP PLUGIN", "LOG_SENSITIVE", true);
+    BOOST_CHECK(!untracked.resetTransfer());
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
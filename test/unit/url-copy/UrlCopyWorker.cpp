@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) CERN 2026
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/test_tools.hpp>
+#include "url-copy/UrlCopyWorker.h"
+
+
+BOOST_AUTO_TEST_SUITE(url_copy)
+BOOST_AUTO_TEST_SUITE(UrlCopyWorkerTest)
+
+
+BOOST_AUTO_TEST_CASE (parseCancel)
+{
+    uint64_t fileId = 0;
+
+    BOOST_CHECK(UrlCopyWorker::parseCancel("CANCEL 1234", fileId));
+    BOOST_CHECK_EQUAL(fileId, 1234);
+
+    // Transfer command lines, or garbage, are not cancel requests
+    BOOST_CHECK(!UrlCopyWorker::parseCancel("--file-id 1234 --job-id abc", fileId));
+    BOOST_CHECK(!UrlCopyWorker::parseCancel("CANCEL", fileId));
+    BOOST_CHECK(!UrlCopyWorker::parseCancel("CANCEL abc", fileId));
+    BOOST_CHECK(!UrlCopyWorker::parseCancel("CANCELED 1234", fileId));
+    BOOST_CHECK_EQUAL(fileId, 1234);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()